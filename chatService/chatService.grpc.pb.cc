@@ -31,12 +31,14 @@ static const char* ChatService_method_names[] = {
   "/chatservice.ChatService/QueryMessages",
   "/chatservice.ChatService/DeleteAccount",
   "/chatservice.ChatService/RefreshClient",
-  "/chatservice.ChatService/Commit",
+  "/chatservice.ChatService/Replicate",
   "/chatservice.ChatService/HeartBeat",
   "/chatservice.ChatService/SuggestLeaderElection",
   "/chatservice.ChatService/LeaderElection",
   "/chatservice.ChatService/AddToPending",
   "/chatservice.ChatService/RequestPendingLog",
+  "/chatservice.ChatService/InstallSnapshot",
+  "/chatservice.ChatService/RequestLogPosition",
   "/chatservice.ChatService/MessagesSeen",
 };
 
@@ -56,13 +58,15 @@ ChatService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channe
   , rpcmethod_QueryMessages_(ChatService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   , rpcmethod_DeleteAccount_(ChatService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_RefreshClient_(ChatService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Commit_(ChatService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Replicate_(ChatService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   , rpcmethod_HeartBeat_(ChatService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SuggestLeaderElection_(ChatService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_LeaderElection_(ChatService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_AddToPending_(ChatService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
   , rpcmethod_RequestPendingLog_(ChatService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
-  , rpcmethod_MessagesSeen_(ChatService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InstallSnapshot_(ChatService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
+  , rpcmethod_RequestLogPosition_(ChatService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_MessagesSeen_(ChatService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status ChatService::Stub::CreateAccount(::grpc::ClientContext* context, const ::chatservice::CreateAccountMessage& request, ::chatservice::CreateAccountReply* response) {
@@ -251,27 +255,20 @@ void ChatService::Stub::async::RefreshClient(::grpc::ClientContext* context, con
   return result;
 }
 
-::grpc::Status ChatService::Stub::Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::chatservice::CommitResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::chatservice::CommitRequest, ::chatservice::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Commit_, context, request, response);
+::grpc::ClientReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* ChatService::Stub::ReplicateRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>::Create(channel_.get(), rpcmethod_Replicate_, context);
 }
 
-void ChatService::Stub::async::Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::chatservice::CommitRequest, ::chatservice::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Commit_, context, request, response, std::move(f));
+void ChatService::Stub::async::Replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chatservice::ReplicateRequest,::chatservice::ReplicateAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::chatservice::ReplicateRequest,::chatservice::ReplicateAck>::Create(stub_->channel_.get(), stub_->rpcmethod_Replicate_, context, reactor);
 }
 
-void ChatService::Stub::async::Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Commit_, context, request, response, reactor);
+::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* ChatService::Stub::AsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>::Create(channel_.get(), cq, rpcmethod_Replicate_, context, true, tag);
 }
 
-::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>* ChatService::Stub::PrepareAsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chatservice::CommitResponse, ::chatservice::CommitRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Commit_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>* ChatService::Stub::AsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncCommitRaw(context, request, cq);
-  result->StartCall();
-  return result;
+::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* ChatService::Stub::PrepareAsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>::Create(channel_.get(), cq, rpcmethod_Replicate_, context, false, nullptr);
 }
 
 ::grpc::Status ChatService::Stub::HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::chatservice::HeartBeatResponse* response) {
@@ -343,36 +340,75 @@ void ChatService::Stub::async::LeaderElection(::grpc::ClientContext* context, co
   return result;
 }
 
-::grpc::ClientWriter< ::chatservice::Operation>* ChatService::Stub::AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
-  return ::grpc::internal::ClientWriterFactory< ::chatservice::Operation>::Create(channel_.get(), rpcmethod_AddToPending_, context, response);
+::grpc::ClientWriter< ::chatservice::LogBlock>* ChatService::Stub::AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
+  return ::grpc::internal::ClientWriterFactory< ::chatservice::LogBlock>::Create(channel_.get(), rpcmethod_AddToPending_, context, response);
+}
+
+void ChatService::Stub::async::AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::LogBlock>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::chatservice::LogBlock>::Create(stub_->channel_.get(), stub_->rpcmethod_AddToPending_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::chatservice::LogBlock>* ChatService::Stub::AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::LogBlock>::Create(channel_.get(), cq, rpcmethod_AddToPending_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::chatservice::LogBlock>* ChatService::Stub::PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::LogBlock>::Create(channel_.get(), cq, rpcmethod_AddToPending_, context, response, false, nullptr);
+}
+
+::grpc::ClientReader< ::chatservice::LogEntry>* ChatService::Stub::RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::chatservice::LogEntry>::Create(channel_.get(), rpcmethod_RequestPendingLog_, context, request);
 }
 
-void ChatService::Stub::async::AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::Operation>* reactor) {
-  ::grpc::internal::ClientCallbackWriterFactory< ::chatservice::Operation>::Create(stub_->channel_.get(), stub_->rpcmethod_AddToPending_, context, response, reactor);
+void ChatService::Stub::async::RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::LogEntry>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::chatservice::LogEntry>::Create(stub_->channel_.get(), stub_->rpcmethod_RequestPendingLog_, context, request, reactor);
 }
 
-::grpc::ClientAsyncWriter< ::chatservice::Operation>* ChatService::Stub::AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::Operation>::Create(channel_.get(), cq, rpcmethod_AddToPending_, context, response, true, tag);
+::grpc::ClientAsyncReader< ::chatservice::LogEntry>* ChatService::Stub::AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chatservice::LogEntry>::Create(channel_.get(), cq, rpcmethod_RequestPendingLog_, context, request, true, tag);
 }
 
-::grpc::ClientAsyncWriter< ::chatservice::Operation>* ChatService::Stub::PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::Operation>::Create(channel_.get(), cq, rpcmethod_AddToPending_, context, response, false, nullptr);
+::grpc::ClientAsyncReader< ::chatservice::LogEntry>* ChatService::Stub::PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chatservice::LogEntry>::Create(channel_.get(), cq, rpcmethod_RequestPendingLog_, context, request, false, nullptr);
 }
 
-::grpc::ClientReader< ::chatservice::Operation>* ChatService::Stub::RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
-  return ::grpc::internal::ClientReaderFactory< ::chatservice::Operation>::Create(channel_.get(), rpcmethod_RequestPendingLog_, context, request);
+::grpc::ClientWriter< ::chatservice::SnapshotChunk>* ChatService::Stub::InstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response) {
+  return ::grpc::internal::ClientWriterFactory< ::chatservice::SnapshotChunk>::Create(channel_.get(), rpcmethod_InstallSnapshot_, context, response);
 }
 
-void ChatService::Stub::async::RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::Operation>* reactor) {
-  ::grpc::internal::ClientCallbackReaderFactory< ::chatservice::Operation>::Create(stub_->channel_.get(), stub_->rpcmethod_RequestPendingLog_, context, request, reactor);
+void ChatService::Stub::async::InstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::ClientWriteReactor< ::chatservice::SnapshotChunk>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::chatservice::SnapshotChunk>::Create(stub_->channel_.get(), stub_->rpcmethod_InstallSnapshot_, context, response, reactor);
 }
 
-::grpc::ClientAsyncReader< ::chatservice::Operation>* ChatService::Stub::AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::chatservice::Operation>::Create(channel_.get(), cq, rpcmethod_RequestPendingLog_, context, request, true, tag);
+::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>* ChatService::Stub::AsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::SnapshotChunk>::Create(channel_.get(), cq, rpcmethod_InstallSnapshot_, context, response, true, tag);
 }
 
-::grpc::ClientAsyncReader< ::chatservice::Operation>* ChatService::Stub::PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::chatservice::Operation>::Create(channel_.get(), cq, rpcmethod_RequestPendingLog_, context, request, false, nullptr);
+::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>* ChatService::Stub::PrepareAsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::chatservice::SnapshotChunk>::Create(channel_.get(), cq, rpcmethod_InstallSnapshot_, context, response, false, nullptr);
+}
+
+::grpc::Status ChatService::Stub::RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::chatservice::LogPosition* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chatservice::LogPositionRequest, ::chatservice::LogPosition, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RequestLogPosition_, context, request, response);
+}
+
+void ChatService::Stub::async::RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chatservice::LogPositionRequest, ::chatservice::LogPosition, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RequestLogPosition_, context, request, response, std::move(f));
+}
+
+void ChatService::Stub::async::RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RequestLogPosition_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>* ChatService::Stub::PrepareAsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chatservice::LogPosition, ::chatservice::LogPositionRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RequestLogPosition_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>* ChatService::Stub::AsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRequestLogPositionRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status ChatService::Stub::MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::chatservice::MessagesSeenReply* response) {
@@ -491,13 +527,13 @@ ChatService::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[9],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chatservice::CommitRequest, ::chatservice::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< ChatService::Service, ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>(
           [](ChatService::Service* service,
              ::grpc::ServerContext* ctx,
-             const ::chatservice::CommitRequest* req,
-             ::chatservice::CommitResponse* resp) {
-               return service->Commit(ctx, req, resp);
+             ::grpc::ServerReaderWriter<::chatservice::ReplicateAck,
+             ::chatservice::ReplicateRequest>* stream) {
+               return service->Replicate(ctx, stream);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[10],
@@ -532,25 +568,45 @@ ChatService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[13],
       ::grpc::internal::RpcMethod::CLIENT_STREAMING,
-      new ::grpc::internal::ClientStreamingHandler< ChatService::Service, ::chatservice::Operation, ::chatservice::AddToPendingResponse>(
+      new ::grpc::internal::ClientStreamingHandler< ChatService::Service, ::chatservice::LogBlock, ::chatservice::AddToPendingResponse>(
           [](ChatService::Service* service,
              ::grpc::ServerContext* ctx,
-             ::grpc::ServerReader<::chatservice::Operation>* reader,
+             ::grpc::ServerReader<::chatservice::LogBlock>* reader,
              ::chatservice::AddToPendingResponse* resp) {
                return service->AddToPending(ctx, reader, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[14],
       ::grpc::internal::RpcMethod::SERVER_STREAMING,
-      new ::grpc::internal::ServerStreamingHandler< ChatService::Service, ::chatservice::PendingLogRequest, ::chatservice::Operation>(
+      new ::grpc::internal::ServerStreamingHandler< ChatService::Service, ::chatservice::PendingLogRequest, ::chatservice::LogEntry>(
           [](ChatService::Service* service,
              ::grpc::ServerContext* ctx,
              const ::chatservice::PendingLogRequest* req,
-             ::grpc::ServerWriter<::chatservice::Operation>* writer) {
+             ::grpc::ServerWriter<::chatservice::LogEntry>* writer) {
                return service->RequestPendingLog(ctx, req, writer);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[15],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< ChatService::Service, ::chatservice::SnapshotChunk, ::chatservice::InstallSnapshotResponse>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::chatservice::SnapshotChunk>* reader,
+             ::chatservice::InstallSnapshotResponse* resp) {
+               return service->InstallSnapshot(ctx, reader, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[16],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chatservice::LogPositionRequest, ::chatservice::LogPosition, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chatservice::LogPositionRequest* req,
+             ::chatservice::LogPosition* resp) {
+               return service->RequestLogPosition(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[17],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< ChatService::Service, ::chatservice::MessagesSeenMessage, ::chatservice::MessagesSeenReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](ChatService::Service* service,
@@ -627,10 +683,9 @@ ChatService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-::grpc::Status ChatService::Service::Commit(::grpc::ServerContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response) {
+::grpc::Status ChatService::Service::Replicate(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* stream) {
   (void) context;
-  (void) request;
-  (void) response;
+  (void) stream;
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
@@ -655,20 +710,34 @@ ChatService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-::grpc::Status ChatService::Service::AddToPending(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::Operation>* reader, ::chatservice::AddToPendingResponse* response) {
+::grpc::Status ChatService::Service::AddToPending(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::LogBlock>* reader, ::chatservice::AddToPendingResponse* response) {
   (void) context;
   (void) reader;
   (void) response;
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-::grpc::Status ChatService::Service::RequestPendingLog(::grpc::ServerContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ServerWriter< ::chatservice::Operation>* writer) {
+::grpc::Status ChatService::Service::RequestPendingLog(::grpc::ServerContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ServerWriter< ::chatservice::LogEntry>* writer) {
   (void) context;
   (void) request;
   (void) writer;
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ChatService::Service::InstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* reader, ::chatservice::InstallSnapshotResponse* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ChatService::Service::RequestLogPosition(::grpc::ServerContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status ChatService::Service::MessagesSeen(::grpc::ServerContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response) {
   (void) context;
   (void) request;
@@ -104,12 +104,14 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::RefreshResponse>> PrepareAsyncRefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::RefreshResponse>>(PrepareAsyncRefreshClientRaw(context, request, cq));
     }
-    virtual ::grpc::Status Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::chatservice::CommitResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>> AsyncCommit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>>(AsyncCommitRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> Replicate(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(ReplicateRaw(context));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>> PrepareAsyncCommit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>>(PrepareAsyncCommitRaw(context, request, cq));
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> AsyncReplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(AsyncReplicateRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> PrepareAsyncReplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(PrepareAsyncReplicateRaw(context, cq));
     }
     virtual ::grpc::Status HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::chatservice::HeartBeatResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::HeartBeatResponse>> AsyncHeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) {
@@ -132,23 +134,39 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionResponse>> PrepareAsyncLeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionResponse>>(PrepareAsyncLeaderElectionRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::Operation>> AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
-      return std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::Operation>>(AddToPendingRaw(context, response));
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::LogBlock>> AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::LogBlock>>(AddToPendingRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>> AsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>>(AsyncAddToPendingRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>> PrepareAsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>>(PrepareAsyncAddToPendingRaw(context, response, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::chatservice::LogEntry>> RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::chatservice::LogEntry>>(RequestPendingLogRaw(context, request));
     }
-    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>> AsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>>(AsyncAddToPendingRaw(context, response, cq, tag));
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>> AsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>>(AsyncRequestPendingLogRaw(context, request, cq, tag));
     }
-    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>> PrepareAsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>>(PrepareAsyncAddToPendingRaw(context, response, cq));
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>> PrepareAsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>>(PrepareAsyncRequestPendingLogRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientReaderInterface< ::chatservice::Operation>> RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReaderInterface< ::chatservice::Operation>>(RequestPendingLogRaw(context, request));
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::SnapshotChunk>> InstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::chatservice::SnapshotChunk>>(InstallSnapshotRaw(context, response));
     }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>> AsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>>(AsyncRequestPendingLogRaw(context, request, cq, tag));
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>> AsyncInstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>>(AsyncInstallSnapshotRaw(context, response, cq, tag));
     }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>> PrepareAsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>>(PrepareAsyncRequestPendingLogRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>> PrepareAsyncInstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>>(PrepareAsyncInstallSnapshotRaw(context, response, cq));
+    }
+    virtual ::grpc::Status RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::chatservice::LogPosition* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>> AsyncRequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>>(AsyncRequestLogPositionRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>> PrepareAsyncRequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>>(PrepareAsyncRequestLogPositionRaw(context, request, cq));
     }
     // May not need this anymore?
     virtual ::grpc::Status MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::chatservice::MessagesSeenReply* response) = 0;
@@ -176,16 +194,18 @@ class ChatService final {
       virtual void DeleteAccount(::grpc::ClientContext* context, const ::chatservice::DeleteAccountMessage* request, ::chatservice::DeleteAccountReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void RefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest* request, ::chatservice::RefreshResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void RefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest* request, ::chatservice::RefreshResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chatservice::ReplicateRequest,::chatservice::ReplicateAck>* reactor) = 0;
       virtual void HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest* request, ::chatservice::HeartBeatResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest* request, ::chatservice::HeartBeatResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SuggestLeaderElection(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal* request, ::chatservice::LeaderElectionProposalResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SuggestLeaderElection(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal* request, ::chatservice::LeaderElectionProposalResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void LeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue* request, ::chatservice::LeaderElectionResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void LeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue* request, ::chatservice::LeaderElectionResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::Operation>* reactor) = 0;
-      virtual void RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::Operation>* reactor) = 0;
+      virtual void AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::LogBlock>* reactor) = 0;
+      virtual void RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::LogEntry>* reactor) = 0;
+      virtual void InstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::ClientWriteReactor< ::chatservice::SnapshotChunk>* reactor) = 0;
+      virtual void RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // May not need this anymore?
       virtual void MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -215,20 +235,26 @@ class ChatService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::DeleteAccountReply>* PrepareAsyncDeleteAccountRaw(::grpc::ClientContext* context, const ::chatservice::DeleteAccountMessage& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::RefreshResponse>* AsyncRefreshClientRaw(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::RefreshResponse>* PrepareAsyncRefreshClientRaw(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>* AsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::CommitResponse>* PrepareAsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* ReplicateRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* AsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* PrepareAsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::HeartBeatResponse>* AsyncHeartBeatRaw(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::HeartBeatResponse>* PrepareAsyncHeartBeatRaw(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionProposalResponse>* AsyncSuggestLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionProposalResponse>* PrepareAsyncSuggestLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionResponse>* AsyncLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LeaderElectionResponse>* PrepareAsyncLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientWriterInterface< ::chatservice::Operation>* AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) = 0;
-    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>* AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::Operation>* PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientReaderInterface< ::chatservice::Operation>* RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>* AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::chatservice::Operation>* PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::chatservice::LogBlock>* AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>* AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::LogBlock>* PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::chatservice::LogEntry>* RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>* AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chatservice::LogEntry>* PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::chatservice::SnapshotChunk>* InstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>* AsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::chatservice::SnapshotChunk>* PrepareAsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>* AsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::LogPosition>* PrepareAsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::MessagesSeenReply>* AsyncMessagesSeenRaw(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::chatservice::MessagesSeenReply>* PrepareAsyncMessagesSeenRaw(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::grpc::CompletionQueue* cq) = 0;
   };
@@ -304,12 +330,14 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::RefreshResponse>> PrepareAsyncRefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::RefreshResponse>>(PrepareAsyncRefreshClientRaw(context, request, cq));
     }
-    ::grpc::Status Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::chatservice::CommitResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>> AsyncCommit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>>(AsyncCommitRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> Replicate(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(ReplicateRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> AsyncReplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(AsyncReplicateRaw(context, cq, tag));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>> PrepareAsyncCommit(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>>(PrepareAsyncCommitRaw(context, request, cq));
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>> PrepareAsyncReplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>>(PrepareAsyncReplicateRaw(context, cq));
     }
     ::grpc::Status HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::chatservice::HeartBeatResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::HeartBeatResponse>> AsyncHeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) {
@@ -332,23 +360,39 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionResponse>> PrepareAsyncLeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionResponse>>(PrepareAsyncLeaderElectionRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientWriter< ::chatservice::Operation>> AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
-      return std::unique_ptr< ::grpc::ClientWriter< ::chatservice::Operation>>(AddToPendingRaw(context, response));
+    std::unique_ptr< ::grpc::ClientWriter< ::chatservice::LogBlock>> AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::chatservice::LogBlock>>(AddToPendingRaw(context, response));
     }
-    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::Operation>> AsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::Operation>>(AsyncAddToPendingRaw(context, response, cq, tag));
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>> AsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>>(AsyncAddToPendingRaw(context, response, cq, tag));
     }
-    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::Operation>> PrepareAsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::Operation>>(PrepareAsyncAddToPendingRaw(context, response, cq));
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>> PrepareAsyncAddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>>(PrepareAsyncAddToPendingRaw(context, response, cq));
     }
-    std::unique_ptr< ::grpc::ClientReader< ::chatservice::Operation>> RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReader< ::chatservice::Operation>>(RequestPendingLogRaw(context, request));
+    std::unique_ptr< ::grpc::ClientReader< ::chatservice::LogEntry>> RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::chatservice::LogEntry>>(RequestPendingLogRaw(context, request));
     }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::Operation>> AsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::Operation>>(AsyncRequestPendingLogRaw(context, request, cq, tag));
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::LogEntry>> AsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::LogEntry>>(AsyncRequestPendingLogRaw(context, request, cq, tag));
     }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::Operation>> PrepareAsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::Operation>>(PrepareAsyncRequestPendingLogRaw(context, request, cq));
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::LogEntry>> PrepareAsyncRequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chatservice::LogEntry>>(PrepareAsyncRequestPendingLogRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::chatservice::SnapshotChunk>> InstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::chatservice::SnapshotChunk>>(InstallSnapshotRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>> AsyncInstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>>(AsyncInstallSnapshotRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>> PrepareAsyncInstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>>(PrepareAsyncInstallSnapshotRaw(context, response, cq));
+    }
+    ::grpc::Status RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::chatservice::LogPosition* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>> AsyncRequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>>(AsyncRequestLogPositionRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>> PrepareAsyncRequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>>(PrepareAsyncRequestLogPositionRaw(context, request, cq));
     }
     ::grpc::Status MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::chatservice::MessagesSeenReply* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chatservice::MessagesSeenReply>> AsyncMessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::grpc::CompletionQueue* cq) {
@@ -375,16 +419,18 @@ class ChatService final {
       void DeleteAccount(::grpc::ClientContext* context, const ::chatservice::DeleteAccountMessage* request, ::chatservice::DeleteAccountReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void RefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest* request, ::chatservice::RefreshResponse* response, std::function<void(::grpc::Status)>) override;
       void RefreshClient(::grpc::ClientContext* context, const ::chatservice::RefreshRequest* request, ::chatservice::RefreshResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, std::function<void(::grpc::Status)>) override;
-      void Commit(::grpc::ClientContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chatservice::ReplicateRequest,::chatservice::ReplicateAck>* reactor) override;
       void HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest* request, ::chatservice::HeartBeatResponse* response, std::function<void(::grpc::Status)>) override;
       void HeartBeat(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest* request, ::chatservice::HeartBeatResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SuggestLeaderElection(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal* request, ::chatservice::LeaderElectionProposalResponse* response, std::function<void(::grpc::Status)>) override;
       void SuggestLeaderElection(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal* request, ::chatservice::LeaderElectionProposalResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void LeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue* request, ::chatservice::LeaderElectionResponse* response, std::function<void(::grpc::Status)>) override;
       void LeaderElection(::grpc::ClientContext* context, const ::chatservice::CandidateValue* request, ::chatservice::LeaderElectionResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::Operation>* reactor) override;
-      void RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::Operation>* reactor) override;
+      void AddToPending(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::ClientWriteReactor< ::chatservice::LogBlock>* reactor) override;
+      void RequestPendingLog(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ClientReadReactor< ::chatservice::LogEntry>* reactor) override;
+      void InstallSnapshot(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::ClientWriteReactor< ::chatservice::SnapshotChunk>* reactor) override;
+      void RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, std::function<void(::grpc::Status)>) override;
+      void RequestLogPosition(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response, ::grpc::ClientUnaryReactor* reactor) override;
       void MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response, std::function<void(::grpc::Status)>) override;
       void MessagesSeen(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
@@ -419,20 +465,26 @@ class ChatService final {
     ::grpc::ClientAsyncResponseReader< ::chatservice::DeleteAccountReply>* PrepareAsyncDeleteAccountRaw(::grpc::ClientContext* context, const ::chatservice::DeleteAccountMessage& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::RefreshResponse>* AsyncRefreshClientRaw(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::RefreshResponse>* PrepareAsyncRefreshClientRaw(::grpc::ClientContext* context, const ::chatservice::RefreshRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>* AsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::chatservice::CommitResponse>* PrepareAsyncCommitRaw(::grpc::ClientContext* context, const ::chatservice::CommitRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* ReplicateRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* AsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* PrepareAsyncReplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::HeartBeatResponse>* AsyncHeartBeatRaw(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::HeartBeatResponse>* PrepareAsyncHeartBeatRaw(::grpc::ClientContext* context, const ::chatservice::HeartBeatRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionProposalResponse>* AsyncSuggestLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionProposalResponse>* PrepareAsyncSuggestLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::LeaderElectionProposal& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionResponse>* AsyncLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::LeaderElectionResponse>* PrepareAsyncLeaderElectionRaw(::grpc::ClientContext* context, const ::chatservice::CandidateValue& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientWriter< ::chatservice::Operation>* AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) override;
-    ::grpc::ClientAsyncWriter< ::chatservice::Operation>* AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncWriter< ::chatservice::Operation>* PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientReader< ::chatservice::Operation>* RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) override;
-    ::grpc::ClientAsyncReader< ::chatservice::Operation>* AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncReader< ::chatservice::Operation>* PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::chatservice::LogBlock>* AddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response) override;
+    ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>* AsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::chatservice::LogBlock>* PrepareAsyncAddToPendingRaw(::grpc::ClientContext* context, ::chatservice::AddToPendingResponse* response, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::chatservice::LogEntry>* RequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request) override;
+    ::grpc::ClientAsyncReader< ::chatservice::LogEntry>* AsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::chatservice::LogEntry>* PrepareAsyncRequestPendingLogRaw(::grpc::ClientContext* context, const ::chatservice::PendingLogRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::chatservice::SnapshotChunk>* InstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response) override;
+    ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>* AsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::chatservice::SnapshotChunk>* PrepareAsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::chatservice::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>* AsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chatservice::LogPosition>* PrepareAsyncRequestLogPositionRaw(::grpc::ClientContext* context, const ::chatservice::LogPositionRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::MessagesSeenReply>* AsyncMessagesSeenRaw(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::chatservice::MessagesSeenReply>* PrepareAsyncMessagesSeenRaw(::grpc::ClientContext* context, const ::chatservice::MessagesSeenMessage& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_CreateAccount_;
@@ -444,12 +496,14 @@ class ChatService final {
     const ::grpc::internal::RpcMethod rpcmethod_QueryMessages_;
     const ::grpc::internal::RpcMethod rpcmethod_DeleteAccount_;
     const ::grpc::internal::RpcMethod rpcmethod_RefreshClient_;
-    const ::grpc::internal::RpcMethod rpcmethod_Commit_;
+    const ::grpc::internal::RpcMethod rpcmethod_Replicate_;
     const ::grpc::internal::RpcMethod rpcmethod_HeartBeat_;
     const ::grpc::internal::RpcMethod rpcmethod_SuggestLeaderElection_;
     const ::grpc::internal::RpcMethod rpcmethod_LeaderElection_;
     const ::grpc::internal::RpcMethod rpcmethod_AddToPending_;
     const ::grpc::internal::RpcMethod rpcmethod_RequestPendingLog_;
+    const ::grpc::internal::RpcMethod rpcmethod_InstallSnapshot_;
+    const ::grpc::internal::RpcMethod rpcmethod_RequestLogPosition_;
     const ::grpc::internal::RpcMethod rpcmethod_MessagesSeen_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
@@ -467,12 +521,14 @@ class ChatService final {
     virtual ::grpc::Status QueryMessages(::grpc::ServerContext* context, const ::chatservice::QueryMessagesMessage* request, ::grpc::ServerWriter< ::chatservice::ChatMessage>* writer);
     virtual ::grpc::Status DeleteAccount(::grpc::ServerContext* context, const ::chatservice::DeleteAccountMessage* request, ::chatservice::DeleteAccountReply* response);
     virtual ::grpc::Status RefreshClient(::grpc::ServerContext* context, const ::chatservice::RefreshRequest* request, ::chatservice::RefreshResponse* response);
-    virtual ::grpc::Status Commit(::grpc::ServerContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response);
+    virtual ::grpc::Status Replicate(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* stream);
     virtual ::grpc::Status HeartBeat(::grpc::ServerContext* context, const ::chatservice::HeartBeatRequest* request, ::chatservice::HeartBeatResponse* response);
     virtual ::grpc::Status SuggestLeaderElection(::grpc::ServerContext* context, const ::chatservice::LeaderElectionProposal* request, ::chatservice::LeaderElectionProposalResponse* response);
     virtual ::grpc::Status LeaderElection(::grpc::ServerContext* context, const ::chatservice::CandidateValue* request, ::chatservice::LeaderElectionResponse* response);
-    virtual ::grpc::Status AddToPending(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::Operation>* reader, ::chatservice::AddToPendingResponse* response);
-    virtual ::grpc::Status RequestPendingLog(::grpc::ServerContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ServerWriter< ::chatservice::Operation>* writer);
+    virtual ::grpc::Status AddToPending(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::LogBlock>* reader, ::chatservice::AddToPendingResponse* response);
+    virtual ::grpc::Status RequestPendingLog(::grpc::ServerContext* context, const ::chatservice::PendingLogRequest* request, ::grpc::ServerWriter< ::chatservice::LogEntry>* writer);
+    virtual ::grpc::Status InstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* reader, ::chatservice::InstallSnapshotResponse* response);
+    virtual ::grpc::Status RequestLogPosition(::grpc::ServerContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response);
     // May not need this anymore?
     virtual ::grpc::Status MessagesSeen(::grpc::ServerContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response);
   };
@@ -657,23 +713,23 @@ class ChatService final {
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_Commit : public BaseClass {
+  class WithAsyncMethod_Replicate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_Commit() {
+    WithAsyncMethod_Replicate() {
       ::grpc::Service::MarkMethodAsync(9);
     }
-    ~WithAsyncMethod_Commit() override {
+    ~WithAsyncMethod_Replicate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
+    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* /*stream*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCommit(::grpc::ServerContext* context, ::chatservice::CommitRequest* request, ::grpc::ServerAsyncResponseWriter< ::chatservice::CommitResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestReplicate(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(9, context, stream, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -748,11 +804,11 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::Operation>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
+    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::LogBlock>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestAddToPending(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::chatservice::AddToPendingResponse, ::chatservice::Operation>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestAddToPending(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::chatservice::AddToPendingResponse, ::chatservice::LogBlock>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncClientStreaming(13, context, reader, new_call_cq, notification_cq, tag);
     }
   };
@@ -768,21 +824,61 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestRequestPendingLog(::grpc::ServerContext* context, ::chatservice::PendingLogRequest* request, ::grpc::ServerAsyncWriter< ::chatservice::Operation>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestRequestPendingLog(::grpc::ServerContext* context, ::chatservice::PendingLogRequest* request, ::grpc::ServerAsyncWriter< ::chatservice::LogEntry>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncServerStreaming(14, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_InstallSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_InstallSnapshot() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_InstallSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* /*reader*/, ::chatservice::InstallSnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::chatservice::InstallSnapshotResponse, ::chatservice::SnapshotChunk>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(15, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRequestLogPosition(::grpc::ServerContext* context, ::chatservice::LogPositionRequest* request, ::grpc::ServerAsyncResponseWriter< ::chatservice::LogPosition>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_MessagesSeen : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodAsync(15);
+      ::grpc::Service::MarkMethodAsync(17);
     }
     ~WithAsyncMethod_MessagesSeen() override {
       BaseClassMustBeDerivedFromService(this);
@@ -793,10 +889,10 @@ class ChatService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestMessagesSeen(::grpc::ServerContext* context, ::chatservice::MessagesSeenMessage* request, ::grpc::ServerAsyncResponseWriter< ::chatservice::MessagesSeenReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_CreateAccount<WithAsyncMethod_Login<WithAsyncMethod_Logout<WithAsyncMethod_ListUsers<WithAsyncMethod_SendMessage<WithAsyncMethod_QueryNotifications<WithAsyncMethod_QueryMessages<WithAsyncMethod_DeleteAccount<WithAsyncMethod_RefreshClient<WithAsyncMethod_Commit<WithAsyncMethod_HeartBeat<WithAsyncMethod_SuggestLeaderElection<WithAsyncMethod_LeaderElection<WithAsyncMethod_AddToPending<WithAsyncMethod_RequestPendingLog<WithAsyncMethod_MessagesSeen<Service > > > > > > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_CreateAccount<WithAsyncMethod_Login<WithAsyncMethod_Logout<WithAsyncMethod_ListUsers<WithAsyncMethod_SendMessage<WithAsyncMethod_QueryNotifications<WithAsyncMethod_QueryMessages<WithAsyncMethod_DeleteAccount<WithAsyncMethod_RefreshClient<WithAsyncMethod_Replicate<WithAsyncMethod_HeartBeat<WithAsyncMethod_SuggestLeaderElection<WithAsyncMethod_LeaderElection<WithAsyncMethod_AddToPending<WithAsyncMethod_RequestPendingLog<WithAsyncMethod_InstallSnapshot<WithAsyncMethod_RequestLogPosition<WithAsyncMethod_MessagesSeen<Service > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_CreateAccount : public BaseClass {
    private:
@@ -1026,31 +1122,27 @@ class ChatService final {
       ::grpc::CallbackServerContext* /*context*/, const ::chatservice::RefreshRequest* /*request*/, ::chatservice::RefreshResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_Commit : public BaseClass {
+  class WithCallbackMethod_Replicate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_Commit() {
+    WithCallbackMethod_Replicate() {
       ::grpc::Service::MarkMethodCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::chatservice::CommitRequest, ::chatservice::CommitResponse>(
+          new ::grpc::internal::CallbackBidiHandler< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::chatservice::CommitRequest* request, ::chatservice::CommitResponse* response) { return this->Commit(context, request, response); }));}
-    void SetMessageAllocatorFor_Commit(
-        ::grpc::MessageAllocator< ::chatservice::CommitRequest, ::chatservice::CommitResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::chatservice::CommitRequest, ::chatservice::CommitResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+                   ::grpc::CallbackServerContext* context) { return this->Replicate(context); }));
     }
-    ~WithCallbackMethod_Commit() override {
+    ~WithCallbackMethod_Replicate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
+    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* /*stream*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* Commit(
-      ::grpc::CallbackServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerBidiReactor< ::chatservice::ReplicateRequest, ::chatservice::ReplicateAck>* Replicate(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
   class WithCallbackMethod_HeartBeat : public BaseClass {
@@ -1140,7 +1232,7 @@ class ChatService final {
    public:
     WithCallbackMethod_AddToPending() {
       ::grpc::Service::MarkMethodCallback(13,
-          new ::grpc::internal::CallbackClientStreamingHandler< ::chatservice::Operation, ::chatservice::AddToPendingResponse>(
+          new ::grpc::internal::CallbackClientStreamingHandler< ::chatservice::LogBlock, ::chatservice::AddToPendingResponse>(
             [this](
                    ::grpc::CallbackServerContext* context, ::chatservice::AddToPendingResponse* response) { return this->AddToPending(context, response); }));
     }
@@ -1148,11 +1240,11 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::Operation>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
+    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::LogBlock>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerReadReactor< ::chatservice::Operation>* AddToPending(
+    virtual ::grpc::ServerReadReactor< ::chatservice::LogBlock>* AddToPending(
       ::grpc::CallbackServerContext* /*context*/, ::chatservice::AddToPendingResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
@@ -1162,7 +1254,7 @@ class ChatService final {
    public:
     WithCallbackMethod_RequestPendingLog() {
       ::grpc::Service::MarkMethodCallback(14,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::chatservice::PendingLogRequest, ::chatservice::Operation>(
+          new ::grpc::internal::CallbackServerStreamingHandler< ::chatservice::PendingLogRequest, ::chatservice::LogEntry>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::chatservice::PendingLogRequest* request) { return this->RequestPendingLog(context, request); }));
     }
@@ -1170,26 +1262,75 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerWriteReactor< ::chatservice::Operation>* RequestPendingLog(
+    virtual ::grpc::ServerWriteReactor< ::chatservice::LogEntry>* RequestPendingLog(
       ::grpc::CallbackServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_InstallSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_InstallSnapshot() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::chatservice::SnapshotChunk, ::chatservice::InstallSnapshotResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::chatservice::InstallSnapshotResponse* response) { return this->InstallSnapshot(context, response); }));
+    }
+    ~WithCallbackMethod_InstallSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* /*reader*/, ::chatservice::InstallSnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::chatservice::SnapshotChunk>* InstallSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, ::chatservice::InstallSnapshotResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::chatservice::LogPositionRequest, ::chatservice::LogPosition>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chatservice::LogPositionRequest* request, ::chatservice::LogPosition* response) { return this->RequestLogPosition(context, request, response); }));}
+    void SetMessageAllocatorFor_RequestLogPosition(
+        ::grpc::MessageAllocator< ::chatservice::LogPositionRequest, ::chatservice::LogPosition>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chatservice::LogPositionRequest, ::chatservice::LogPosition>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RequestLogPosition(
+      ::grpc::CallbackServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_MessagesSeen : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodCallback(15,
+      ::grpc::Service::MarkMethodCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::chatservice::MessagesSeenMessage, ::chatservice::MessagesSeenReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::chatservice::MessagesSeenMessage* request, ::chatservice::MessagesSeenReply* response) { return this->MessagesSeen(context, request, response); }));}
     void SetMessageAllocatorFor_MessagesSeen(
         ::grpc::MessageAllocator< ::chatservice::MessagesSeenMessage, ::chatservice::MessagesSeenReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::chatservice::MessagesSeenMessage, ::chatservice::MessagesSeenReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -1204,7 +1345,7 @@ class ChatService final {
     virtual ::grpc::ServerUnaryReactor* MessagesSeen(
       ::grpc::CallbackServerContext* /*context*/, const ::chatservice::MessagesSeenMessage* /*request*/, ::chatservice::MessagesSeenReply* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_CreateAccount<WithCallbackMethod_Login<WithCallbackMethod_Logout<WithCallbackMethod_ListUsers<WithCallbackMethod_SendMessage<WithCallbackMethod_QueryNotifications<WithCallbackMethod_QueryMessages<WithCallbackMethod_DeleteAccount<WithCallbackMethod_RefreshClient<WithCallbackMethod_Commit<WithCallbackMethod_HeartBeat<WithCallbackMethod_SuggestLeaderElection<WithCallbackMethod_LeaderElection<WithCallbackMethod_AddToPending<WithCallbackMethod_RequestPendingLog<WithCallbackMethod_MessagesSeen<Service > > > > > > > > > > > > > > > > CallbackService;
+  typedef WithCallbackMethod_CreateAccount<WithCallbackMethod_Login<WithCallbackMethod_Logout<WithCallbackMethod_ListUsers<WithCallbackMethod_SendMessage<WithCallbackMethod_QueryNotifications<WithCallbackMethod_QueryMessages<WithCallbackMethod_DeleteAccount<WithCallbackMethod_RefreshClient<WithCallbackMethod_Replicate<WithCallbackMethod_HeartBeat<WithCallbackMethod_SuggestLeaderElection<WithCallbackMethod_LeaderElection<WithCallbackMethod_AddToPending<WithCallbackMethod_RequestPendingLog<WithCallbackMethod_InstallSnapshot<WithCallbackMethod_RequestLogPosition<WithCallbackMethod_MessagesSeen<Service > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_CreateAccount : public BaseClass {
@@ -1360,18 +1501,18 @@ class ChatService final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_Commit : public BaseClass {
+  class WithGenericMethod_Replicate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_Commit() {
+    WithGenericMethod_Replicate() {
       ::grpc::Service::MarkMethodGeneric(9);
     }
-    ~WithGenericMethod_Commit() override {
+    ~WithGenericMethod_Replicate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
+    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* /*stream*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1439,7 +1580,7 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::Operation>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
+    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::LogBlock>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1456,7 +1597,41 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_InstallSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_InstallSnapshot() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_InstallSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* /*reader*/, ::chatservice::InstallSnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1467,7 +1642,7 @@ class ChatService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodGeneric(15);
+      ::grpc::Service::MarkMethodGeneric(17);
     }
     ~WithGenericMethod_MessagesSeen() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1659,23 +1834,23 @@ class ChatService final {
     }
   };
   template <class BaseClass>
-  class WithRawMethod_Commit : public BaseClass {
+  class WithRawMethod_Replicate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_Commit() {
+    WithRawMethod_Replicate() {
       ::grpc::Service::MarkMethodRaw(9);
     }
-    ~WithRawMethod_Commit() override {
+    ~WithRawMethod_Replicate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
+    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* /*stream*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCommit(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    void RequestReplicate(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(9, context, stream, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1750,7 +1925,7 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::Operation>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
+    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::LogBlock>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1770,7 +1945,7 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -1779,12 +1954,52 @@ class ChatService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_InstallSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_InstallSnapshot() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_InstallSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* /*reader*/, ::chatservice::InstallSnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(15, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
+    ~WithRawMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRequestLogPosition(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_MessagesSeen : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodRaw(15);
+      ::grpc::Service::MarkMethodRaw(17);
     }
     ~WithRawMethod_MessagesSeen() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1795,7 +2010,7 @@ class ChatService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestMessagesSeen(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1997,26 +2212,27 @@ class ChatService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_Commit : public BaseClass {
+  class WithRawCallbackMethod_Replicate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_Commit() {
+    WithRawCallbackMethod_Replicate() {
       ::grpc::Service::MarkMethodRawCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Commit(context, request, response); }));
+                   ::grpc::CallbackServerContext* context) { return this->Replicate(context); }));
     }
-    ~WithRawCallbackMethod_Commit() override {
+    ~WithRawCallbackMethod_Replicate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
+    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chatservice::ReplicateAck, ::chatservice::ReplicateRequest>* /*stream*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* Commit(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* Replicate(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
   class WithRawCallbackMethod_HeartBeat : public BaseClass {
@@ -2099,7 +2315,7 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::Operation>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
+    ::grpc::Status AddToPending(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::LogBlock>* /*reader*/, ::chatservice::AddToPendingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -2121,7 +2337,7 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -2129,12 +2345,56 @@ class ChatService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_InstallSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_InstallSnapshot() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->InstallSnapshot(context, response); }));
+    }
+    ~WithRawCallbackMethod_InstallSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::chatservice::SnapshotChunk>* /*reader*/, ::chatservice::InstallSnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* InstallSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RequestLogPosition(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RequestLogPosition(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_MessagesSeen : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodRawCallback(15,
+      ::grpc::Service::MarkMethodRawCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->MessagesSeen(context, request, response); }));
@@ -2313,33 +2573,6 @@ class ChatService final {
     virtual ::grpc::Status StreamedRefreshClient(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chatservice::RefreshRequest,::chatservice::RefreshResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_Commit : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Commit() {
-      ::grpc::Service::MarkMethodStreamed(9,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::chatservice::CommitRequest, ::chatservice::CommitResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::chatservice::CommitRequest, ::chatservice::CommitResponse>* streamer) {
-                       return this->StreamedCommit(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Commit() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Commit(::grpc::ServerContext* /*context*/, const ::chatservice::CommitRequest* /*request*/, ::chatservice::CommitResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCommit(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chatservice::CommitRequest,::chatservice::CommitResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
   class WithStreamedUnaryMethod_HeartBeat : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2421,12 +2654,39 @@ class ChatService final {
     virtual ::grpc::Status StreamedLeaderElection(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chatservice::CandidateValue,::chatservice::LeaderElectionResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_RequestLogPosition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_RequestLogPosition() {
+      ::grpc::Service::MarkMethodStreamed(16,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chatservice::LogPositionRequest, ::chatservice::LogPosition>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chatservice::LogPositionRequest, ::chatservice::LogPosition>* streamer) {
+                       return this->StreamedRequestLogPosition(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_RequestLogPosition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RequestLogPosition(::grpc::ServerContext* /*context*/, const ::chatservice::LogPositionRequest* /*request*/, ::chatservice::LogPosition* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRequestLogPosition(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chatservice::LogPositionRequest,::chatservice::LogPosition>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_MessagesSeen : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_MessagesSeen() {
-      ::grpc::Service::MarkMethodStreamed(15,
+      ::grpc::Service::MarkMethodStreamed(17,
         new ::grpc::internal::StreamedUnaryHandler<
           ::chatservice::MessagesSeenMessage, ::chatservice::MessagesSeenReply>(
             [this](::grpc::ServerContext* context,
@@ -2447,7 +2707,7 @@ class ChatService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedMessagesSeen(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chatservice::MessagesSeenMessage,::chatservice::MessagesSeenReply>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_CreateAccount<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_Logout<WithStreamedUnaryMethod_SendMessage<WithStreamedUnaryMethod_DeleteAccount<WithStreamedUnaryMethod_RefreshClient<WithStreamedUnaryMethod_Commit<WithStreamedUnaryMethod_HeartBeat<WithStreamedUnaryMethod_SuggestLeaderElection<WithStreamedUnaryMethod_LeaderElection<WithStreamedUnaryMethod_MessagesSeen<Service > > > > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_CreateAccount<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_Logout<WithStreamedUnaryMethod_SendMessage<WithStreamedUnaryMethod_DeleteAccount<WithStreamedUnaryMethod_RefreshClient<WithStreamedUnaryMethod_HeartBeat<WithStreamedUnaryMethod_SuggestLeaderElection<WithStreamedUnaryMethod_LeaderElection<WithStreamedUnaryMethod_RequestLogPosition<WithStreamedUnaryMethod_MessagesSeen<Service > > > > > > > > > > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_ListUsers : public BaseClass {
    private:
@@ -2537,10 +2797,10 @@ class ChatService final {
     WithSplitStreamingMethod_RequestPendingLog() {
       ::grpc::Service::MarkMethodStreamed(14,
         new ::grpc::internal::SplitServerStreamingHandler<
-          ::chatservice::PendingLogRequest, ::chatservice::Operation>(
+          ::chatservice::PendingLogRequest, ::chatservice::LogEntry>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerSplitStreamer<
-                     ::chatservice::PendingLogRequest, ::chatservice::Operation>* streamer) {
+                     ::chatservice::PendingLogRequest, ::chatservice::LogEntry>* streamer) {
                        return this->StreamedRequestPendingLog(context,
                          streamer);
                   }));
@@ -2549,15 +2809,15 @@ class ChatService final {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::Operation>* /*writer*/) override {
+    ::grpc::Status RequestPendingLog(::grpc::ServerContext* /*context*/, const ::chatservice::PendingLogRequest* /*request*/, ::grpc::ServerWriter< ::chatservice::LogEntry>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with split streamed
-    virtual ::grpc::Status StreamedRequestPendingLog(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::chatservice::PendingLogRequest,::chatservice::Operation>* server_split_streamer) = 0;
+    virtual ::grpc::Status StreamedRequestPendingLog(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::chatservice::PendingLogRequest,::chatservice::LogEntry>* server_split_streamer) = 0;
   };
   typedef WithSplitStreamingMethod_ListUsers<WithSplitStreamingMethod_QueryNotifications<WithSplitStreamingMethod_QueryMessages<WithSplitStreamingMethod_RequestPendingLog<Service > > > > SplitStreamedService;
-  typedef WithStreamedUnaryMethod_CreateAccount<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_Logout<WithSplitStreamingMethod_ListUsers<WithStreamedUnaryMethod_SendMessage<WithSplitStreamingMethod_QueryNotifications<WithSplitStreamingMethod_QueryMessages<WithStreamedUnaryMethod_DeleteAccount<WithStreamedUnaryMethod_RefreshClient<WithStreamedUnaryMethod_Commit<WithStreamedUnaryMethod_HeartBeat<WithStreamedUnaryMethod_SuggestLeaderElection<WithStreamedUnaryMethod_LeaderElection<WithSplitStreamingMethod_RequestPendingLog<WithStreamedUnaryMethod_MessagesSeen<Service > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_CreateAccount<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_Logout<WithSplitStreamingMethod_ListUsers<WithStreamedUnaryMethod_SendMessage<WithSplitStreamingMethod_QueryNotifications<WithSplitStreamingMethod_QueryMessages<WithStreamedUnaryMethod_DeleteAccount<WithStreamedUnaryMethod_RefreshClient<WithStreamedUnaryMethod_HeartBeat<WithStreamedUnaryMethod_SuggestLeaderElection<WithStreamedUnaryMethod_LeaderElection<WithSplitStreamingMethod_RequestPendingLog<WithStreamedUnaryMethod_RequestLogPosition<WithStreamedUnaryMethod_MessagesSeen<Service > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace chatservice
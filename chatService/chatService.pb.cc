@@ -123,7 +123,8 @@ PROTOBUF_CONSTEXPR QueryUsersMessage::QueryUsersMessage(
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.fromleader_)*/false} {}
+  , /*decltype(_impl_.fromleader_)*/false
+  , /*decltype(_impl_.allowstaleread_)*/false} {}
 struct QueryUsersMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR QueryUsersMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -202,8 +203,9 @@ PROTOBUF_CONSTEXPR QueryMessagesMessage::QueryMessagesMessage(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.clientusername_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.otherusername_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clockval_)*/0
   , /*decltype(_impl_.fromleader_)*/false
-  , /*decltype(_impl_.clockval_)*/0} {}
+  , /*decltype(_impl_.allowstaleread_)*/false} {}
 struct QueryMessagesMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR QueryMessagesMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -222,7 +224,8 @@ PROTOBUF_CONSTEXPR ChatMessage::ChatMessage(
   , /*decltype(_impl_.msgcontent_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.leader_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.fromleader_)*/false
-  , /*decltype(_impl_.clockval_)*/0} {}
+  , /*decltype(_impl_.clockval_)*/0
+  , /*decltype(_impl_.messageindex_)*/0} {}
 struct ChatMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ChatMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -273,7 +276,8 @@ PROTOBUF_CONSTEXPR MessagesSeenMessage::MessagesSeenMessage(
   , /*decltype(_impl_.otherusername_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.messagesseen_)*/0
   , /*decltype(_impl_.fromleader_)*/false
-  , /*decltype(_impl_.clockval_)*/0} {}
+  , /*decltype(_impl_.clockval_)*/0
+  , /*decltype(_impl_.firstmessageindex_)*/0} {}
 struct MessagesSeenMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR MessagesSeenMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -328,28 +332,6 @@ struct RefreshResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RefreshResponseDefaultTypeInternal _RefreshResponse_default_instance_;
-PROTOBUF_CONSTEXPR CommitRequest::CommitRequest(
-    ::_pbi::ConstantInitialized) {}
-struct CommitRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CommitRequestDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CommitRequestDefaultTypeInternal() {}
-  union {
-    CommitRequest _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitRequestDefaultTypeInternal _CommitRequest_default_instance_;
-PROTOBUF_CONSTEXPR CommitResponse::CommitResponse(
-    ::_pbi::ConstantInitialized) {}
-struct CommitResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CommitResponseDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CommitResponseDefaultTypeInternal() {}
-  union {
-    CommitResponse _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitResponseDefaultTypeInternal _CommitResponse_default_instance_;
 PROTOBUF_CONSTEXPR HeartBeatRequest::HeartBeatRequest(
     ::_pbi::ConstantInitialized) {}
 struct HeartBeatRequestDefaultTypeInternal {
@@ -402,7 +384,8 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR CandidateValue::CandidateValue(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.number_)*/0
+  , /*decltype(_impl_.lastindex_)*/uint64_t{0u}
+  , /*decltype(_impl_.commitindex_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct CandidateValueDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CandidateValueDefaultTypeInternal()
@@ -424,26 +407,6 @@ struct LeaderElectionResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LeaderElectionResponseDefaultTypeInternal _LeaderElectionResponse_default_instance_;
-PROTOBUF_CONSTEXPR Operation::Operation(
-    ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.message_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.username1_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.username2_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.password_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.message_content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.messagesseen_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.leader_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.clockval_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_._cached_size_)*/{}} {}
-struct OperationDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR OperationDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~OperationDefaultTypeInternal() {}
-  union {
-    Operation _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationDefaultTypeInternal _Operation_default_instance_;
 PROTOBUF_CONSTEXPR AddToPendingResponse::AddToPendingResponse(
     ::_pbi::ConstantInitialized) {}
 struct AddToPendingResponseDefaultTypeInternal {
@@ -466,8 +429,117 @@ struct PendingLogRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PendingLogRequestDefaultTypeInternal _PendingLogRequest_default_instance_;
+PROTOBUF_CONSTEXPR LogEntry::LogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogEntryDefaultTypeInternal() {}
+  union {
+    LogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+PROTOBUF_CONSTEXPR LogBlock::LogBlock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.firstindex_)*/uint64_t{0u}
+  , /*decltype(_impl_.rawlength_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogBlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogBlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogBlockDefaultTypeInternal() {}
+  union {
+    LogBlock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogBlockDefaultTypeInternal _LogBlock_default_instance_;
+PROTOBUF_CONSTEXPR ReplicateRequest::ReplicateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.commitindex_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicateRequestDefaultTypeInternal() {}
+  union {
+    ReplicateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicateRequestDefaultTypeInternal _ReplicateRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReplicateAck::ReplicateAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lastindex_)*/uint64_t{0u}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.needssnapshot_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicateAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicateAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicateAckDefaultTypeInternal() {}
+  union {
+    ReplicateAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicateAckDefaultTypeInternal _ReplicateAck_default_instance_;
+PROTOBUF_CONSTEXPR SnapshotChunk::SnapshotChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotChunkDefaultTypeInternal() {}
+  union {
+    SnapshotChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotChunkDefaultTypeInternal _SnapshotChunk_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotResponse::InstallSnapshotResponse(
+    ::_pbi::ConstantInitialized) {}
+struct InstallSnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotResponseDefaultTypeInternal() {}
+  union {
+    InstallSnapshotResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
+PROTOBUF_CONSTEXPR LogPositionRequest::LogPositionRequest(
+    ::_pbi::ConstantInitialized) {}
+struct LogPositionRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogPositionRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogPositionRequestDefaultTypeInternal() {}
+  union {
+    LogPositionRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogPositionRequestDefaultTypeInternal _LogPositionRequest_default_instance_;
+PROTOBUF_CONSTEXPR LogPosition::LogPosition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.appliedindex_)*/uint64_t{0u}
+  , /*decltype(_impl_.clockval_)*/int64_t{0}
+  , /*decltype(_impl_.hasappliedchecksum_)*/false
+  , /*decltype(_impl_.appliedchecksum_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogPositionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogPositionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogPositionDefaultTypeInternal() {}
+  union {
+    LogPosition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogPositionDefaultTypeInternal _LogPosition_default_instance_;
 }  // namespace chatservice
-static ::_pb::Metadata file_level_metadata_chatService_2eproto[30];
+static ::_pb::Metadata file_level_metadata_chatService_2eproto[35];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_chatService_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_chatService_2eproto = nullptr;
 
@@ -554,8 +626,10 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::chatservice::QueryUsersMessage, _impl_.username_),
   PROTOBUF_FIELD_OFFSET(::chatservice::QueryUsersMessage, _impl_.fromleader_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::QueryUsersMessage, _impl_.allowstaleread_),
   0,
   1,
+  2,
   PROTOBUF_FIELD_OFFSET(::chatservice::User, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::chatservice::User, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -612,10 +686,12 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::chatservice::QueryMessagesMessage, _impl_.otherusername_),
   PROTOBUF_FIELD_OFFSET(::chatservice::QueryMessagesMessage, _impl_.fromleader_),
   PROTOBUF_FIELD_OFFSET(::chatservice::QueryMessagesMessage, _impl_.clockval_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::QueryMessagesMessage, _impl_.allowstaleread_),
   ~0u,
   ~0u,
   0,
   ~0u,
+  1,
   PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -628,12 +704,14 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _impl_.leader_),
   PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _impl_.fromleader_),
   PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _impl_.clockval_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::ChatMessage, _impl_.messageindex_),
   ~0u,
   ~0u,
   ~0u,
   0,
   1,
   ~0u,
+  2,
   PROTOBUF_FIELD_OFFSET(::chatservice::DeleteAccountMessage, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::chatservice::DeleteAccountMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -671,11 +749,13 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenMessage, _impl_.messagesseen_),
   PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenMessage, _impl_.fromleader_),
   PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenMessage, _impl_.clockval_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenMessage, _impl_.firstmessageindex_),
   ~0u,
   ~0u,
   ~0u,
   0,
   ~0u,
+  1,
   PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenReply, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::chatservice::MessagesSeenReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -707,18 +787,6 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,
   0,
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::chatservice::CommitRequest, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::chatservice::CommitResponse, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chatservice::HeartBeatRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -751,8 +819,9 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::chatservice::CandidateValue, _impl_.number_),
   PROTOBUF_FIELD_OFFSET(::chatservice::CandidateValue, _impl_.address_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::CandidateValue, _impl_.lastindex_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::CandidateValue, _impl_.commitindex_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chatservice::LeaderElectionResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -760,31 +829,80 @@ const uint32_t TableStruct_chatService_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::AddToPendingResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.message_type_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.username1_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.username2_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.password_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.message_content_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.messagesseen_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.leader_),
-  PROTOBUF_FIELD_OFFSET(::chatservice::Operation, _impl_.clockval_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::chatservice::AddToPendingResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::PendingLogRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::chatservice::PendingLogRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogEntry, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogEntry, _impl_.operation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogBlock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogBlock, _impl_.firstindex_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogBlock, _impl_.rawlength_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogBlock, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateRequest, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateRequest, _impl_.commitindex_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateAck, _impl_.lastindex_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateAck, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::ReplicateAck, _impl_.needssnapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::SnapshotChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::SnapshotChunk, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::InstallSnapshotResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPositionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPosition, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPosition, _impl_.appliedindex_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPosition, _impl_.clockval_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPosition, _impl_.hasappliedchecksum_),
+  PROTOBUF_FIELD_OFFSET(::chatservice::LogPosition, _impl_.appliedchecksum_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 10, -1, sizeof(::chatservice::CreateAccountMessage)},
@@ -793,30 +911,35 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 40, 49, -1, sizeof(::chatservice::LoginReply)},
   { 52, 61, -1, sizeof(::chatservice::LogoutMessage)},
   { 64, 72, -1, sizeof(::chatservice::LogoutReply)},
-  { 74, 82, -1, sizeof(::chatservice::QueryUsersMessage)},
-  { 84, 92, -1, sizeof(::chatservice::User)},
-  { 94, 103, -1, sizeof(::chatservice::SendMessageReply)},
-  { 106, 115, -1, sizeof(::chatservice::QueryNotificationsMessage)},
-  { 118, 127, -1, sizeof(::chatservice::Notification)},
-  { 130, 140, -1, sizeof(::chatservice::QueryMessagesMessage)},
-  { 144, 156, -1, sizeof(::chatservice::ChatMessage)},
-  { 162, 172, -1, sizeof(::chatservice::DeleteAccountMessage)},
-  { 176, 185, -1, sizeof(::chatservice::DeleteAccountReply)},
-  { 188, 199, -1, sizeof(::chatservice::MessagesSeenMessage)},
-  { 204, 211, -1, sizeof(::chatservice::MessagesSeenReply)},
-  { 212, 220, -1, sizeof(::chatservice::RefreshRequest)},
-  { 222, 231, -1, sizeof(::chatservice::RefreshResponse)},
-  { 234, -1, -1, sizeof(::chatservice::CommitRequest)},
-  { 240, -1, -1, sizeof(::chatservice::CommitResponse)},
-  { 246, -1, -1, sizeof(::chatservice::HeartBeatRequest)},
-  { 252, -1, -1, sizeof(::chatservice::HeartBeatResponse)},
-  { 259, -1, -1, sizeof(::chatservice::LeaderElectionProposal)},
-  { 265, -1, -1, sizeof(::chatservice::LeaderElectionProposalResponse)},
-  { 273, -1, -1, sizeof(::chatservice::CandidateValue)},
-  { 281, -1, -1, sizeof(::chatservice::LeaderElectionResponse)},
-  { 287, -1, -1, sizeof(::chatservice::Operation)},
-  { 301, -1, -1, sizeof(::chatservice::AddToPendingResponse)},
-  { 307, -1, -1, sizeof(::chatservice::PendingLogRequest)},
+  { 74, 83, -1, sizeof(::chatservice::QueryUsersMessage)},
+  { 86, 94, -1, sizeof(::chatservice::User)},
+  { 96, 105, -1, sizeof(::chatservice::SendMessageReply)},
+  { 108, 117, -1, sizeof(::chatservice::QueryNotificationsMessage)},
+  { 120, 129, -1, sizeof(::chatservice::Notification)},
+  { 132, 143, -1, sizeof(::chatservice::QueryMessagesMessage)},
+  { 148, 161, -1, sizeof(::chatservice::ChatMessage)},
+  { 168, 178, -1, sizeof(::chatservice::DeleteAccountMessage)},
+  { 182, 191, -1, sizeof(::chatservice::DeleteAccountReply)},
+  { 194, 206, -1, sizeof(::chatservice::MessagesSeenMessage)},
+  { 212, 219, -1, sizeof(::chatservice::MessagesSeenReply)},
+  { 220, 228, -1, sizeof(::chatservice::RefreshRequest)},
+  { 230, 239, -1, sizeof(::chatservice::RefreshResponse)},
+  { 242, -1, -1, sizeof(::chatservice::HeartBeatRequest)},
+  { 248, -1, -1, sizeof(::chatservice::HeartBeatResponse)},
+  { 255, -1, -1, sizeof(::chatservice::LeaderElectionProposal)},
+  { 261, -1, -1, sizeof(::chatservice::LeaderElectionProposalResponse)},
+  { 269, -1, -1, sizeof(::chatservice::CandidateValue)},
+  { 278, -1, -1, sizeof(::chatservice::LeaderElectionResponse)},
+  { 284, -1, -1, sizeof(::chatservice::AddToPendingResponse)},
+  { 290, -1, -1, sizeof(::chatservice::PendingLogRequest)},
+  { 296, -1, -1, sizeof(::chatservice::LogEntry)},
+  { 304, -1, -1, sizeof(::chatservice::LogBlock)},
+  { 313, -1, -1, sizeof(::chatservice::ReplicateRequest)},
+  { 321, -1, -1, sizeof(::chatservice::ReplicateAck)},
+  { 330, -1, -1, sizeof(::chatservice::SnapshotChunk)},
+  { 337, -1, -1, sizeof(::chatservice::InstallSnapshotResponse)},
+  { 343, -1, -1, sizeof(::chatservice::LogPositionRequest)},
+  { 349, -1, -1, sizeof(::chatservice::LogPosition)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -839,17 +962,22 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::chatservice::_MessagesSeenReply_default_instance_._instance,
   &::chatservice::_RefreshRequest_default_instance_._instance,
   &::chatservice::_RefreshResponse_default_instance_._instance,
-  &::chatservice::_CommitRequest_default_instance_._instance,
-  &::chatservice::_CommitResponse_default_instance_._instance,
   &::chatservice::_HeartBeatRequest_default_instance_._instance,
   &::chatservice::_HeartBeatResponse_default_instance_._instance,
   &::chatservice::_LeaderElectionProposal_default_instance_._instance,
   &::chatservice::_LeaderElectionProposalResponse_default_instance_._instance,
   &::chatservice::_CandidateValue_default_instance_._instance,
   &::chatservice::_LeaderElectionResponse_default_instance_._instance,
-  &::chatservice::_Operation_default_instance_._instance,
   &::chatservice::_AddToPendingResponse_default_instance_._instance,
   &::chatservice::_PendingLogRequest_default_instance_._instance,
+  &::chatservice::_LogEntry_default_instance_._instance,
+  &::chatservice::_LogBlock_default_instance_._instance,
+  &::chatservice::_ReplicateRequest_default_instance_._instance,
+  &::chatservice::_ReplicateAck_default_instance_._instance,
+  &::chatservice::_SnapshotChunk_default_instance_._instance,
+  &::chatservice::_InstallSnapshotResponse_default_instance_._instance,
+  &::chatservice::_LogPositionRequest_default_instance_._instance,
+  &::chatservice::_LogPosition_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_chatService_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -869,92 +997,108 @@ const char descriptor_table_protodef_chatService_2eproto[] PROTOBUF_SECTION_VARI
   "\027\n\nfromLeader\030\002 \001(\010H\000\210\001\001\022\020\n\010clockVal\030\003 \001"
   "(\005B\r\n\013_fromLeader\"Q\n\013LogoutReply\022\025\n\010erro"
   "rMsg\030\002 \001(\tH\000\210\001\001\022\023\n\006leader\030\003 \001(\tH\001\210\001\001B\013\n\t"
-  "_errorMsgB\t\n\007_leader\"_\n\021QueryUsersMessag"
-  "e\022\025\n\010username\030\001 \001(\tH\000\210\001\001\022\027\n\nfromLeader\030\002"
-  " \001(\010H\001\210\001\001B\013\n\t_usernameB\r\n\013_fromLeader\"8\n"
-  "\004User\022\020\n\010username\030\001 \001(\t\022\023\n\006leader\030\002 \001(\tH"
-  "\000\210\001\001B\t\n\007_leader\"k\n\020SendMessageReply\022\023\n\013m"
-  "essageSent\030\001 \001(\010\022\025\n\010errorMsg\030\002 \001(\tH\000\210\001\001\022"
-  "\023\n\006leader\030\003 \001(\tH\001\210\001\001B\013\n\t_errorMsgB\t\n\007_le"
-  "ader\"c\n\031QueryNotificationsMessage\022\014\n\004use"
-  "r\030\001 \001(\t\022\027\n\nfromLeader\030\002 \001(\010H\000\210\001\001\022\020\n\010cloc"
-  "kVal\030\003 \001(\005B\r\n\013_fromLeader\"[\n\014Notificatio"
-  "n\022\014\n\004user\030\001 \001(\t\022\035\n\025numberOfNotifications"
-  "\030\002 \001(\005\022\023\n\006leader\030\003 \001(\tH\000\210\001\001B\t\n\007_leader\"\177"
-  "\n\024QueryMessagesMessage\022\026\n\016clientUsername"
-  "\030\001 \001(\t\022\025\n\rotherUsername\030\002 \001(\t\022\027\n\nfromLea"
-  "der\030\003 \001(\010H\000\210\001\001\022\020\n\010clockVal\030\004 \001(\005B\r\n\013_fro"
-  "mLeader\"\256\001\n\013ChatMessage\022\026\n\016senderUsernam"
-  "e\030\001 \001(\t\022\031\n\021recipientUsername\030\002 \001(\t\022\022\n\nms"
-  "gContent\030\003 \001(\t\022\023\n\006leader\030\004 \001(\tH\000\210\001\001\022\027\n\nf"
-  "romLeader\030\005 \001(\010H\001\210\001\001\022\020\n\010clockVal\030\006 \001(\005B\t"
-  "\n\007_leaderB\r\n\013_fromLeader\"t\n\024DeleteAccoun"
-  "tMessage\022\020\n\010username\030\001 \001(\t\022\020\n\010password\030\002"
-  " \001(\t\022\027\n\nfromLeader\030\003 \001(\010H\000\210\001\001\022\020\n\010clockVa"
-  "l\030\004 \001(\005B\r\n\013_fromLeader\"p\n\022DeleteAccountR"
-  "eply\022\026\n\016deletedAccount\030\001 \001(\010\022\025\n\010errorMsg"
-  "\030\002 \001(\tH\000\210\001\001\022\023\n\006leader\030\003 \001(\tH\001\210\001\001B\013\n\t_err"
-  "orMsgB\t\n\007_leader\"\224\001\n\023MessagesSeenMessage"
-  "\022\026\n\016clientUsername\030\001 \001(\t\022\025\n\rotherUsernam"
-  "e\030\002 \001(\t\022\024\n\014messagesSeen\030\003 \001(\005\022\027\n\nfromLea"
-  "der\030\004 \001(\010H\000\210\001\001\022\020\n\010clockVal\030\005 \001(\005B\r\n\013_fro"
-  "mLeader\"3\n\021MessagesSeenReply\022\023\n\006leader\030\001"
-  " \001(\tH\000\210\001\001B\t\n\007_leader\"P\n\016RefreshRequest\022\026"
-  "\n\016clientusername\030\001 \001(\t\022\027\n\nfromLeader\030\002 \001"
-  "(\010H\000\210\001\001B\r\n\013_fromLeader\"x\n\017RefreshRespons"
-  "e\022\023\n\013forceLogout\030\001 \001(\010\0220\n\rnotifications\030"
-  "\002 \003(\0132\031.chatservice.Notification\022\023\n\006lead"
-  "er\030\003 \001(\tH\000\210\001\001B\t\n\007_leader\"\017\n\rCommitReques"
-  "t\"\020\n\016CommitResponse\"\022\n\020HeartBeatRequest\""
-  "%\n\021HeartBeatResponse\022\020\n\010isLeader\030\001 \001(\010\"\030"
-  "\n\026LeaderElectionProposal\"@\n\036LeaderElecti"
-  "onProposalResponse\022\016\n\006accept\030\001 \001(\010\022\016\n\006le"
-  "ader\030\002 \001(\t\"1\n\016CandidateValue\022\016\n\006number\030\001"
-  " \001(\005\022\017\n\007address\030\002 \001(\t\"\030\n\026LeaderElectionR"
-  "esponse\"\252\001\n\tOperation\022\024\n\014message_type\030\001 "
-  "\001(\t\022\021\n\tusername1\030\002 \001(\t\022\021\n\tusername2\030\003 \001("
-  "\t\022\020\n\010password\030\004 \001(\t\022\027\n\017message_content\030\005"
-  " \001(\t\022\024\n\014messagesseen\030\006 \001(\t\022\016\n\006leader\030\007 \001"
-  "(\t\022\020\n\010clockVal\030\010 \001(\t\"\026\n\024AddToPendingResp"
-  "onse\"\023\n\021PendingLogRequest2\361\t\n\013ChatServic"
-  "e\022S\n\rCreateAccount\022!.chatservice.CreateA"
-  "ccountMessage\032\037.chatservice.CreateAccoun"
-  "tReply\022;\n\005Login\022\031.chatservice.LoginMessa"
-  "ge\032\027.chatservice.LoginReply\022>\n\006Logout\022\032."
-  "chatservice.LogoutMessage\032\030.chatservice."
-  "LogoutReply\022@\n\tListUsers\022\036.chatservice.Q"
-  "ueryUsersMessage\032\021.chatservice.User0\001\022F\n"
-  "\013SendMessage\022\030.chatservice.ChatMessage\032\035"
-  ".chatservice.SendMessageReply\022Y\n\022QueryNo"
-  "tifications\022&.chatservice.QueryNotificat"
-  "ionsMessage\032\031.chatservice.Notification0\001"
-  "\022N\n\rQueryMessages\022!.chatservice.QueryMes"
-  "sagesMessage\032\030.chatservice.ChatMessage0\001"
-  "\022S\n\rDeleteAccount\022!.chatservice.DeleteAc"
-  "countMessage\032\037.chatservice.DeleteAccount"
-  "Reply\022J\n\rRefreshClient\022\033.chatservice.Ref"
-  "reshRequest\032\034.chatservice.RefreshRespons"
-  "e\022A\n\006Commit\022\032.chatservice.CommitRequest\032"
-  "\033.chatservice.CommitResponse\022J\n\tHeartBea"
-  "t\022\035.chatservice.HeartBeatRequest\032\036.chats"
-  "ervice.HeartBeatResponse\022i\n\025SuggestLeade"
-  "rElection\022#.chatservice.LeaderElectionPr"
-  "oposal\032+.chatservice.LeaderElectionPropo"
-  "salResponse\022R\n\016LeaderElection\022\033.chatserv"
-  "ice.CandidateValue\032#.chatservice.LeaderE"
-  "lectionResponse\022K\n\014AddToPending\022\026.chatse"
-  "rvice.Operation\032!.chatservice.AddToPendi"
-  "ngResponse(\001\022M\n\021RequestPendingLog\022\036.chat"
-  "service.PendingLogRequest\032\026.chatservice."
-  "Operation0\001\022P\n\014MessagesSeen\022 .chatservic"
-  "e.MessagesSeenMessage\032\036.chatservice.Mess"
-  "agesSeenReplyb\006proto3"
+  "_errorMsgB\t\n\007_leader\"\217\001\n\021QueryUsersMessa"
+  "ge\022\025\n\010username\030\001 \001(\tH\000\210\001\001\022\027\n\nfromLeader\030"
+  "\002 \001(\010H\001\210\001\001\022\033\n\016allowStaleRead\030\003 \001(\010H\002\210\001\001B"
+  "\013\n\t_usernameB\r\n\013_fromLeaderB\021\n\017_allowSta"
+  "leRead\"8\n\004User\022\020\n\010username\030\001 \001(\t\022\023\n\006lead"
+  "er\030\002 \001(\tH\000\210\001\001B\t\n\007_leader\"k\n\020SendMessageR"
+  "eply\022\023\n\013messageSent\030\001 \001(\010\022\025\n\010errorMsg\030\002 "
+  "\001(\tH\000\210\001\001\022\023\n\006leader\030\003 \001(\tH\001\210\001\001B\013\n\t_errorM"
+  "sgB\t\n\007_leader\"c\n\031QueryNotificationsMessa"
+  "ge\022\014\n\004user\030\001 \001(\t\022\027\n\nfromLeader\030\002 \001(\010H\000\210\001"
+  "\001\022\020\n\010clockVal\030\003 \001(\005B\r\n\013_fromLeader\"[\n\014No"
+  "tification\022\014\n\004user\030\001 \001(\t\022\035\n\025numberOfNoti"
+  "fications\030\002 \001(\005\022\023\n\006leader\030\003 \001(\tH\000\210\001\001B\t\n\007"
+  "_leader\"\257\001\n\024QueryMessagesMessage\022\026\n\016clie"
+  "ntUsername\030\001 \001(\t\022\025\n\rotherUsername\030\002 \001(\t\022"
+  "\027\n\nfromLeader\030\003 \001(\010H\000\210\001\001\022\020\n\010clockVal\030\004 \001"
+  "(\005\022\033\n\016allowStaleRead\030\005 \001(\010H\001\210\001\001B\r\n\013_from"
+  "LeaderB\021\n\017_allowStaleRead\"\332\001\n\013ChatMessag"
+  "e\022\026\n\016senderUsername\030\001 \001(\t\022\031\n\021recipientUs"
+  "ername\030\002 \001(\t\022\022\n\nmsgContent\030\003 \001(\t\022\023\n\006lead"
+  "er\030\004 \001(\tH\000\210\001\001\022\027\n\nfromLeader\030\005 \001(\010H\001\210\001\001\022\020"
+  "\n\010clockVal\030\006 \001(\005\022\031\n\014messageIndex\030\007 \001(\005H\002"
+  "\210\001\001B\t\n\007_leaderB\r\n\013_fromLeaderB\017\n\r_messag"
+  "eIndex\"t\n\024DeleteAccountMessage\022\020\n\010userna"
+  "me\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\022\027\n\nfromLeader"
+  "\030\003 \001(\010H\000\210\001\001\022\020\n\010clockVal\030\004 \001(\005B\r\n\013_fromLe"
+  "ader\"p\n\022DeleteAccountReply\022\026\n\016deletedAcc"
+  "ount\030\001 \001(\010\022\025\n\010errorMsg\030\002 \001(\tH\000\210\001\001\022\023\n\006lea"
+  "der\030\003 \001(\tH\001\210\001\001B\013\n\t_errorMsgB\t\n\007_leader\"\312"
+  "\001\n\023MessagesSeenMessage\022\026\n\016clientUsername"
+  "\030\001 \001(\t\022\025\n\rotherUsername\030\002 \001(\t\022\024\n\014message"
+  "sSeen\030\003 \001(\005\022\027\n\nfromLeader\030\004 \001(\010H\000\210\001\001\022\020\n\010"
+  "clockVal\030\005 \001(\005\022\036\n\021firstMessageIndex\030\006 \001("
+  "\005H\001\210\001\001B\r\n\013_fromLeaderB\024\n\022_firstMessageIn"
+  "dex\"3\n\021MessagesSeenReply\022\023\n\006leader\030\001 \001(\t"
+  "H\000\210\001\001B\t\n\007_leader\"P\n\016RefreshRequest\022\026\n\016cl"
+  "ientusername\030\001 \001(\t\022\027\n\nfromLeader\030\002 \001(\010H\000"
+  "\210\001\001B\r\n\013_fromLeader\"x\n\017RefreshResponse\022\023\n"
+  "\013forceLogout\030\001 \001(\010\0220\n\rnotifications\030\002 \003("
+  "\0132\031.chatservice.Notification\022\023\n\006leader\030\003"
+  " \001(\tH\000\210\001\001B\t\n\007_leader\"\022\n\020HeartBeatRequest"
+  "\"%\n\021HeartBeatResponse\022\020\n\010isLeader\030\001 \001(\010\""
+  "\030\n\026LeaderElectionProposal\"@\n\036LeaderElect"
+  "ionProposalResponse\022\016\n\006accept\030\001 \001(\010\022\016\n\006l"
+  "eader\030\002 \001(\t\"O\n\016CandidateValue\022\017\n\007address"
+  "\030\002 \001(\t\022\021\n\tlastIndex\030\003 \001(\004\022\023\n\013commitIndex"
+  "\030\004 \001(\004J\004\010\001\020\002\"\030\n\026LeaderElectionResponse\"\026"
+  "\n\024AddToPendingResponse\"\023\n\021PendingLogRequ"
+  "est\"2\n\010LogEntry\022\r\n\005index\030\001 \001(\004\022\021\n\toperat"
+  "ion\030\003 \001(\014J\004\010\002\020\003\"\?\n\010LogBlock\022\022\n\nfirstInde"
+  "x\030\001 \001(\004\022\021\n\trawLength\030\002 \001(\r\022\014\n\004data\030\003 \001(\014"
+  "\"O\n\020ReplicateRequest\022&\n\007entries\030\001 \003(\0132\025."
+  "chatservice.LogEntry\022\023\n\013commitIndex\030\002 \001("
+  "\004\"I\n\014ReplicateAck\022\021\n\tlastIndex\030\001 \001(\004\022\017\n\007"
+  "success\030\002 \001(\010\022\025\n\rneedsSnapshot\030\003 \001(\010\"\035\n\r"
+  "SnapshotChunk\022\014\n\004data\030\001 \001(\014\"\031\n\027InstallSn"
+  "apshotResponse\"\024\n\022LogPositionRequest\"j\n\013"
+  "LogPosition\022\024\n\014appliedIndex\030\001 \001(\004\022\020\n\010clo"
+  "ckVal\030\002 \001(\003\022\032\n\022hasAppliedChecksum\030\003 \001(\010\022"
+  "\027\n\017appliedChecksum\030\004 \001(\r2\237\013\n\013ChatService"
+  "\022S\n\rCreateAccount\022!.chatservice.CreateAc"
+  "countMessage\032\037.chatservice.CreateAccount"
+  "Reply\022;\n\005Login\022\031.chatservice.LoginMessag"
+  "e\032\027.chatservice.LoginReply\022>\n\006Logout\022\032.c"
+  "hatservice.LogoutMessage\032\030.chatservice.L"
+  "ogoutReply\022@\n\tListUsers\022\036.chatservice.Qu"
+  "eryUsersMessage\032\021.chatservice.User0\001\022F\n\013"
+  "SendMessage\022\030.chatservice.ChatMessage\032\035."
+  "chatservice.SendMessageReply\022Y\n\022QueryNot"
+  "ifications\022&.chatservice.QueryNotificati"
+  "onsMessage\032\031.chatservice.Notification0\001\022"
+  "N\n\rQueryMessages\022!.chatservice.QueryMess"
+  "agesMessage\032\030.chatservice.ChatMessage0\001\022"
+  "S\n\rDeleteAccount\022!.chatservice.DeleteAcc"
+  "ountMessage\032\037.chatservice.DeleteAccountR"
+  "eply\022J\n\rRefreshClient\022\033.chatservice.Refr"
+  "eshRequest\032\034.chatservice.RefreshResponse"
+  "\022I\n\tReplicate\022\035.chatservice.ReplicateReq"
+  "uest\032\031.chatservice.ReplicateAck(\0010\001\022J\n\tH"
+  "eartBeat\022\035.chatservice.HeartBeatRequest\032"
+  "\036.chatservice.HeartBeatResponse\022i\n\025Sugge"
+  "stLeaderElection\022#.chatservice.LeaderEle"
+  "ctionProposal\032+.chatservice.LeaderElecti"
+  "onProposalResponse\022R\n\016LeaderElection\022\033.c"
+  "hatservice.CandidateValue\032#.chatservice."
+  "LeaderElectionResponse\022J\n\014AddToPending\022\025"
+  ".chatservice.LogBlock\032!.chatservice.AddT"
+  "oPendingResponse(\001\022L\n\021RequestPendingLog\022"
+  "\036.chatservice.PendingLogRequest\032\025.chatse"
+  "rvice.LogEntry0\001\022U\n\017InstallSnapshot\022\032.ch"
+  "atservice.SnapshotChunk\032$.chatservice.In"
+  "stallSnapshotResponse(\001\022O\n\022RequestLogPos"
+  "ition\022\037.chatservice.LogPositionRequest\032\030"
+  ".chatservice.LogPosition\022P\n\014MessagesSeen"
+  "\022 .chatservice.MessagesSeenMessage\032\036.cha"
+  "tservice.MessagesSeenReplyb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_chatService_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_chatService_2eproto = {
-    false, false, 3821, descriptor_table_protodef_chatService_2eproto,
+    false, false, 4474, descriptor_table_protodef_chatService_2eproto,
     "chatService.proto",
-    &descriptor_table_chatService_2eproto_once, nullptr, 0, 30,
+    &descriptor_table_chatService_2eproto_once, nullptr, 0, 35,
     schemas, file_default_instances, TableStruct_chatService_2eproto::offsets,
     file_level_metadata_chatService_2eproto, file_level_enum_descriptors_chatService_2eproto,
     file_level_service_descriptors_chatService_2eproto,
@@ -2791,6 +2935,9 @@ class QueryUsersMessage::_Internal {
   static void set_has_fromleader(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
+  static void set_has_allowstaleread(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
 };
 
 QueryUsersMessage::QueryUsersMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -2806,7 +2953,8 @@ QueryUsersMessage::QueryUsersMessage(const QueryUsersMessage& from)
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.username_){}
-    , decltype(_impl_.fromleader_){}};
+    , decltype(_impl_.fromleader_){}
+    , decltype(_impl_.allowstaleread_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.username_.InitDefault();
@@ -2817,7 +2965,9 @@ QueryUsersMessage::QueryUsersMessage(const QueryUsersMessage& from)
     _this->_impl_.username_.Set(from._internal_username(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.fromleader_ = from._impl_.fromleader_;
+  ::memcpy(&_impl_.fromleader_, &from._impl_.fromleader_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.allowstaleread_) -
+    reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.allowstaleread_));
   // @@protoc_insertion_point(copy_constructor:chatservice.QueryUsersMessage)
 }
 
@@ -2830,6 +2980,7 @@ inline void QueryUsersMessage::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.username_){}
     , decltype(_impl_.fromleader_){false}
+    , decltype(_impl_.allowstaleread_){false}
   };
   _impl_.username_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2865,7 +3016,9 @@ void QueryUsersMessage::Clear() {
   if (cached_has_bits & 0x00000001u) {
     _impl_.username_.ClearNonDefaultToEmpty();
   }
-  _impl_.fromleader_ = false;
+  ::memset(&_impl_.fromleader_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.allowstaleread_) -
+      reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.allowstaleread_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -2896,6 +3049,15 @@ const char* QueryUsersMessage::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // optional bool allowStaleRead = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_allowstaleread(&has_bits);
+          _impl_.allowstaleread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2942,6 +3104,12 @@ uint8_t* QueryUsersMessage::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fromleader(), target);
   }
 
+  // optional bool allowStaleRead = 3;
+  if (_internal_has_allowstaleread()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_allowstaleread(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2959,7 +3127,7 @@ size_t QueryUsersMessage::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x00000007u) {
     // optional string username = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -2972,6 +3140,11 @@ size_t QueryUsersMessage::ByteSizeLong() const {
       total_size += 1 + 1;
     }
 
+    // optional bool allowStaleRead = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
   }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
@@ -2992,13 +3165,16 @@ void QueryUsersMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_username(from._internal_username());
     }
     if (cached_has_bits & 0x00000002u) {
       _this->_impl_.fromleader_ = from._impl_.fromleader_;
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.allowstaleread_ = from._impl_.allowstaleread_;
+    }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -3025,7 +3201,12 @@ void QueryUsersMessage::InternalSwap(QueryUsersMessage* other) {
       &_impl_.username_, lhs_arena,
       &other->_impl_.username_, rhs_arena
   );
-  swap(_impl_.fromleader_, other->_impl_.fromleader_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QueryUsersMessage, _impl_.allowstaleread_)
+      + sizeof(QueryUsersMessage::_impl_.allowstaleread_)
+      - PROTOBUF_FIELD_OFFSET(QueryUsersMessage, _impl_.fromleader_)>(
+          reinterpret_cast<char*>(&_impl_.fromleader_),
+          reinterpret_cast<char*>(&other->_impl_.fromleader_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata QueryUsersMessage::GetMetadata() const {
@@ -4183,6 +4364,9 @@ class QueryMessagesMessage::_Internal {
   static void set_has_fromleader(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_allowstaleread(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 QueryMessagesMessage::QueryMessagesMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -4199,8 +4383,9 @@ QueryMessagesMessage::QueryMessagesMessage(const QueryMessagesMessage& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.clientusername_){}
     , decltype(_impl_.otherusername_){}
+    , decltype(_impl_.clockval_){}
     , decltype(_impl_.fromleader_){}
-    , decltype(_impl_.clockval_){}};
+    , decltype(_impl_.allowstaleread_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.clientusername_.InitDefault();
@@ -4219,9 +4404,9 @@ QueryMessagesMessage::QueryMessagesMessage(const QueryMessagesMessage& from)
     _this->_impl_.otherusername_.Set(from._internal_otherusername(), 
       _this->GetArenaForAllocation());
   }
-  ::memcpy(&_impl_.fromleader_, &from._impl_.fromleader_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clockval_) -
-    reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.clockval_));
+  ::memcpy(&_impl_.clockval_, &from._impl_.clockval_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.allowstaleread_) -
+    reinterpret_cast<char*>(&_impl_.clockval_)) + sizeof(_impl_.allowstaleread_));
   // @@protoc_insertion_point(copy_constructor:chatservice.QueryMessagesMessage)
 }
 
@@ -4234,8 +4419,9 @@ inline void QueryMessagesMessage::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.clientusername_){}
     , decltype(_impl_.otherusername_){}
-    , decltype(_impl_.fromleader_){false}
     , decltype(_impl_.clockval_){0}
+    , decltype(_impl_.fromleader_){false}
+    , decltype(_impl_.allowstaleread_){false}
   };
   _impl_.clientusername_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -4274,8 +4460,13 @@ void QueryMessagesMessage::Clear() {
 
   _impl_.clientusername_.ClearToEmpty();
   _impl_.otherusername_.ClearToEmpty();
-  _impl_.fromleader_ = false;
   _impl_.clockval_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.fromleader_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.allowstaleread_) -
+        reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.allowstaleread_));
+  }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -4324,6 +4515,15 @@ const char* QueryMessagesMessage::_InternalParse(const char* ptr, ::_pbi::ParseC
         } else
           goto handle_unusual;
         continue;
+      // optional bool allowStaleRead = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_allowstaleread(&has_bits);
+          _impl_.allowstaleread_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4386,6 +4586,12 @@ uint8_t* QueryMessagesMessage::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_clockval(), target);
   }
 
+  // optional bool allowStaleRead = 5;
+  if (_internal_has_allowstaleread()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_allowstaleread(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4416,17 +4622,24 @@ size_t QueryMessagesMessage::ByteSizeLong() const {
         this->_internal_otherusername());
   }
 
-  // optional bool fromLeader = 3;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 + 1;
-  }
-
   // int32 clockVal = 4;
   if (this->_internal_clockval() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clockval());
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bool fromLeader = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool allowStaleRead = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4451,12 +4664,19 @@ void QueryMessagesMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   if (!from._internal_otherusername().empty()) {
     _this->_internal_set_otherusername(from._internal_otherusername());
   }
-  if (from._internal_has_fromleader()) {
-    _this->_internal_set_fromleader(from._internal_fromleader());
-  }
   if (from._internal_clockval() != 0) {
     _this->_internal_set_clockval(from._internal_clockval());
   }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.fromleader_ = from._impl_.fromleader_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.allowstaleread_ = from._impl_.allowstaleread_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -4486,11 +4706,11 @@ void QueryMessagesMessage::InternalSwap(QueryMessagesMessage* other) {
       &other->_impl_.otherusername_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(QueryMessagesMessage, _impl_.clockval_)
-      + sizeof(QueryMessagesMessage::_impl_.clockval_)
-      - PROTOBUF_FIELD_OFFSET(QueryMessagesMessage, _impl_.fromleader_)>(
-          reinterpret_cast<char*>(&_impl_.fromleader_),
-          reinterpret_cast<char*>(&other->_impl_.fromleader_));
+      PROTOBUF_FIELD_OFFSET(QueryMessagesMessage, _impl_.allowstaleread_)
+      + sizeof(QueryMessagesMessage::_impl_.allowstaleread_)
+      - PROTOBUF_FIELD_OFFSET(QueryMessagesMessage, _impl_.clockval_)>(
+          reinterpret_cast<char*>(&_impl_.clockval_),
+          reinterpret_cast<char*>(&other->_impl_.clockval_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata QueryMessagesMessage::GetMetadata() const {
@@ -4510,6 +4730,9 @@ class ChatMessage::_Internal {
   static void set_has_fromleader(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
+  static void set_has_messageindex(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
 };
 
 ChatMessage::ChatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -4529,7 +4752,8 @@ ChatMessage::ChatMessage(const ChatMessage& from)
     , decltype(_impl_.msgcontent_){}
     , decltype(_impl_.leader_){}
     , decltype(_impl_.fromleader_){}
-    , decltype(_impl_.clockval_){}};
+    , decltype(_impl_.clockval_){}
+    , decltype(_impl_.messageindex_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.senderusername_.InitDefault();
@@ -4565,8 +4789,8 @@ ChatMessage::ChatMessage(const ChatMessage& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.fromleader_, &from._impl_.fromleader_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clockval_) -
-    reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.clockval_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.messageindex_) -
+    reinterpret_cast<char*>(&_impl_.fromleader_)) + sizeof(_impl_.messageindex_));
   // @@protoc_insertion_point(copy_constructor:chatservice.ChatMessage)
 }
 
@@ -4583,6 +4807,7 @@ inline void ChatMessage::SharedCtor(
     , decltype(_impl_.leader_){}
     , decltype(_impl_.fromleader_){false}
     , decltype(_impl_.clockval_){0}
+    , decltype(_impl_.messageindex_){0}
   };
   _impl_.senderusername_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -4638,6 +4863,7 @@ void ChatMessage::Clear() {
   }
   _impl_.fromleader_ = false;
   _impl_.clockval_ = 0;
+  _impl_.messageindex_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -4706,6 +4932,15 @@ const char* ChatMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
         } else
           goto handle_unusual;
         continue;
+      // optional int32 messageIndex = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_messageindex(&has_bits);
+          _impl_.messageindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4788,6 +5023,12 @@ uint8_t* ChatMessage::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_clockval(), target);
   }
 
+  // optional int32 messageIndex = 7;
+  if (_internal_has_messageindex()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_messageindex(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4845,6 +5086,11 @@ size_t ChatMessage::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clockval());
   }
 
+  // optional int32 messageIndex = 7;
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_messageindex());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4885,6 +5131,9 @@ void ChatMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   if (from._internal_clockval() != 0) {
     _this->_internal_set_clockval(from._internal_clockval());
   }
+  if (cached_has_bits & 0x00000004u) {
+    _this->_internal_set_messageindex(from._internal_messageindex());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -4922,8 +5171,8 @@ void ChatMessage::InternalSwap(ChatMessage* other) {
       &other->_impl_.leader_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ChatMessage, _impl_.clockval_)
-      + sizeof(ChatMessage::_impl_.clockval_)
+      PROTOBUF_FIELD_OFFSET(ChatMessage, _impl_.messageindex_)
+      + sizeof(ChatMessage::_impl_.messageindex_)
       - PROTOBUF_FIELD_OFFSET(ChatMessage, _impl_.fromleader_)>(
           reinterpret_cast<char*>(&_impl_.fromleader_),
           reinterpret_cast<char*>(&other->_impl_.fromleader_));
@@ -5573,6 +5822,9 @@ class MessagesSeenMessage::_Internal {
   static void set_has_fromleader(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_firstmessageindex(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 MessagesSeenMessage::MessagesSeenMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -5591,7 +5843,8 @@ MessagesSeenMessage::MessagesSeenMessage(const MessagesSeenMessage& from)
     , decltype(_impl_.otherusername_){}
     , decltype(_impl_.messagesseen_){}
     , decltype(_impl_.fromleader_){}
-    , decltype(_impl_.clockval_){}};
+    , decltype(_impl_.clockval_){}
+    , decltype(_impl_.firstmessageindex_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.clientusername_.InitDefault();
@@ -5611,8 +5864,8 @@ MessagesSeenMessage::MessagesSeenMessage(const MessagesSeenMessage& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.messagesseen_, &from._impl_.messagesseen_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clockval_) -
-    reinterpret_cast<char*>(&_impl_.messagesseen_)) + sizeof(_impl_.clockval_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.firstmessageindex_) -
+    reinterpret_cast<char*>(&_impl_.messagesseen_)) + sizeof(_impl_.firstmessageindex_));
   // @@protoc_insertion_point(copy_constructor:chatservice.MessagesSeenMessage)
 }
 
@@ -5628,6 +5881,7 @@ inline void MessagesSeenMessage::SharedCtor(
     , decltype(_impl_.messagesseen_){0}
     , decltype(_impl_.fromleader_){false}
     , decltype(_impl_.clockval_){0}
+    , decltype(_impl_.firstmessageindex_){0}
   };
   _impl_.clientusername_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -5669,6 +5923,7 @@ void MessagesSeenMessage::Clear() {
   _impl_.messagesseen_ = 0;
   _impl_.fromleader_ = false;
   _impl_.clockval_ = 0;
+  _impl_.firstmessageindex_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -5725,6 +5980,15 @@ const char* MessagesSeenMessage::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // optional int32 firstMessageIndex = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_firstmessageindex(&has_bits);
+          _impl_.firstmessageindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5793,6 +6057,12 @@ uint8_t* MessagesSeenMessage::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_clockval(), target);
   }
 
+  // optional int32 firstMessageIndex = 6;
+  if (_internal_has_firstmessageindex()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_firstmessageindex(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -5839,6 +6109,11 @@ size_t MessagesSeenMessage::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_clockval());
   }
 
+  // optional int32 firstMessageIndex = 6;
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_firstmessageindex());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -5872,6 +6147,9 @@ void MessagesSeenMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   if (from._internal_clockval() != 0) {
     _this->_internal_set_clockval(from._internal_clockval());
   }
+  if (from._internal_has_firstmessageindex()) {
+    _this->_internal_set_firstmessageindex(from._internal_firstmessageindex());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -5901,8 +6179,8 @@ void MessagesSeenMessage::InternalSwap(MessagesSeenMessage* other) {
       &other->_impl_.otherusername_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(MessagesSeenMessage, _impl_.clockval_)
-      + sizeof(MessagesSeenMessage::_impl_.clockval_)
+      PROTOBUF_FIELD_OFFSET(MessagesSeenMessage, _impl_.firstmessageindex_)
+      + sizeof(MessagesSeenMessage::_impl_.firstmessageindex_)
       - PROTOBUF_FIELD_OFFSET(MessagesSeenMessage, _impl_.messagesseen_)>(
           reinterpret_cast<char*>(&_impl_.messagesseen_),
           reinterpret_cast<char*>(&other->_impl_.messagesseen_));
@@ -6653,31 +6931,31 @@ void RefreshResponse::InternalSwap(RefreshResponse* other) {
 
 // ===================================================================
 
-class CommitRequest::_Internal {
+class HeartBeatRequest::_Internal {
  public:
 };
 
-CommitRequest::CommitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HeartBeatRequest::HeartBeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:chatservice.CommitRequest)
+  // @@protoc_insertion_point(arena_constructor:chatservice.HeartBeatRequest)
 }
-CommitRequest::CommitRequest(const CommitRequest& from)
+HeartBeatRequest::HeartBeatRequest(const HeartBeatRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  CommitRequest* const _this = this; (void)_this;
+  HeartBeatRequest* const _this = this; (void)_this;
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:chatservice.CommitRequest)
+  // @@protoc_insertion_point(copy_constructor:chatservice.HeartBeatRequest)
 }
 
 
 
 
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartBeatRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartBeatRequest::GetClassData() const { return &_class_data_; }
 
 
 
@@ -6685,7 +6963,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitRequest::GetClassData()
 
 
 
-::PROTOBUF_NAMESPACE_ID::Metadata CommitRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HeartBeatRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
       file_level_metadata_chatService_2eproto[19]);
@@ -6693,102 +6971,22 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitRequest::GetClassData()
 
 // ===================================================================
 
-class CommitResponse::_Internal {
+class HeartBeatResponse::_Internal {
  public:
 };
 
-CommitResponse::CommitResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HeartBeatResponse::HeartBeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:chatservice.CommitResponse)
-}
-CommitResponse::CommitResponse(const CommitResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  CommitResponse* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:chatservice.CommitResponse)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.HeartBeatResponse)
 }
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitResponse::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata CommitResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[20]);
-}
-
-// ===================================================================
-
-class HeartBeatRequest::_Internal {
- public:
-};
-
-HeartBeatRequest::HeartBeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:chatservice.HeartBeatRequest)
-}
-HeartBeatRequest::HeartBeatRequest(const HeartBeatRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  HeartBeatRequest* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:chatservice.HeartBeatRequest)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartBeatRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartBeatRequest::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata HeartBeatRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[21]);
-}
-
-// ===================================================================
-
-class HeartBeatResponse::_Internal {
- public:
-};
-
-HeartBeatResponse::HeartBeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:chatservice.HeartBeatResponse)
-}
-HeartBeatResponse::HeartBeatResponse(const HeartBeatResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HeartBeatResponse* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.isleader_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+HeartBeatResponse::HeartBeatResponse(const HeartBeatResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HeartBeatResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.isleader_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.isleader_ = from._impl_.isleader_;
@@ -6946,7 +7144,7 @@ void HeartBeatResponse::InternalSwap(HeartBeatResponse* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata HeartBeatResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[22]);
+      file_level_metadata_chatService_2eproto[20]);
 }
 
 // ===================================================================
@@ -6986,7 +7184,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderElectionProposal::GetCla
 ::PROTOBUF_NAMESPACE_ID::Metadata LeaderElectionProposal::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[23]);
+      file_level_metadata_chatService_2eproto[21]);
 }
 
 // ===================================================================
@@ -7216,7 +7414,7 @@ void LeaderElectionProposalResponse::InternalSwap(LeaderElectionProposalResponse
 ::PROTOBUF_NAMESPACE_ID::Metadata LeaderElectionProposalResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[24]);
+      file_level_metadata_chatService_2eproto[22]);
 }
 
 // ===================================================================
@@ -7236,7 +7434,8 @@ CandidateValue::CandidateValue(const CandidateValue& from)
   CandidateValue* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.address_){}
-    , decltype(_impl_.number_){}
+    , decltype(_impl_.lastindex_){}
+    , decltype(_impl_.commitindex_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -7248,7 +7447,9 @@ CandidateValue::CandidateValue(const CandidateValue& from)
     _this->_impl_.address_.Set(from._internal_address(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.number_ = from._impl_.number_;
+  ::memcpy(&_impl_.lastindex_, &from._impl_.lastindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.commitindex_) -
+    reinterpret_cast<char*>(&_impl_.lastindex_)) + sizeof(_impl_.commitindex_));
   // @@protoc_insertion_point(copy_constructor:chatservice.CandidateValue)
 }
 
@@ -7258,7 +7459,8 @@ inline void CandidateValue::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.address_){}
-    , decltype(_impl_.number_){0}
+    , decltype(_impl_.lastindex_){uint64_t{0u}}
+    , decltype(_impl_.commitindex_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.address_.InitDefault();
@@ -7292,7 +7494,9 @@ void CandidateValue::Clear() {
   (void) cached_has_bits;
 
   _impl_.address_.ClearToEmpty();
-  _impl_.number_ = 0;
+  ::memset(&_impl_.lastindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.commitindex_) -
+      reinterpret_cast<char*>(&_impl_.lastindex_)) + sizeof(_impl_.commitindex_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -7302,14 +7506,6 @@ const char* CandidateValue::_InternalParse(const char* ptr, ::_pbi::ParseContext
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 number = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       // string address = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
@@ -7320,6 +7516,22 @@ const char* CandidateValue::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // uint64 lastIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 commitIndex = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.commitindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -7349,12 +7561,6 @@ uint8_t* CandidateValue::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 number = 1;
-  if (this->_internal_number() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_number(), target);
-  }
-
   // string address = 2;
   if (!this->_internal_address().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
@@ -7365,6 +7571,18 @@ uint8_t* CandidateValue::_InternalSerialize(
         2, this->_internal_address(), target);
   }
 
+  // uint64 lastIndex = 3;
+  if (this->_internal_lastindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lastindex(), target);
+  }
+
+  // uint64 commitIndex = 4;
+  if (this->_internal_commitindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_commitindex(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -7388,9 +7606,14 @@ size_t CandidateValue::ByteSizeLong() const {
         this->_internal_address());
   }
 
-  // int32 number = 1;
-  if (this->_internal_number() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_number());
+  // uint64 lastIndex = 3;
+  if (this->_internal_lastindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastindex());
+  }
+
+  // uint64 commitIndex = 4;
+  if (this->_internal_commitindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_commitindex());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
@@ -7414,8 +7637,11 @@ void CandidateValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   if (!from._internal_address().empty()) {
     _this->_internal_set_address(from._internal_address());
   }
-  if (from._internal_number() != 0) {
-    _this->_internal_set_number(from._internal_number());
+  if (from._internal_lastindex() != 0) {
+    _this->_internal_set_lastindex(from._internal_lastindex());
+  }
+  if (from._internal_commitindex() != 0) {
+    _this->_internal_set_commitindex(from._internal_commitindex());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -7440,13 +7666,18 @@ void CandidateValue::InternalSwap(CandidateValue* other) {
       &_impl_.address_, lhs_arena,
       &other->_impl_.address_, rhs_arena
   );
-  swap(_impl_.number_, other->_impl_.number_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CandidateValue, _impl_.commitindex_)
+      + sizeof(CandidateValue::_impl_.commitindex_)
+      - PROTOBUF_FIELD_OFFSET(CandidateValue, _impl_.lastindex_)>(
+          reinterpret_cast<char*>(&_impl_.lastindex_),
+          reinterpret_cast<char*>(&other->_impl_.lastindex_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata CandidateValue::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[25]);
+      file_level_metadata_chatService_2eproto[23]);
 }
 
 // ===================================================================
@@ -7484,6 +7715,86 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderElectionResponse::GetCla
 
 
 ::PROTOBUF_NAMESPACE_ID::Metadata LeaderElectionResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[24]);
+}
+
+// ===================================================================
+
+class AddToPendingResponse::_Internal {
+ public:
+};
+
+AddToPendingResponse::AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chatservice.AddToPendingResponse)
+}
+AddToPendingResponse::AddToPendingResponse(const AddToPendingResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  AddToPendingResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chatservice.AddToPendingResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AddToPendingResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AddToPendingResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata AddToPendingResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[25]);
+}
+
+// ===================================================================
+
+class PendingLogRequest::_Internal {
+ public:
+};
+
+PendingLogRequest::PendingLogRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chatservice.PendingLogRequest)
+}
+PendingLogRequest::PendingLogRequest(const PendingLogRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PendingLogRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chatservice.PendingLogRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PendingLogRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PendingLogRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata PendingLogRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
       file_level_metadata_chatService_2eproto[26]);
@@ -7491,149 +7802,1256 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderElectionResponse::GetCla
 
 // ===================================================================
 
-class Operation::_Internal {
+class LogEntry::_Internal {
  public:
 };
 
-Operation::Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:chatservice.Operation)
+  // @@protoc_insertion_point(arena_constructor:chatservice.LogEntry)
 }
-Operation::Operation(const Operation& from)
+LogEntry::LogEntry(const LogEntry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Operation* const _this = this; (void)_this;
+  LogEntry* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_type_){}
-    , decltype(_impl_.username1_){}
-    , decltype(_impl_.username2_){}
-    , decltype(_impl_.password_){}
-    , decltype(_impl_.message_content_){}
-    , decltype(_impl_.messagesseen_){}
-    , decltype(_impl_.leader_){}
-    , decltype(_impl_.clockval_){}
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.index_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.message_type_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_type_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_type().empty()) {
-    _this->_impl_.message_type_.Set(from._internal_message_type(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.username1_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username1_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_username1().empty()) {
-    _this->_impl_.username1_.Set(from._internal_username1(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.username2_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username2_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_username2().empty()) {
-    _this->_impl_.username2_.Set(from._internal_username2(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.password_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.password_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_password().empty()) {
-    _this->_impl_.password_.Set(from._internal_password(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.message_content_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_content_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_content().empty()) {
-    _this->_impl_.message_content_.Set(from._internal_message_content(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.messagesseen_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.messagesseen_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_messagesseen().empty()) {
-    _this->_impl_.messagesseen_.Set(from._internal_messagesseen(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.leader_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leader_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_leader().empty()) {
-    _this->_impl_.leader_.Set(from._internal_leader(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.clockval_.InitDefault();
+  _impl_.operation_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.clockval_.Set("", GetArenaForAllocation());
+    _impl_.operation_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_clockval().empty()) {
-    _this->_impl_.clockval_.Set(from._internal_clockval(), 
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:chatservice.Operation)
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:chatservice.LogEntry)
 }
 
-inline void Operation::SharedCtor(
+inline void LogEntry::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_type_){}
-    , decltype(_impl_.username1_){}
-    , decltype(_impl_.username2_){}
-    , decltype(_impl_.password_){}
-    , decltype(_impl_.message_content_){}
-    , decltype(_impl_.messagesseen_){}
-    , decltype(_impl_.leader_){}
-    , decltype(_impl_.clockval_){}
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.index_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.message_type_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_type_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.username1_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username1_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.username2_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.username2_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.password_.InitDefault();
+  _impl_.operation_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.password_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.message_content_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_content_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.messagesseen_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.messagesseen_.Set("", GetArenaForAllocation());
+    _impl_.operation_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.leader_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leader_.Set("", GetArenaForAllocation());
+}
+
+LogEntry::~LogEntry() {
+  // @@protoc_insertion_point(destructor:chatservice.LogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operation_.Destroy();
+}
+
+void LogEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.LogEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_.ClearToEmpty();
+  _impl_.index_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes operation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.LogEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_index(), target);
+  }
+
+  // bytes operation = 3;
+  if (!this->_internal_operation().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_operation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.LogEntry)
+  return target;
+}
+
+size_t LogEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.LogEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes operation = 3;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_operation());
+  }
+
+  // uint64 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogEntry::GetClassData() const { return &_class_data_; }
+
+
+void LogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogEntry*>(&to_msg);
+  auto& from = static_cast<const LogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.LogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogEntry::CopyFrom(const LogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.LogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogEntry::IsInitialized() const {
+  return true;
+}
+
+void LogEntry::InternalSwap(LogEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+  swap(_impl_.index_, other->_impl_.index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[27]);
+}
+
+// ===================================================================
+
+class LogBlock::_Internal {
+ public:
+};
+
+LogBlock::LogBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.LogBlock)
+}
+LogBlock::LogBlock(const LogBlock& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogBlock* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.firstindex_){}
+    , decltype(_impl_.rawlength_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.firstindex_, &from._impl_.firstindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rawlength_) -
+    reinterpret_cast<char*>(&_impl_.firstindex_)) + sizeof(_impl_.rawlength_));
+  // @@protoc_insertion_point(copy_constructor:chatservice.LogBlock)
+}
+
+inline void LogBlock::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.firstindex_){uint64_t{0u}}
+    , decltype(_impl_.rawlength_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LogBlock::~LogBlock() {
+  // @@protoc_insertion_point(destructor:chatservice.LogBlock)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogBlock::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void LogBlock::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogBlock::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.LogBlock)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.firstindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rawlength_) -
+      reinterpret_cast<char*>(&_impl_.firstindex_)) + sizeof(_impl_.rawlength_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogBlock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 firstIndex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.firstindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 rawLength = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.rawlength_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogBlock::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.LogBlock)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 firstIndex = 1;
+  if (this->_internal_firstindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_firstindex(), target);
+  }
+
+  // uint32 rawLength = 2;
+  if (this->_internal_rawlength() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_rawlength(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.LogBlock)
+  return target;
+}
+
+size_t LogBlock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.LogBlock)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint64 firstIndex = 1;
+  if (this->_internal_firstindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_firstindex());
+  }
+
+  // uint32 rawLength = 2;
+  if (this->_internal_rawlength() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_rawlength());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogBlock::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogBlock::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogBlock::GetClassData() const { return &_class_data_; }
+
+
+void LogBlock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogBlock*>(&to_msg);
+  auto& from = static_cast<const LogBlock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.LogBlock)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_firstindex() != 0) {
+    _this->_internal_set_firstindex(from._internal_firstindex());
+  }
+  if (from._internal_rawlength() != 0) {
+    _this->_internal_set_rawlength(from._internal_rawlength());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogBlock::CopyFrom(const LogBlock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.LogBlock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogBlock::IsInitialized() const {
+  return true;
+}
+
+void LogBlock::InternalSwap(LogBlock* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogBlock, _impl_.rawlength_)
+      + sizeof(LogBlock::_impl_.rawlength_)
+      - PROTOBUF_FIELD_OFFSET(LogBlock, _impl_.firstindex_)>(
+          reinterpret_cast<char*>(&_impl_.firstindex_),
+          reinterpret_cast<char*>(&other->_impl_.firstindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogBlock::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[28]);
+}
+
+// ===================================================================
+
+class ReplicateRequest::_Internal {
+ public:
+};
+
+ReplicateRequest::ReplicateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.ReplicateRequest)
+}
+ReplicateRequest::ReplicateRequest(const ReplicateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.commitindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.commitindex_ = from._impl_.commitindex_;
+  // @@protoc_insertion_point(copy_constructor:chatservice.ReplicateRequest)
+}
+
+inline void ReplicateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.commitindex_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReplicateRequest::~ReplicateRequest() {
+  // @@protoc_insertion_point(destructor:chatservice.ReplicateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void ReplicateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.ReplicateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _impl_.commitindex_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chatservice.LogEntry entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 commitIndex = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.commitindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.ReplicateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chatservice.LogEntry entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 commitIndex = 2;
+  if (this->_internal_commitindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_commitindex(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.ReplicateRequest)
+  return target;
+}
+
+size_t ReplicateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.ReplicateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chatservice.LogEntry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 commitIndex = 2;
+  if (this->_internal_commitindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_commitindex());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicateRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReplicateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicateRequest*>(&to_msg);
+  auto& from = static_cast<const ReplicateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.ReplicateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_commitindex() != 0) {
+    _this->_internal_set_commitindex(from._internal_commitindex());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplicateRequest::CopyFrom(const ReplicateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.ReplicateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplicateRequest::IsInitialized() const {
+  return true;
+}
+
+void ReplicateRequest::InternalSwap(ReplicateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  swap(_impl_.commitindex_, other->_impl_.commitindex_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[29]);
+}
+
+// ===================================================================
+
+class ReplicateAck::_Internal {
+ public:
+};
+
+ReplicateAck::ReplicateAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.ReplicateAck)
+}
+ReplicateAck::ReplicateAck(const ReplicateAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicateAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lastindex_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.needssnapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lastindex_, &from._impl_.lastindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.needssnapshot_) -
+    reinterpret_cast<char*>(&_impl_.lastindex_)) + sizeof(_impl_.needssnapshot_));
+  // @@protoc_insertion_point(copy_constructor:chatservice.ReplicateAck)
+}
+
+inline void ReplicateAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lastindex_){uint64_t{0u}}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.needssnapshot_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReplicateAck::~ReplicateAck() {
+  // @@protoc_insertion_point(destructor:chatservice.ReplicateAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicateAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReplicateAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicateAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.ReplicateAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.lastindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.needssnapshot_) -
+      reinterpret_cast<char*>(&_impl_.lastindex_)) + sizeof(_impl_.needssnapshot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicateAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 lastIndex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.lastindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool needsSnapshot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.needssnapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicateAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.ReplicateAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 lastIndex = 1;
+  if (this->_internal_lastindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_lastindex(), target);
+  }
+
+  // bool success = 2;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
+
+  // bool needsSnapshot = 3;
+  if (this->_internal_needssnapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_needssnapshot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.ReplicateAck)
+  return target;
+}
+
+size_t ReplicateAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.ReplicateAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 lastIndex = 1;
+  if (this->_internal_lastindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastindex());
+  }
+
+  // bool success = 2;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool needsSnapshot = 3;
+  if (this->_internal_needssnapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicateAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicateAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicateAck::GetClassData() const { return &_class_data_; }
+
+
+void ReplicateAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicateAck*>(&to_msg);
+  auto& from = static_cast<const ReplicateAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.ReplicateAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_lastindex() != 0) {
+    _this->_internal_set_lastindex(from._internal_lastindex());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_needssnapshot() != 0) {
+    _this->_internal_set_needssnapshot(from._internal_needssnapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplicateAck::CopyFrom(const ReplicateAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.ReplicateAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplicateAck::IsInitialized() const {
+  return true;
+}
+
+void ReplicateAck::InternalSwap(ReplicateAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicateAck, _impl_.needssnapshot_)
+      + sizeof(ReplicateAck::_impl_.needssnapshot_)
+      - PROTOBUF_FIELD_OFFSET(ReplicateAck, _impl_.lastindex_)>(
+          reinterpret_cast<char*>(&_impl_.lastindex_),
+          reinterpret_cast<char*>(&other->_impl_.lastindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicateAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[30]);
+}
+
+// ===================================================================
+
+class SnapshotChunk::_Internal {
+ public:
+};
+
+SnapshotChunk::SnapshotChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.SnapshotChunk)
+}
+SnapshotChunk::SnapshotChunk(const SnapshotChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SnapshotChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.clockval_.InitDefault();
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chatservice.SnapshotChunk)
+}
+
+inline void SnapshotChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.clockval_.Set("", GetArenaForAllocation());
+    _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Operation::~Operation() {
-  // @@protoc_insertion_point(destructor:chatservice.Operation)
+SnapshotChunk::~SnapshotChunk() {
+  // @@protoc_insertion_point(destructor:chatservice.SnapshotChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SnapshotChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void SnapshotChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SnapshotChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.SnapshotChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SnapshotChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SnapshotChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.SnapshotChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes data = 1;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.SnapshotChunk)
+  return target;
+}
+
+size_t SnapshotChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.SnapshotChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 1;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SnapshotChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SnapshotChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SnapshotChunk::GetClassData() const { return &_class_data_; }
+
+
+void SnapshotChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SnapshotChunk*>(&to_msg);
+  auto& from = static_cast<const SnapshotChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.SnapshotChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SnapshotChunk::CopyFrom(const SnapshotChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.SnapshotChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SnapshotChunk::IsInitialized() const {
+  return true;
+}
+
+void SnapshotChunk::InternalSwap(SnapshotChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SnapshotChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[31]);
+}
+
+// ===================================================================
+
+class InstallSnapshotResponse::_Internal {
+ public:
+};
+
+InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chatservice.InstallSnapshotResponse)
+}
+InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  InstallSnapshotResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chatservice.InstallSnapshotResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[32]);
+}
+
+// ===================================================================
+
+class LogPositionRequest::_Internal {
+ public:
+};
+
+LogPositionRequest::LogPositionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chatservice.LogPositionRequest)
+}
+LogPositionRequest::LogPositionRequest(const LogPositionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  LogPositionRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chatservice.LogPositionRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogPositionRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogPositionRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogPositionRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
+      file_level_metadata_chatService_2eproto[33]);
+}
+
+// ===================================================================
+
+class LogPosition::_Internal {
+ public:
+};
+
+LogPosition::LogPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chatservice.LogPosition)
+}
+LogPosition::LogPosition(const LogPosition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogPosition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.appliedindex_){}
+    , decltype(_impl_.clockval_){}
+    , decltype(_impl_.hasappliedchecksum_){}
+    , decltype(_impl_.appliedchecksum_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.appliedindex_, &from._impl_.appliedindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.appliedchecksum_) -
+    reinterpret_cast<char*>(&_impl_.appliedindex_)) + sizeof(_impl_.appliedchecksum_));
+  // @@protoc_insertion_point(copy_constructor:chatservice.LogPosition)
+}
+
+inline void LogPosition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.appliedindex_){uint64_t{0u}}
+    , decltype(_impl_.clockval_){int64_t{0}}
+    , decltype(_impl_.hasappliedchecksum_){false}
+    , decltype(_impl_.appliedchecksum_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LogPosition::~LogPosition() {
+  // @@protoc_insertion_point(destructor:chatservice.LogPosition)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7641,122 +9059,61 @@ Operation::~Operation() {
   SharedDtor();
 }
 
-inline void Operation::SharedDtor() {
+inline void LogPosition::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.message_type_.Destroy();
-  _impl_.username1_.Destroy();
-  _impl_.username2_.Destroy();
-  _impl_.password_.Destroy();
-  _impl_.message_content_.Destroy();
-  _impl_.messagesseen_.Destroy();
-  _impl_.leader_.Destroy();
-  _impl_.clockval_.Destroy();
 }
 
-void Operation::SetCachedSize(int size) const {
+void LogPosition::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Operation::Clear() {
-// @@protoc_insertion_point(message_clear_start:chatservice.Operation)
+void LogPosition::Clear() {
+// @@protoc_insertion_point(message_clear_start:chatservice.LogPosition)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.message_type_.ClearToEmpty();
-  _impl_.username1_.ClearToEmpty();
-  _impl_.username2_.ClearToEmpty();
-  _impl_.password_.ClearToEmpty();
-  _impl_.message_content_.ClearToEmpty();
-  _impl_.messagesseen_.ClearToEmpty();
-  _impl_.leader_.ClearToEmpty();
-  _impl_.clockval_.ClearToEmpty();
+  ::memset(&_impl_.appliedindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.appliedchecksum_) -
+      reinterpret_cast<char*>(&_impl_.appliedindex_)) + sizeof(_impl_.appliedchecksum_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Operation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* LogPosition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string message_type = 1;
+      // uint64 appliedIndex = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_message_type();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.appliedindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.message_type"));
         } else
           goto handle_unusual;
         continue;
-      // string username1 = 2;
+      // int64 clockVal = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_username1();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clockval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.username1"));
         } else
           goto handle_unusual;
         continue;
-      // string username2 = 3;
+      // bool hasAppliedChecksum = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_username2();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.hasappliedchecksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.username2"));
         } else
           goto handle_unusual;
         continue;
-      // string password = 4;
+      // uint32 appliedChecksum = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_password();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.password"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string message_content = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_message_content();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.message_content"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string messagesseen = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_messagesseen();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.messagesseen"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string leader = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_leader();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.leader"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string clockVal = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
-          auto str = _internal_mutable_clockval();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.appliedchecksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "chatservice.Operation.clockVal"));
         } else
           goto handle_unusual;
         continue;
@@ -7783,343 +9140,131 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Operation::_InternalSerialize(
+uint8_t* LogPosition::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chatservice.Operation)
+  // @@protoc_insertion_point(serialize_to_array_start:chatservice.LogPosition)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string message_type = 1;
-  if (!this->_internal_message_type().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_type().data(), static_cast<int>(this->_internal_message_type().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.message_type");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_message_type(), target);
-  }
-
-  // string username1 = 2;
-  if (!this->_internal_username1().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username1().data(), static_cast<int>(this->_internal_username1().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.username1");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_username1(), target);
-  }
-
-  // string username2 = 3;
-  if (!this->_internal_username2().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username2().data(), static_cast<int>(this->_internal_username2().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.username2");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_username2(), target);
-  }
-
-  // string password = 4;
-  if (!this->_internal_password().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_password().data(), static_cast<int>(this->_internal_password().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.password");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_password(), target);
-  }
-
-  // string message_content = 5;
-  if (!this->_internal_message_content().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_content().data(), static_cast<int>(this->_internal_message_content().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.message_content");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_message_content(), target);
+  // uint64 appliedIndex = 1;
+  if (this->_internal_appliedindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_appliedindex(), target);
   }
 
-  // string messagesseen = 6;
-  if (!this->_internal_messagesseen().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_messagesseen().data(), static_cast<int>(this->_internal_messagesseen().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.messagesseen");
-    target = stream->WriteStringMaybeAliased(
-        6, this->_internal_messagesseen(), target);
+  // int64 clockVal = 2;
+  if (this->_internal_clockval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_clockval(), target);
   }
 
-  // string leader = 7;
-  if (!this->_internal_leader().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_leader().data(), static_cast<int>(this->_internal_leader().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.leader");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_leader(), target);
+  // bool hasAppliedChecksum = 3;
+  if (this->_internal_hasappliedchecksum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_hasappliedchecksum(), target);
   }
 
-  // string clockVal = 8;
-  if (!this->_internal_clockval().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_clockval().data(), static_cast<int>(this->_internal_clockval().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chatservice.Operation.clockVal");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_clockval(), target);
+  // uint32 appliedChecksum = 4;
+  if (this->_internal_appliedchecksum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_appliedchecksum(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chatservice.Operation)
+  // @@protoc_insertion_point(serialize_to_array_end:chatservice.LogPosition)
   return target;
 }
 
-size_t Operation::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chatservice.Operation)
+size_t LogPosition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chatservice.LogPosition)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message_type = 1;
-  if (!this->_internal_message_type().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_type());
-  }
-
-  // string username1 = 2;
-  if (!this->_internal_username1().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_username1());
-  }
-
-  // string username2 = 3;
-  if (!this->_internal_username2().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_username2());
-  }
-
-  // string password = 4;
-  if (!this->_internal_password().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_password());
-  }
-
-  // string message_content = 5;
-  if (!this->_internal_message_content().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_content());
+  // uint64 appliedIndex = 1;
+  if (this->_internal_appliedindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_appliedindex());
   }
 
-  // string messagesseen = 6;
-  if (!this->_internal_messagesseen().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_messagesseen());
+  // int64 clockVal = 2;
+  if (this->_internal_clockval() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_clockval());
   }
 
-  // string leader = 7;
-  if (!this->_internal_leader().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_leader());
+  // bool hasAppliedChecksum = 3;
+  if (this->_internal_hasappliedchecksum() != 0) {
+    total_size += 1 + 1;
   }
 
-  // string clockVal = 8;
-  if (!this->_internal_clockval().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_clockval());
+  // uint32 appliedChecksum = 4;
+  if (this->_internal_appliedchecksum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_appliedchecksum());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Operation::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogPosition::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Operation::MergeImpl
+    LogPosition::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Operation::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogPosition::GetClassData() const { return &_class_data_; }
 
 
-void Operation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Operation*>(&to_msg);
-  auto& from = static_cast<const Operation&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.Operation)
+void LogPosition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogPosition*>(&to_msg);
+  auto& from = static_cast<const LogPosition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chatservice.LogPosition)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_message_type().empty()) {
-    _this->_internal_set_message_type(from._internal_message_type());
-  }
-  if (!from._internal_username1().empty()) {
-    _this->_internal_set_username1(from._internal_username1());
-  }
-  if (!from._internal_username2().empty()) {
-    _this->_internal_set_username2(from._internal_username2());
-  }
-  if (!from._internal_password().empty()) {
-    _this->_internal_set_password(from._internal_password());
+  if (from._internal_appliedindex() != 0) {
+    _this->_internal_set_appliedindex(from._internal_appliedindex());
   }
-  if (!from._internal_message_content().empty()) {
-    _this->_internal_set_message_content(from._internal_message_content());
-  }
-  if (!from._internal_messagesseen().empty()) {
-    _this->_internal_set_messagesseen(from._internal_messagesseen());
+  if (from._internal_clockval() != 0) {
+    _this->_internal_set_clockval(from._internal_clockval());
   }
-  if (!from._internal_leader().empty()) {
-    _this->_internal_set_leader(from._internal_leader());
+  if (from._internal_hasappliedchecksum() != 0) {
+    _this->_internal_set_hasappliedchecksum(from._internal_hasappliedchecksum());
   }
-  if (!from._internal_clockval().empty()) {
-    _this->_internal_set_clockval(from._internal_clockval());
+  if (from._internal_appliedchecksum() != 0) {
+    _this->_internal_set_appliedchecksum(from._internal_appliedchecksum());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Operation::CopyFrom(const Operation& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.Operation)
+void LogPosition::CopyFrom(const LogPosition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chatservice.LogPosition)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Operation::IsInitialized() const {
+bool LogPosition::IsInitialized() const {
   return true;
 }
 
-void Operation::InternalSwap(Operation* other) {
+void LogPosition::InternalSwap(LogPosition* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.message_type_, lhs_arena,
-      &other->_impl_.message_type_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.username1_, lhs_arena,
-      &other->_impl_.username1_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.username2_, lhs_arena,
-      &other->_impl_.username2_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.password_, lhs_arena,
-      &other->_impl_.password_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.message_content_, lhs_arena,
-      &other->_impl_.message_content_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.messagesseen_, lhs_arena,
-      &other->_impl_.messagesseen_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.leader_, lhs_arena,
-      &other->_impl_.leader_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.clockval_, lhs_arena,
-      &other->_impl_.clockval_, rhs_arena
-  );
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Operation::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[27]);
-}
-
-// ===================================================================
-
-class AddToPendingResponse::_Internal {
- public:
-};
-
-AddToPendingResponse::AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:chatservice.AddToPendingResponse)
-}
-AddToPendingResponse::AddToPendingResponse(const AddToPendingResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  AddToPendingResponse* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:chatservice.AddToPendingResponse)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AddToPendingResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AddToPendingResponse::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata AddToPendingResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[28]);
-}
-
-// ===================================================================
-
-class PendingLogRequest::_Internal {
- public:
-};
-
-PendingLogRequest::PendingLogRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:chatservice.PendingLogRequest)
-}
-PendingLogRequest::PendingLogRequest(const PendingLogRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  PendingLogRequest* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:chatservice.PendingLogRequest)
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogPosition, _impl_.appliedchecksum_)
+      + sizeof(LogPosition::_impl_.appliedchecksum_)
+      - PROTOBUF_FIELD_OFFSET(LogPosition, _impl_.appliedindex_)>(
+          reinterpret_cast<char*>(&_impl_.appliedindex_),
+          reinterpret_cast<char*>(&other->_impl_.appliedindex_));
 }
 
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PendingLogRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PendingLogRequest::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata PendingLogRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LogPosition::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_chatService_2eproto_getter, &descriptor_table_chatService_2eproto_once,
-      file_level_metadata_chatService_2eproto[29]);
+      file_level_metadata_chatService_2eproto[34]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -8201,14 +9346,6 @@ template<> PROTOBUF_NOINLINE ::chatservice::RefreshResponse*
 Arena::CreateMaybeMessage< ::chatservice::RefreshResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chatservice::RefreshResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chatservice::CommitRequest*
-Arena::CreateMaybeMessage< ::chatservice::CommitRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::chatservice::CommitRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::chatservice::CommitResponse*
-Arena::CreateMaybeMessage< ::chatservice::CommitResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::chatservice::CommitResponse >(arena);
-}
 template<> PROTOBUF_NOINLINE ::chatservice::HeartBeatRequest*
 Arena::CreateMaybeMessage< ::chatservice::HeartBeatRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chatservice::HeartBeatRequest >(arena);
@@ -8233,10 +9370,6 @@ template<> PROTOBUF_NOINLINE ::chatservice::LeaderElectionResponse*
 Arena::CreateMaybeMessage< ::chatservice::LeaderElectionResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chatservice::LeaderElectionResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chatservice::Operation*
-Arena::CreateMaybeMessage< ::chatservice::Operation >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::chatservice::Operation >(arena);
-}
 template<> PROTOBUF_NOINLINE ::chatservice::AddToPendingResponse*
 Arena::CreateMaybeMessage< ::chatservice::AddToPendingResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chatservice::AddToPendingResponse >(arena);
@@ -8245,6 +9378,38 @@ template<> PROTOBUF_NOINLINE ::chatservice::PendingLogRequest*
 Arena::CreateMaybeMessage< ::chatservice::PendingLogRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chatservice::PendingLogRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::chatservice::LogEntry*
+Arena::CreateMaybeMessage< ::chatservice::LogEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::LogEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::LogBlock*
+Arena::CreateMaybeMessage< ::chatservice::LogBlock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::LogBlock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::ReplicateRequest*
+Arena::CreateMaybeMessage< ::chatservice::ReplicateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::ReplicateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::ReplicateAck*
+Arena::CreateMaybeMessage< ::chatservice::ReplicateAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::ReplicateAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::SnapshotChunk*
+Arena::CreateMaybeMessage< ::chatservice::SnapshotChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::SnapshotChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::InstallSnapshotResponse*
+Arena::CreateMaybeMessage< ::chatservice::InstallSnapshotResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::InstallSnapshotResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::LogPositionRequest*
+Arena::CreateMaybeMessage< ::chatservice::LogPositionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::LogPositionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chatservice::LogPosition*
+Arena::CreateMaybeMessage< ::chatservice::LogPosition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chatservice::LogPosition >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
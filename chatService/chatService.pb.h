@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021006 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -55,12 +55,6 @@ extern CandidateValueDefaultTypeInternal _CandidateValue_default_instance_;
 class ChatMessage;
 struct ChatMessageDefaultTypeInternal;
 extern ChatMessageDefaultTypeInternal _ChatMessage_default_instance_;
-class CommitRequest;
-struct CommitRequestDefaultTypeInternal;
-extern CommitRequestDefaultTypeInternal _CommitRequest_default_instance_;
-class CommitResponse;
-struct CommitResponseDefaultTypeInternal;
-extern CommitResponseDefaultTypeInternal _CommitResponse_default_instance_;
 class CreateAccountMessage;
 struct CreateAccountMessageDefaultTypeInternal;
 extern CreateAccountMessageDefaultTypeInternal _CreateAccountMessage_default_instance_;
@@ -79,6 +73,9 @@ extern HeartBeatRequestDefaultTypeInternal _HeartBeatRequest_default_instance_;
 class HeartBeatResponse;
 struct HeartBeatResponseDefaultTypeInternal;
 extern HeartBeatResponseDefaultTypeInternal _HeartBeatResponse_default_instance_;
+class InstallSnapshotResponse;
+struct InstallSnapshotResponseDefaultTypeInternal;
+extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
 class LeaderElectionProposal;
 struct LeaderElectionProposalDefaultTypeInternal;
 extern LeaderElectionProposalDefaultTypeInternal _LeaderElectionProposal_default_instance_;
@@ -88,6 +85,18 @@ extern LeaderElectionProposalResponseDefaultTypeInternal _LeaderElectionProposal
 class LeaderElectionResponse;
 struct LeaderElectionResponseDefaultTypeInternal;
 extern LeaderElectionResponseDefaultTypeInternal _LeaderElectionResponse_default_instance_;
+class LogBlock;
+struct LogBlockDefaultTypeInternal;
+extern LogBlockDefaultTypeInternal _LogBlock_default_instance_;
+class LogEntry;
+struct LogEntryDefaultTypeInternal;
+extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+class LogPosition;
+struct LogPositionDefaultTypeInternal;
+extern LogPositionDefaultTypeInternal _LogPosition_default_instance_;
+class LogPositionRequest;
+struct LogPositionRequestDefaultTypeInternal;
+extern LogPositionRequestDefaultTypeInternal _LogPositionRequest_default_instance_;
 class LoginMessage;
 struct LoginMessageDefaultTypeInternal;
 extern LoginMessageDefaultTypeInternal _LoginMessage_default_instance_;
@@ -109,9 +118,6 @@ extern MessagesSeenReplyDefaultTypeInternal _MessagesSeenReply_default_instance_
 class Notification;
 struct NotificationDefaultTypeInternal;
 extern NotificationDefaultTypeInternal _Notification_default_instance_;
-class Operation;
-struct OperationDefaultTypeInternal;
-extern OperationDefaultTypeInternal _Operation_default_instance_;
 class PendingLogRequest;
 struct PendingLogRequestDefaultTypeInternal;
 extern PendingLogRequestDefaultTypeInternal _PendingLogRequest_default_instance_;
@@ -130,9 +136,18 @@ extern RefreshRequestDefaultTypeInternal _RefreshRequest_default_instance_;
 class RefreshResponse;
 struct RefreshResponseDefaultTypeInternal;
 extern RefreshResponseDefaultTypeInternal _RefreshResponse_default_instance_;
+class ReplicateAck;
+struct ReplicateAckDefaultTypeInternal;
+extern ReplicateAckDefaultTypeInternal _ReplicateAck_default_instance_;
+class ReplicateRequest;
+struct ReplicateRequestDefaultTypeInternal;
+extern ReplicateRequestDefaultTypeInternal _ReplicateRequest_default_instance_;
 class SendMessageReply;
 struct SendMessageReplyDefaultTypeInternal;
 extern SendMessageReplyDefaultTypeInternal _SendMessageReply_default_instance_;
+class SnapshotChunk;
+struct SnapshotChunkDefaultTypeInternal;
+extern SnapshotChunkDefaultTypeInternal _SnapshotChunk_default_instance_;
 class User;
 struct UserDefaultTypeInternal;
 extern UserDefaultTypeInternal _User_default_instance_;
@@ -141,17 +156,20 @@ PROTOBUF_NAMESPACE_OPEN
 template<> ::chatservice::AddToPendingResponse* Arena::CreateMaybeMessage<::chatservice::AddToPendingResponse>(Arena*);
 template<> ::chatservice::CandidateValue* Arena::CreateMaybeMessage<::chatservice::CandidateValue>(Arena*);
 template<> ::chatservice::ChatMessage* Arena::CreateMaybeMessage<::chatservice::ChatMessage>(Arena*);
-template<> ::chatservice::CommitRequest* Arena::CreateMaybeMessage<::chatservice::CommitRequest>(Arena*);
-template<> ::chatservice::CommitResponse* Arena::CreateMaybeMessage<::chatservice::CommitResponse>(Arena*);
 template<> ::chatservice::CreateAccountMessage* Arena::CreateMaybeMessage<::chatservice::CreateAccountMessage>(Arena*);
 template<> ::chatservice::CreateAccountReply* Arena::CreateMaybeMessage<::chatservice::CreateAccountReply>(Arena*);
 template<> ::chatservice::DeleteAccountMessage* Arena::CreateMaybeMessage<::chatservice::DeleteAccountMessage>(Arena*);
 template<> ::chatservice::DeleteAccountReply* Arena::CreateMaybeMessage<::chatservice::DeleteAccountReply>(Arena*);
 template<> ::chatservice::HeartBeatRequest* Arena::CreateMaybeMessage<::chatservice::HeartBeatRequest>(Arena*);
 template<> ::chatservice::HeartBeatResponse* Arena::CreateMaybeMessage<::chatservice::HeartBeatResponse>(Arena*);
+template<> ::chatservice::InstallSnapshotResponse* Arena::CreateMaybeMessage<::chatservice::InstallSnapshotResponse>(Arena*);
 template<> ::chatservice::LeaderElectionProposal* Arena::CreateMaybeMessage<::chatservice::LeaderElectionProposal>(Arena*);
 template<> ::chatservice::LeaderElectionProposalResponse* Arena::CreateMaybeMessage<::chatservice::LeaderElectionProposalResponse>(Arena*);
 template<> ::chatservice::LeaderElectionResponse* Arena::CreateMaybeMessage<::chatservice::LeaderElectionResponse>(Arena*);
+template<> ::chatservice::LogBlock* Arena::CreateMaybeMessage<::chatservice::LogBlock>(Arena*);
+template<> ::chatservice::LogEntry* Arena::CreateMaybeMessage<::chatservice::LogEntry>(Arena*);
+template<> ::chatservice::LogPosition* Arena::CreateMaybeMessage<::chatservice::LogPosition>(Arena*);
+template<> ::chatservice::LogPositionRequest* Arena::CreateMaybeMessage<::chatservice::LogPositionRequest>(Arena*);
 template<> ::chatservice::LoginMessage* Arena::CreateMaybeMessage<::chatservice::LoginMessage>(Arena*);
 template<> ::chatservice::LoginReply* Arena::CreateMaybeMessage<::chatservice::LoginReply>(Arena*);
 template<> ::chatservice::LogoutMessage* Arena::CreateMaybeMessage<::chatservice::LogoutMessage>(Arena*);
@@ -159,14 +177,16 @@ template<> ::chatservice::LogoutReply* Arena::CreateMaybeMessage<::chatservice::
 template<> ::chatservice::MessagesSeenMessage* Arena::CreateMaybeMessage<::chatservice::MessagesSeenMessage>(Arena*);
 template<> ::chatservice::MessagesSeenReply* Arena::CreateMaybeMessage<::chatservice::MessagesSeenReply>(Arena*);
 template<> ::chatservice::Notification* Arena::CreateMaybeMessage<::chatservice::Notification>(Arena*);
-template<> ::chatservice::Operation* Arena::CreateMaybeMessage<::chatservice::Operation>(Arena*);
 template<> ::chatservice::PendingLogRequest* Arena::CreateMaybeMessage<::chatservice::PendingLogRequest>(Arena*);
 template<> ::chatservice::QueryMessagesMessage* Arena::CreateMaybeMessage<::chatservice::QueryMessagesMessage>(Arena*);
 template<> ::chatservice::QueryNotificationsMessage* Arena::CreateMaybeMessage<::chatservice::QueryNotificationsMessage>(Arena*);
 template<> ::chatservice::QueryUsersMessage* Arena::CreateMaybeMessage<::chatservice::QueryUsersMessage>(Arena*);
 template<> ::chatservice::RefreshRequest* Arena::CreateMaybeMessage<::chatservice::RefreshRequest>(Arena*);
 template<> ::chatservice::RefreshResponse* Arena::CreateMaybeMessage<::chatservice::RefreshResponse>(Arena*);
+template<> ::chatservice::ReplicateAck* Arena::CreateMaybeMessage<::chatservice::ReplicateAck>(Arena*);
+template<> ::chatservice::ReplicateRequest* Arena::CreateMaybeMessage<::chatservice::ReplicateRequest>(Arena*);
 template<> ::chatservice::SendMessageReply* Arena::CreateMaybeMessage<::chatservice::SendMessageReply>(Arena*);
+template<> ::chatservice::SnapshotChunk* Arena::CreateMaybeMessage<::chatservice::SnapshotChunk>(Arena*);
 template<> ::chatservice::User* Arena::CreateMaybeMessage<::chatservice::User>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace chatservice {
@@ -1424,6 +1444,7 @@ class QueryUsersMessage final :
   enum : int {
     kUsernameFieldNumber = 1,
     kFromLeaderFieldNumber = 2,
+    kAllowStaleReadFieldNumber = 3,
   };
   // optional string username = 1;
   bool has_username() const;
@@ -1456,6 +1477,19 @@ class QueryUsersMessage final :
   void _internal_set_fromleader(bool value);
   public:
 
+  // optional bool allowStaleRead = 3;
+  bool has_allowstaleread() const;
+  private:
+  bool _internal_has_allowstaleread() const;
+  public:
+  void clear_allowstaleread();
+  bool allowstaleread() const;
+  void set_allowstaleread(bool value);
+  private:
+  bool _internal_allowstaleread() const;
+  void _internal_set_allowstaleread(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:chatservice.QueryUsersMessage)
  private:
   class _Internal;
@@ -1468,6 +1502,7 @@ class QueryUsersMessage final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
     bool fromleader_;
+    bool allowstaleread_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
@@ -2325,8 +2360,9 @@ class QueryMessagesMessage final :
   enum : int {
     kClientUsernameFieldNumber = 1,
     kOtherUsernameFieldNumber = 2,
-    kFromLeaderFieldNumber = 3,
     kClockValFieldNumber = 4,
+    kFromLeaderFieldNumber = 3,
+    kAllowStaleReadFieldNumber = 5,
   };
   // string clientUsername = 1;
   void clear_clientusername();
@@ -2356,6 +2392,15 @@ class QueryMessagesMessage final :
   std::string* _internal_mutable_otherusername();
   public:
 
+  // int32 clockVal = 4;
+  void clear_clockval();
+  int32_t clockval() const;
+  void set_clockval(int32_t value);
+  private:
+  int32_t _internal_clockval() const;
+  void _internal_set_clockval(int32_t value);
+  public:
+
   // optional bool fromLeader = 3;
   bool has_fromleader() const;
   private:
@@ -2369,13 +2414,17 @@ class QueryMessagesMessage final :
   void _internal_set_fromleader(bool value);
   public:
 
-  // int32 clockVal = 4;
-  void clear_clockval();
-  int32_t clockval() const;
-  void set_clockval(int32_t value);
+  // optional bool allowStaleRead = 5;
+  bool has_allowstaleread() const;
   private:
-  int32_t _internal_clockval() const;
-  void _internal_set_clockval(int32_t value);
+  bool _internal_has_allowstaleread() const;
+  public:
+  void clear_allowstaleread();
+  bool allowstaleread() const;
+  void set_allowstaleread(bool value);
+  private:
+  bool _internal_allowstaleread() const;
+  void _internal_set_allowstaleread(bool value);
   public:
 
   // @@protoc_insertion_point(class_scope:chatservice.QueryMessagesMessage)
@@ -2390,8 +2439,9 @@ class QueryMessagesMessage final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clientusername_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr otherusername_;
-    bool fromleader_;
     int32_t clockval_;
+    bool fromleader_;
+    bool allowstaleread_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
@@ -2525,6 +2575,7 @@ class ChatMessage final :
     kLeaderFieldNumber = 4,
     kFromLeaderFieldNumber = 5,
     kClockValFieldNumber = 6,
+    kMessageIndexFieldNumber = 7,
   };
   // string senderUsername = 1;
   void clear_senderusername();
@@ -2608,6 +2659,19 @@ class ChatMessage final :
   void _internal_set_clockval(int32_t value);
   public:
 
+  // optional int32 messageIndex = 7;
+  bool has_messageindex() const;
+  private:
+  bool _internal_has_messageindex() const;
+  public:
+  void clear_messageindex();
+  int32_t messageindex() const;
+  void set_messageindex(int32_t value);
+  private:
+  int32_t _internal_messageindex() const;
+  void _internal_set_messageindex(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:chatservice.ChatMessage)
  private:
   class _Internal;
@@ -2624,6 +2688,7 @@ class ChatMessage final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_;
     bool fromleader_;
     int32_t clockval_;
+    int32_t messageindex_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
@@ -3141,6 +3206,7 @@ class MessagesSeenMessage final :
     kMessagesSeenFieldNumber = 3,
     kFromLeaderFieldNumber = 4,
     kClockValFieldNumber = 5,
+    kFirstMessageIndexFieldNumber = 6,
   };
   // string clientUsername = 1;
   void clear_clientusername();
@@ -3201,6 +3267,19 @@ class MessagesSeenMessage final :
   void _internal_set_clockval(int32_t value);
   public:
 
+  // optional int32 firstMessageIndex = 6;
+  bool has_firstmessageindex() const;
+  private:
+  bool _internal_has_firstmessageindex() const;
+  public:
+  void clear_firstmessageindex();
+  int32_t firstmessageindex() const;
+  void set_firstmessageindex(int32_t value);
+  private:
+  int32_t _internal_firstmessageindex() const;
+  void _internal_set_firstmessageindex(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:chatservice.MessagesSeenMessage)
  private:
   class _Internal;
@@ -3216,6 +3295,7 @@ class MessagesSeenMessage final :
     int32_t messagesseen_;
     bool fromleader_;
     int32_t clockval_;
+    int32_t firstmessageindex_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
@@ -3738,242 +3818,6 @@ class RefreshResponse final :
 };
 // -------------------------------------------------------------------
 
-class CommitRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.CommitRequest) */ {
- public:
-  inline CommitRequest() : CommitRequest(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR CommitRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  CommitRequest(const CommitRequest& from);
-  CommitRequest(CommitRequest&& from) noexcept
-    : CommitRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline CommitRequest& operator=(const CommitRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CommitRequest& operator=(CommitRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CommitRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CommitRequest* internal_default_instance() {
-    return reinterpret_cast<const CommitRequest*>(
-               &_CommitRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    19;
-
-  friend void swap(CommitRequest& a, CommitRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(CommitRequest* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CommitRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CommitRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<CommitRequest>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const CommitRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const CommitRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
-  }
-  public:
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chatservice.CommitRequest";
-  }
-  protected:
-  explicit CommitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // @@protoc_insertion_point(class_scope:chatservice.CommitRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-  };
-  friend struct ::TableStruct_chatService_2eproto;
-};
-// -------------------------------------------------------------------
-
-class CommitResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.CommitResponse) */ {
- public:
-  inline CommitResponse() : CommitResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR CommitResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  CommitResponse(const CommitResponse& from);
-  CommitResponse(CommitResponse&& from) noexcept
-    : CommitResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline CommitResponse& operator=(const CommitResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline CommitResponse& operator=(CommitResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const CommitResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const CommitResponse* internal_default_instance() {
-    return reinterpret_cast<const CommitResponse*>(
-               &_CommitResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    20;
-
-  friend void swap(CommitResponse& a, CommitResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(CommitResponse* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(CommitResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  CommitResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<CommitResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const CommitResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const CommitResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
-  }
-  public:
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chatservice.CommitResponse";
-  }
-  protected:
-  explicit CommitResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // @@protoc_insertion_point(class_scope:chatservice.CommitResponse)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-  };
-  friend struct ::TableStruct_chatService_2eproto;
-};
-// -------------------------------------------------------------------
-
 class HeartBeatRequest final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.HeartBeatRequest) */ {
  public:
@@ -4021,7 +3865,7 @@ class HeartBeatRequest final :
                &_HeartBeatRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    19;
 
   friend void swap(HeartBeatRequest& a, HeartBeatRequest& b) {
     a.Swap(&b);
@@ -4140,7 +3984,7 @@ class HeartBeatResponse final :
                &_HeartBeatResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    22;
+    20;
 
   friend void swap(HeartBeatResponse& a, HeartBeatResponse& b) {
     a.Swap(&b);
@@ -4287,7 +4131,7 @@ class LeaderElectionProposal final :
                &_LeaderElectionProposal_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    23;
+    21;
 
   friend void swap(LeaderElectionProposal& a, LeaderElectionProposal& b) {
     a.Swap(&b);
@@ -4406,7 +4250,7 @@ class LeaderElectionProposalResponse final :
                &_LeaderElectionProposalResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    22;
 
   friend void swap(LeaderElectionProposalResponse& a, LeaderElectionProposalResponse& b) {
     a.Swap(&b);
@@ -4570,7 +4414,7 @@ class CandidateValue final :
                &_CandidateValue_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    23;
 
   friend void swap(CandidateValue& a, CandidateValue& b) {
     a.Swap(&b);
@@ -4644,7 +4488,8 @@ class CandidateValue final :
 
   enum : int {
     kAddressFieldNumber = 2,
-    kNumberFieldNumber = 1,
+    kLastIndexFieldNumber = 3,
+    kCommitIndexFieldNumber = 4,
   };
   // string address = 2;
   void clear_address();
@@ -4660,13 +4505,22 @@ class CandidateValue final :
   std::string* _internal_mutable_address();
   public:
 
-  // int32 number = 1;
-  void clear_number();
-  int32_t number() const;
-  void set_number(int32_t value);
+  // uint64 lastIndex = 3;
+  void clear_lastindex();
+  uint64_t lastindex() const;
+  void set_lastindex(uint64_t value);
   private:
-  int32_t _internal_number() const;
-  void _internal_set_number(int32_t value);
+  uint64_t _internal_lastindex() const;
+  void _internal_set_lastindex(uint64_t value);
+  public:
+
+  // uint64 commitIndex = 4;
+  void clear_commitindex();
+  uint64_t commitindex() const;
+  void set_commitindex(uint64_t value);
+  private:
+  uint64_t _internal_commitindex() const;
+  void _internal_set_commitindex(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:chatservice.CandidateValue)
@@ -4678,7 +4532,8 @@ class CandidateValue final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
-    int32_t number_;
+    uint64_t lastindex_;
+    uint64_t commitindex_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4733,7 +4588,7 @@ class LeaderElectionResponse final :
                &_LeaderElectionResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    24;
 
   friend void swap(LeaderElectionResponse& a, LeaderElectionResponse& b) {
     a.Swap(&b);
@@ -4804,24 +4659,23 @@ class LeaderElectionResponse final :
 };
 // -------------------------------------------------------------------
 
-class Operation final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.Operation) */ {
+class AddToPendingResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.AddToPendingResponse) */ {
  public:
-  inline Operation() : Operation(nullptr) {}
-  ~Operation() override;
-  explicit PROTOBUF_CONSTEXPR Operation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AddToPendingResponse() : AddToPendingResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Operation(const Operation& from);
-  Operation(Operation&& from) noexcept
-    : Operation() {
+  AddToPendingResponse(const AddToPendingResponse& from);
+  AddToPendingResponse(AddToPendingResponse&& from) noexcept
+    : AddToPendingResponse() {
     *this = ::std::move(from);
   }
 
-  inline Operation& operator=(const Operation& from) {
+  inline AddToPendingResponse& operator=(const AddToPendingResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Operation& operator=(Operation&& from) noexcept {
+  inline AddToPendingResponse& operator=(AddToPendingResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4844,20 +4698,934 @@ class Operation final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Operation& default_instance() {
+  static const AddToPendingResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Operation* internal_default_instance() {
-    return reinterpret_cast<const Operation*>(
-               &_Operation_default_instance_);
+  static inline const AddToPendingResponse* internal_default_instance() {
+    return reinterpret_cast<const AddToPendingResponse*>(
+               &_AddToPendingResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    27;
+    25;
 
-  friend void swap(Operation& a, Operation& b) {
+  friend void swap(AddToPendingResponse& a, AddToPendingResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AddToPendingResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AddToPendingResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AddToPendingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AddToPendingResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const AddToPendingResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const AddToPendingResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.AddToPendingResponse";
+  }
+  protected:
+  explicit AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chatservice.AddToPendingResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PendingLogRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.PendingLogRequest) */ {
+ public:
+  inline PendingLogRequest() : PendingLogRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PendingLogRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PendingLogRequest(const PendingLogRequest& from);
+  PendingLogRequest(PendingLogRequest&& from) noexcept
+    : PendingLogRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PendingLogRequest& operator=(const PendingLogRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PendingLogRequest& operator=(PendingLogRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PendingLogRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PendingLogRequest* internal_default_instance() {
+    return reinterpret_cast<const PendingLogRequest*>(
+               &_PendingLogRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(PendingLogRequest& a, PendingLogRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PendingLogRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PendingLogRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PendingLogRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PendingLogRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PendingLogRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PendingLogRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.PendingLogRequest";
+  }
+  protected:
+  explicit PendingLogRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chatservice.PendingLogRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.LogEntry) */ {
+ public:
+  inline LogEntry() : LogEntry(nullptr) {}
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogEntry(const LogEntry& from);
+  LogEntry(LogEntry&& from) noexcept
+    : LogEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline LogEntry& operator=(const LogEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogEntry& operator=(LogEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogEntry* internal_default_instance() {
+    return reinterpret_cast<const LogEntry*>(
+               &_LogEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(LogEntry& a, LogEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.LogEntry";
+  }
+  protected:
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 3,
+    kIndexFieldNumber = 1,
+  };
+  // bytes operation = 3;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // uint64 index = 1;
+  void clear_index();
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chatservice.LogEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    uint64_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogBlock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.LogBlock) */ {
+ public:
+  inline LogBlock() : LogBlock(nullptr) {}
+  ~LogBlock() override;
+  explicit PROTOBUF_CONSTEXPR LogBlock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogBlock(const LogBlock& from);
+  LogBlock(LogBlock&& from) noexcept
+    : LogBlock() {
+    *this = ::std::move(from);
+  }
+
+  inline LogBlock& operator=(const LogBlock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogBlock& operator=(LogBlock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogBlock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogBlock* internal_default_instance() {
+    return reinterpret_cast<const LogBlock*>(
+               &_LogBlock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(LogBlock& a, LogBlock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogBlock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogBlock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogBlock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogBlock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogBlock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogBlock& from) {
+    LogBlock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogBlock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.LogBlock";
+  }
+  protected:
+  explicit LogBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kFirstIndexFieldNumber = 1,
+    kRawLengthFieldNumber = 2,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint64 firstIndex = 1;
+  void clear_firstindex();
+  uint64_t firstindex() const;
+  void set_firstindex(uint64_t value);
+  private:
+  uint64_t _internal_firstindex() const;
+  void _internal_set_firstindex(uint64_t value);
+  public:
+
+  // uint32 rawLength = 2;
+  void clear_rawlength();
+  uint32_t rawlength() const;
+  void set_rawlength(uint32_t value);
+  private:
+  uint32_t _internal_rawlength() const;
+  void _internal_set_rawlength(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chatservice.LogBlock)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t firstindex_;
+    uint32_t rawlength_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.ReplicateRequest) */ {
+ public:
+  inline ReplicateRequest() : ReplicateRequest(nullptr) {}
+  ~ReplicateRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReplicateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicateRequest(const ReplicateRequest& from);
+  ReplicateRequest(ReplicateRequest&& from) noexcept
+    : ReplicateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicateRequest& operator=(const ReplicateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicateRequest& operator=(ReplicateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicateRequest* internal_default_instance() {
+    return reinterpret_cast<const ReplicateRequest*>(
+               &_ReplicateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ReplicateRequest& a, ReplicateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicateRequest& from) {
+    ReplicateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.ReplicateRequest";
+  }
+  protected:
+  explicit ReplicateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+    kCommitIndexFieldNumber = 2,
+  };
+  // repeated .chatservice.LogEntry entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::chatservice::LogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chatservice::LogEntry >*
+      mutable_entries();
+  private:
+  const ::chatservice::LogEntry& _internal_entries(int index) const;
+  ::chatservice::LogEntry* _internal_add_entries();
+  public:
+  const ::chatservice::LogEntry& entries(int index) const;
+  ::chatservice::LogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chatservice::LogEntry >&
+      entries() const;
+
+  // uint64 commitIndex = 2;
+  void clear_commitindex();
+  uint64_t commitindex() const;
+  void set_commitindex(uint64_t value);
+  private:
+  uint64_t _internal_commitindex() const;
+  void _internal_set_commitindex(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chatservice.ReplicateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chatservice::LogEntry > entries_;
+    uint64_t commitindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicateAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.ReplicateAck) */ {
+ public:
+  inline ReplicateAck() : ReplicateAck(nullptr) {}
+  ~ReplicateAck() override;
+  explicit PROTOBUF_CONSTEXPR ReplicateAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicateAck(const ReplicateAck& from);
+  ReplicateAck(ReplicateAck&& from) noexcept
+    : ReplicateAck() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicateAck& operator=(const ReplicateAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicateAck& operator=(ReplicateAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicateAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicateAck* internal_default_instance() {
+    return reinterpret_cast<const ReplicateAck*>(
+               &_ReplicateAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(ReplicateAck& a, ReplicateAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicateAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicateAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicateAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicateAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicateAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicateAck& from) {
+    ReplicateAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicateAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.ReplicateAck";
+  }
+  protected:
+  explicit ReplicateAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastIndexFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kNeedsSnapshotFieldNumber = 3,
+  };
+  // uint64 lastIndex = 1;
+  void clear_lastindex();
+  uint64_t lastindex() const;
+  void set_lastindex(uint64_t value);
+  private:
+  uint64_t _internal_lastindex() const;
+  void _internal_set_lastindex(uint64_t value);
+  public:
+
+  // bool success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // bool needsSnapshot = 3;
+  void clear_needssnapshot();
+  bool needssnapshot() const;
+  void set_needssnapshot(bool value);
+  private:
+  bool _internal_needssnapshot() const;
+  void _internal_set_needssnapshot(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chatservice.ReplicateAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t lastindex_;
+    bool success_;
+    bool needssnapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SnapshotChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.SnapshotChunk) */ {
+ public:
+  inline SnapshotChunk() : SnapshotChunk(nullptr) {}
+  ~SnapshotChunk() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SnapshotChunk(const SnapshotChunk& from);
+  SnapshotChunk(SnapshotChunk&& from) noexcept
+    : SnapshotChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline SnapshotChunk& operator=(const SnapshotChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotChunk& operator=(SnapshotChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SnapshotChunk* internal_default_instance() {
+    return reinterpret_cast<const SnapshotChunk*>(
+               &_SnapshotChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(SnapshotChunk& a, SnapshotChunk& b) {
     a.Swap(&b);
   }
-  inline void Swap(Operation* other) {
+  inline void Swap(SnapshotChunk* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4870,7 +5638,7 @@ class Operation final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Operation* other) {
+  void UnsafeArenaSwap(SnapshotChunk* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4878,14 +5646,14 @@ class Operation final :
 
   // implements Message ----------------------------------------------
 
-  Operation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Operation>(arena);
+  SnapshotChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotChunk>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Operation& from);
+  void CopyFrom(const SnapshotChunk& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Operation& from) {
-    Operation::MergeImpl(*this, from);
+  void MergeFrom( const SnapshotChunk& from) {
+    SnapshotChunk::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4903,15 +5671,15 @@ class Operation final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Operation* other);
+  void InternalSwap(SnapshotChunk* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chatservice.Operation";
+    return "chatservice.SnapshotChunk";
   }
   protected:
-  explicit Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SnapshotChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4925,128 +5693,144 @@ class Operation final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageTypeFieldNumber = 1,
-    kUsername1FieldNumber = 2,
-    kUsername2FieldNumber = 3,
-    kPasswordFieldNumber = 4,
-    kMessageContentFieldNumber = 5,
-    kMessagesseenFieldNumber = 6,
-    kLeaderFieldNumber = 7,
-    kClockValFieldNumber = 8,
+    kDataFieldNumber = 1,
   };
-  // string message_type = 1;
-  void clear_message_type();
-  const std::string& message_type() const;
+  // bytes data = 1;
+  void clear_data();
+  const std::string& data() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_type(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_type();
-  PROTOBUF_NODISCARD std::string* release_message_type();
-  void set_allocated_message_type(std::string* message_type);
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  const std::string& _internal_message_type() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_type(const std::string& value);
-  std::string* _internal_mutable_message_type();
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
 
-  // string username1 = 2;
-  void clear_username1();
-  const std::string& username1() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_username1(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_username1();
-  PROTOBUF_NODISCARD std::string* release_username1();
-  void set_allocated_username1(std::string* username1);
-  private:
-  const std::string& _internal_username1() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username1(const std::string& value);
-  std::string* _internal_mutable_username1();
-  public:
+  // @@protoc_insertion_point(class_scope:chatservice.SnapshotChunk)
+ private:
+  class _Internal;
 
-  // string username2 = 3;
-  void clear_username2();
-  const std::string& username2() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_username2(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_username2();
-  PROTOBUF_NODISCARD std::string* release_username2();
-  void set_allocated_username2(std::string* username2);
-  private:
-  const std::string& _internal_username2() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username2(const std::string& value);
-  std::string* _internal_mutable_username2();
-  public:
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chatService_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // string password = 4;
-  void clear_password();
-  const std::string& password() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_password(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_password();
-  PROTOBUF_NODISCARD std::string* release_password();
-  void set_allocated_password(std::string* password);
-  private:
-  const std::string& _internal_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
-  std::string* _internal_mutable_password();
-  public:
+class InstallSnapshotResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.InstallSnapshotResponse) */ {
+ public:
+  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  // string message_content = 5;
-  void clear_message_content();
-  const std::string& message_content() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_content(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_content();
-  PROTOBUF_NODISCARD std::string* release_message_content();
-  void set_allocated_message_content(std::string* message_content);
-  private:
-  const std::string& _internal_message_content() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_content(const std::string& value);
-  std::string* _internal_mutable_message_content();
-  public:
+  InstallSnapshotResponse(const InstallSnapshotResponse& from);
+  InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
+    : InstallSnapshotResponse() {
+    *this = ::std::move(from);
+  }
 
-  // string messagesseen = 6;
-  void clear_messagesseen();
-  const std::string& messagesseen() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_messagesseen(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_messagesseen();
-  PROTOBUF_NODISCARD std::string* release_messagesseen();
-  void set_allocated_messagesseen(std::string* messagesseen);
-  private:
-  const std::string& _internal_messagesseen() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_messagesseen(const std::string& value);
-  std::string* _internal_mutable_messagesseen();
-  public:
+  inline InstallSnapshotResponse& operator=(const InstallSnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  // string leader = 7;
-  void clear_leader();
-  const std::string& leader() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leader(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leader();
-  PROTOBUF_NODISCARD std::string* release_leader();
-  void set_allocated_leader(std::string* leader);
-  private:
-  const std::string& _internal_leader() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader(const std::string& value);
-  std::string* _internal_mutable_leader();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstallSnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const InstallSnapshotResponse*>(
+               &_InstallSnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstallSnapshotResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const InstallSnapshotResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const InstallSnapshotResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
   public:
 
-  // string clockVal = 8;
-  void clear_clockval();
-  const std::string& clockval() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_clockval(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_clockval();
-  PROTOBUF_NODISCARD std::string* release_clockval();
-  void set_allocated_clockval(std::string* clockval);
   private:
-  const std::string& _internal_clockval() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clockval(const std::string& value);
-  std::string* _internal_mutable_clockval();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chatservice.InstallSnapshotResponse";
+  }
+  protected:
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  // @@protoc_insertion_point(class_scope:chatservice.Operation)
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chatservice.InstallSnapshotResponse)
  private:
   class _Internal;
 
@@ -5054,38 +5838,28 @@ class Operation final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_type_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username1_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username2_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_content_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr messagesseen_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clockval_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AddToPendingResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.AddToPendingResponse) */ {
+class LogPositionRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.LogPositionRequest) */ {
  public:
-  inline AddToPendingResponse() : AddToPendingResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline LogPositionRequest() : LogPositionRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR LogPositionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AddToPendingResponse(const AddToPendingResponse& from);
-  AddToPendingResponse(AddToPendingResponse&& from) noexcept
-    : AddToPendingResponse() {
+  LogPositionRequest(const LogPositionRequest& from);
+  LogPositionRequest(LogPositionRequest&& from) noexcept
+    : LogPositionRequest() {
     *this = ::std::move(from);
   }
 
-  inline AddToPendingResponse& operator=(const AddToPendingResponse& from) {
+  inline LogPositionRequest& operator=(const LogPositionRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AddToPendingResponse& operator=(AddToPendingResponse&& from) noexcept {
+  inline LogPositionRequest& operator=(LogPositionRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5108,20 +5882,20 @@ class AddToPendingResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AddToPendingResponse& default_instance() {
+  static const LogPositionRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AddToPendingResponse* internal_default_instance() {
-    return reinterpret_cast<const AddToPendingResponse*>(
-               &_AddToPendingResponse_default_instance_);
+  static inline const LogPositionRequest* internal_default_instance() {
+    return reinterpret_cast<const LogPositionRequest*>(
+               &_LogPositionRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    28;
+    33;
 
-  friend void swap(AddToPendingResponse& a, AddToPendingResponse& b) {
+  friend void swap(LogPositionRequest& a, LogPositionRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(AddToPendingResponse* other) {
+  inline void Swap(LogPositionRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5134,7 +5908,7 @@ class AddToPendingResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AddToPendingResponse* other) {
+  void UnsafeArenaSwap(LogPositionRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5142,15 +5916,15 @@ class AddToPendingResponse final :
 
   // implements Message ----------------------------------------------
 
-  AddToPendingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AddToPendingResponse>(arena);
+  LogPositionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogPositionRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const AddToPendingResponse& from) {
+  inline void CopyFrom(const LogPositionRequest& from) {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const AddToPendingResponse& from) {
+  void MergeFrom(const LogPositionRequest& from) {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
@@ -5158,10 +5932,10 @@ class AddToPendingResponse final :
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chatservice.AddToPendingResponse";
+    return "chatservice.LogPositionRequest";
   }
   protected:
-  explicit AddToPendingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit LogPositionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5174,7 +5948,7 @@ class AddToPendingResponse final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:chatservice.AddToPendingResponse)
+  // @@protoc_insertion_point(class_scope:chatservice.LogPositionRequest)
  private:
   class _Internal;
 
@@ -5187,23 +5961,24 @@ class AddToPendingResponse final :
 };
 // -------------------------------------------------------------------
 
-class PendingLogRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chatservice.PendingLogRequest) */ {
+class LogPosition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chatservice.LogPosition) */ {
  public:
-  inline PendingLogRequest() : PendingLogRequest(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR PendingLogRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline LogPosition() : LogPosition(nullptr) {}
+  ~LogPosition() override;
+  explicit PROTOBUF_CONSTEXPR LogPosition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PendingLogRequest(const PendingLogRequest& from);
-  PendingLogRequest(PendingLogRequest&& from) noexcept
-    : PendingLogRequest() {
+  LogPosition(const LogPosition& from);
+  LogPosition(LogPosition&& from) noexcept
+    : LogPosition() {
     *this = ::std::move(from);
   }
 
-  inline PendingLogRequest& operator=(const PendingLogRequest& from) {
+  inline LogPosition& operator=(const LogPosition& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PendingLogRequest& operator=(PendingLogRequest&& from) noexcept {
+  inline LogPosition& operator=(LogPosition&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5226,20 +6001,20 @@ class PendingLogRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const PendingLogRequest& default_instance() {
+  static const LogPosition& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PendingLogRequest* internal_default_instance() {
-    return reinterpret_cast<const PendingLogRequest*>(
-               &_PendingLogRequest_default_instance_);
+  static inline const LogPosition* internal_default_instance() {
+    return reinterpret_cast<const LogPosition*>(
+               &_LogPosition_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    29;
+    34;
 
-  friend void swap(PendingLogRequest& a, PendingLogRequest& b) {
+  friend void swap(LogPosition& a, LogPosition& b) {
     a.Swap(&b);
   }
-  inline void Swap(PendingLogRequest* other) {
+  inline void Swap(LogPosition* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5252,7 +6027,7 @@ class PendingLogRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PendingLogRequest* other) {
+  void UnsafeArenaSwap(LogPosition* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5260,39 +6035,95 @@ class PendingLogRequest final :
 
   // implements Message ----------------------------------------------
 
-  PendingLogRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PendingLogRequest>(arena);
+  LogPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogPosition>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const PendingLogRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const PendingLogRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogPosition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogPosition& from) {
+    LogPosition::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogPosition* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chatservice.PendingLogRequest";
+    return "chatservice.LogPosition";
   }
   protected:
-  explicit PendingLogRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit LogPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedIndexFieldNumber = 1,
+    kClockValFieldNumber = 2,
+    kHasAppliedChecksumFieldNumber = 3,
+    kAppliedChecksumFieldNumber = 4,
+  };
+  // uint64 appliedIndex = 1;
+  void clear_appliedindex();
+  uint64_t appliedindex() const;
+  void set_appliedindex(uint64_t value);
+  private:
+  uint64_t _internal_appliedindex() const;
+  void _internal_set_appliedindex(uint64_t value);
+  public:
+
+  // int64 clockVal = 2;
+  void clear_clockval();
+  int64_t clockval() const;
+  void set_clockval(int64_t value);
+  private:
+  int64_t _internal_clockval() const;
+  void _internal_set_clockval(int64_t value);
+  public:
 
-  // nested types ----------------------------------------------------
+  // bool hasAppliedChecksum = 3;
+  void clear_hasappliedchecksum();
+  bool hasappliedchecksum() const;
+  void set_hasappliedchecksum(bool value);
+  private:
+  bool _internal_hasappliedchecksum() const;
+  void _internal_set_hasappliedchecksum(bool value);
+  public:
 
-  // accessors -------------------------------------------------------
+  // uint32 appliedChecksum = 4;
+  void clear_appliedchecksum();
+  uint32_t appliedchecksum() const;
+  void set_appliedchecksum(uint32_t value);
+  private:
+  uint32_t _internal_appliedchecksum() const;
+  void _internal_set_appliedchecksum(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:chatservice.PendingLogRequest)
+  // @@protoc_insertion_point(class_scope:chatservice.LogPosition)
  private:
   class _Internal;
 
@@ -5300,7 +6131,13 @@ class PendingLogRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    uint64_t appliedindex_;
+    int64_t clockval_;
+    bool hasappliedchecksum_;
+    uint32_t appliedchecksum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chatService_2eproto;
 };
 // ===================================================================
@@ -6276,6 +7113,34 @@ inline void QueryUsersMessage::set_fromleader(bool value) {
   // @@protoc_insertion_point(field_set:chatservice.QueryUsersMessage.fromLeader)
 }
 
+// optional bool allowStaleRead = 3;
+inline bool QueryUsersMessage::_internal_has_allowstaleread() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool QueryUsersMessage::has_allowstaleread() const {
+  return _internal_has_allowstaleread();
+}
+inline void QueryUsersMessage::clear_allowstaleread() {
+  _impl_.allowstaleread_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool QueryUsersMessage::_internal_allowstaleread() const {
+  return _impl_.allowstaleread_;
+}
+inline bool QueryUsersMessage::allowstaleread() const {
+  // @@protoc_insertion_point(field_get:chatservice.QueryUsersMessage.allowStaleRead)
+  return _internal_allowstaleread();
+}
+inline void QueryUsersMessage::_internal_set_allowstaleread(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.allowstaleread_ = value;
+}
+inline void QueryUsersMessage::set_allowstaleread(bool value) {
+  _internal_set_allowstaleread(value);
+  // @@protoc_insertion_point(field_set:chatservice.QueryUsersMessage.allowStaleRead)
+}
+
 // -------------------------------------------------------------------
 
 // User
@@ -6954,6 +7819,34 @@ inline void QueryMessagesMessage::set_clockval(int32_t value) {
   // @@protoc_insertion_point(field_set:chatservice.QueryMessagesMessage.clockVal)
 }
 
+// optional bool allowStaleRead = 5;
+inline bool QueryMessagesMessage::_internal_has_allowstaleread() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool QueryMessagesMessage::has_allowstaleread() const {
+  return _internal_has_allowstaleread();
+}
+inline void QueryMessagesMessage::clear_allowstaleread() {
+  _impl_.allowstaleread_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool QueryMessagesMessage::_internal_allowstaleread() const {
+  return _impl_.allowstaleread_;
+}
+inline bool QueryMessagesMessage::allowstaleread() const {
+  // @@protoc_insertion_point(field_get:chatservice.QueryMessagesMessage.allowStaleRead)
+  return _internal_allowstaleread();
+}
+inline void QueryMessagesMessage::_internal_set_allowstaleread(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.allowstaleread_ = value;
+}
+inline void QueryMessagesMessage::set_allowstaleread(bool value) {
+  _internal_set_allowstaleread(value);
+  // @@protoc_insertion_point(field_set:chatservice.QueryMessagesMessage.allowStaleRead)
+}
+
 // -------------------------------------------------------------------
 
 // ChatMessage
@@ -7224,6 +8117,34 @@ inline void ChatMessage::set_clockval(int32_t value) {
   // @@protoc_insertion_point(field_set:chatservice.ChatMessage.clockVal)
 }
 
+// optional int32 messageIndex = 7;
+inline bool ChatMessage::_internal_has_messageindex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ChatMessage::has_messageindex() const {
+  return _internal_has_messageindex();
+}
+inline void ChatMessage::clear_messageindex() {
+  _impl_.messageindex_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t ChatMessage::_internal_messageindex() const {
+  return _impl_.messageindex_;
+}
+inline int32_t ChatMessage::messageindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.ChatMessage.messageIndex)
+  return _internal_messageindex();
+}
+inline void ChatMessage::_internal_set_messageindex(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.messageindex_ = value;
+}
+inline void ChatMessage::set_messageindex(int32_t value) {
+  _internal_set_messageindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.ChatMessage.messageIndex)
+}
+
 // -------------------------------------------------------------------
 
 // DeleteAccountMessage
@@ -7708,6 +8629,34 @@ inline void MessagesSeenMessage::set_clockval(int32_t value) {
   // @@protoc_insertion_point(field_set:chatservice.MessagesSeenMessage.clockVal)
 }
 
+// optional int32 firstMessageIndex = 6;
+inline bool MessagesSeenMessage::_internal_has_firstmessageindex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MessagesSeenMessage::has_firstmessageindex() const {
+  return _internal_has_firstmessageindex();
+}
+inline void MessagesSeenMessage::clear_firstmessageindex() {
+  _impl_.firstmessageindex_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t MessagesSeenMessage::_internal_firstmessageindex() const {
+  return _impl_.firstmessageindex_;
+}
+inline int32_t MessagesSeenMessage::firstmessageindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.MessagesSeenMessage.firstMessageIndex)
+  return _internal_firstmessageindex();
+}
+inline void MessagesSeenMessage::_internal_set_firstmessageindex(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.firstmessageindex_ = value;
+}
+inline void MessagesSeenMessage::set_firstmessageindex(int32_t value) {
+  _internal_set_firstmessageindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.MessagesSeenMessage.firstMessageIndex)
+}
+
 // -------------------------------------------------------------------
 
 // MessagesSeenReply
@@ -7996,14 +8945,6 @@ inline void RefreshResponse::set_allocated_leader(std::string* leader) {
 
 // -------------------------------------------------------------------
 
-// CommitRequest
-
-// -------------------------------------------------------------------
-
-// CommitResponse
-
-// -------------------------------------------------------------------
-
 // HeartBeatRequest
 
 // -------------------------------------------------------------------
@@ -8112,26 +9053,6 @@ inline void LeaderElectionProposalResponse::set_allocated_leader(std::string* le
 
 // CandidateValue
 
-// int32 number = 1;
-inline void CandidateValue::clear_number() {
-  _impl_.number_ = 0;
-}
-inline int32_t CandidateValue::_internal_number() const {
-  return _impl_.number_;
-}
-inline int32_t CandidateValue::number() const {
-  // @@protoc_insertion_point(field_get:chatservice.CandidateValue.number)
-  return _internal_number();
-}
-inline void CandidateValue::_internal_set_number(int32_t value) {
-  
-  _impl_.number_ = value;
-}
-inline void CandidateValue::set_number(int32_t value) {
-  _internal_set_number(value);
-  // @@protoc_insertion_point(field_set:chatservice.CandidateValue.number)
-}
-
 // string address = 2;
 inline void CandidateValue::clear_address() {
   _impl_.address_.ClearToEmpty();
@@ -8182,425 +9103,513 @@ inline void CandidateValue::set_allocated_address(std::string* address) {
   // @@protoc_insertion_point(field_set_allocated:chatservice.CandidateValue.address)
 }
 
+// uint64 lastIndex = 3;
+inline void CandidateValue::clear_lastindex() {
+  _impl_.lastindex_ = uint64_t{0u};
+}
+inline uint64_t CandidateValue::_internal_lastindex() const {
+  return _impl_.lastindex_;
+}
+inline uint64_t CandidateValue::lastindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.CandidateValue.lastIndex)
+  return _internal_lastindex();
+}
+inline void CandidateValue::_internal_set_lastindex(uint64_t value) {
+  
+  _impl_.lastindex_ = value;
+}
+inline void CandidateValue::set_lastindex(uint64_t value) {
+  _internal_set_lastindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.CandidateValue.lastIndex)
+}
+
+// uint64 commitIndex = 4;
+inline void CandidateValue::clear_commitindex() {
+  _impl_.commitindex_ = uint64_t{0u};
+}
+inline uint64_t CandidateValue::_internal_commitindex() const {
+  return _impl_.commitindex_;
+}
+inline uint64_t CandidateValue::commitindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.CandidateValue.commitIndex)
+  return _internal_commitindex();
+}
+inline void CandidateValue::_internal_set_commitindex(uint64_t value) {
+  
+  _impl_.commitindex_ = value;
+}
+inline void CandidateValue::set_commitindex(uint64_t value) {
+  _internal_set_commitindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.CandidateValue.commitIndex)
+}
+
 // -------------------------------------------------------------------
 
 // LeaderElectionResponse
 
 // -------------------------------------------------------------------
 
-// Operation
+// AddToPendingResponse
+
+// -------------------------------------------------------------------
+
+// PendingLogRequest
+
+// -------------------------------------------------------------------
+
+// LogEntry
+
+// uint64 index = 1;
+inline void LogEntry::clear_index() {
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t LogEntry::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint64_t LogEntry::index() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogEntry.index)
+  return _internal_index();
+}
+inline void LogEntry::_internal_set_index(uint64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void LogEntry::set_index(uint64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogEntry.index)
+}
 
-// string message_type = 1;
-inline void Operation::clear_message_type() {
-  _impl_.message_type_.ClearToEmpty();
+// bytes operation = 3;
+inline void LogEntry::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
 }
-inline const std::string& Operation::message_type() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.message_type)
-  return _internal_message_type();
+inline const std::string& LogEntry::operation() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogEntry.operation)
+  return _internal_operation();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_message_type(ArgT0&& arg0, ArgT... args) {
+void LogEntry::set_operation(ArgT0&& arg0, ArgT... args) {
  
- _impl_.message_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.message_type)
+ _impl_.operation_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chatservice.LogEntry.operation)
 }
-inline std::string* Operation::mutable_message_type() {
-  std::string* _s = _internal_mutable_message_type();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.message_type)
+inline std::string* LogEntry::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:chatservice.LogEntry.operation)
   return _s;
 }
-inline const std::string& Operation::_internal_message_type() const {
-  return _impl_.message_type_.Get();
+inline const std::string& LogEntry::_internal_operation() const {
+  return _impl_.operation_.Get();
 }
-inline void Operation::_internal_set_message_type(const std::string& value) {
+inline void LogEntry::_internal_set_operation(const std::string& value) {
   
-  _impl_.message_type_.Set(value, GetArenaForAllocation());
+  _impl_.operation_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Operation::_internal_mutable_message_type() {
+inline std::string* LogEntry::_internal_mutable_operation() {
   
-  return _impl_.message_type_.Mutable(GetArenaForAllocation());
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Operation::release_message_type() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.message_type)
-  return _impl_.message_type_.Release();
+inline std::string* LogEntry::release_operation() {
+  // @@protoc_insertion_point(field_release:chatservice.LogEntry.operation)
+  return _impl_.operation_.Release();
 }
-inline void Operation::set_allocated_message_type(std::string* message_type) {
-  if (message_type != nullptr) {
+inline void LogEntry::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
     
   } else {
     
   }
-  _impl_.message_type_.SetAllocated(message_type, GetArenaForAllocation());
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_type_.IsDefault()) {
-    _impl_.message_type_.Set("", GetArenaForAllocation());
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.message_type)
+  // @@protoc_insertion_point(field_set_allocated:chatservice.LogEntry.operation)
 }
 
-// string username1 = 2;
-inline void Operation::clear_username1() {
-  _impl_.username1_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// LogBlock
+
+// uint64 firstIndex = 1;
+inline void LogBlock::clear_firstindex() {
+  _impl_.firstindex_ = uint64_t{0u};
 }
-inline const std::string& Operation::username1() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.username1)
-  return _internal_username1();
+inline uint64_t LogBlock::_internal_firstindex() const {
+  return _impl_.firstindex_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_username1(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.username1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.username1)
+inline uint64_t LogBlock::firstindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogBlock.firstIndex)
+  return _internal_firstindex();
 }
-inline std::string* Operation::mutable_username1() {
-  std::string* _s = _internal_mutable_username1();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.username1)
-  return _s;
+inline void LogBlock::_internal_set_firstindex(uint64_t value) {
+  
+  _impl_.firstindex_ = value;
 }
-inline const std::string& Operation::_internal_username1() const {
-  return _impl_.username1_.Get();
+inline void LogBlock::set_firstindex(uint64_t value) {
+  _internal_set_firstindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogBlock.firstIndex)
 }
-inline void Operation::_internal_set_username1(const std::string& value) {
-  
-  _impl_.username1_.Set(value, GetArenaForAllocation());
+
+// uint32 rawLength = 2;
+inline void LogBlock::clear_rawlength() {
+  _impl_.rawlength_ = 0u;
 }
-inline std::string* Operation::_internal_mutable_username1() {
-  
-  return _impl_.username1_.Mutable(GetArenaForAllocation());
+inline uint32_t LogBlock::_internal_rawlength() const {
+  return _impl_.rawlength_;
 }
-inline std::string* Operation::release_username1() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.username1)
-  return _impl_.username1_.Release();
+inline uint32_t LogBlock::rawlength() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogBlock.rawLength)
+  return _internal_rawlength();
 }
-inline void Operation::set_allocated_username1(std::string* username1) {
-  if (username1 != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.username1_.SetAllocated(username1, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username1_.IsDefault()) {
-    _impl_.username1_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.username1)
+inline void LogBlock::_internal_set_rawlength(uint32_t value) {
+  
+  _impl_.rawlength_ = value;
+}
+inline void LogBlock::set_rawlength(uint32_t value) {
+  _internal_set_rawlength(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogBlock.rawLength)
 }
 
-// string username2 = 3;
-inline void Operation::clear_username2() {
-  _impl_.username2_.ClearToEmpty();
+// bytes data = 3;
+inline void LogBlock::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline const std::string& Operation::username2() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.username2)
-  return _internal_username2();
+inline const std::string& LogBlock::data() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogBlock.data)
+  return _internal_data();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_username2(ArgT0&& arg0, ArgT... args) {
+void LogBlock::set_data(ArgT0&& arg0, ArgT... args) {
  
- _impl_.username2_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.username2)
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chatservice.LogBlock.data)
 }
-inline std::string* Operation::mutable_username2() {
-  std::string* _s = _internal_mutable_username2();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.username2)
+inline std::string* LogBlock::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:chatservice.LogBlock.data)
   return _s;
 }
-inline const std::string& Operation::_internal_username2() const {
-  return _impl_.username2_.Get();
+inline const std::string& LogBlock::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Operation::_internal_set_username2(const std::string& value) {
+inline void LogBlock::_internal_set_data(const std::string& value) {
   
-  _impl_.username2_.Set(value, GetArenaForAllocation());
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Operation::_internal_mutable_username2() {
+inline std::string* LogBlock::_internal_mutable_data() {
   
-  return _impl_.username2_.Mutable(GetArenaForAllocation());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Operation::release_username2() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.username2)
-  return _impl_.username2_.Release();
+inline std::string* LogBlock::release_data() {
+  // @@protoc_insertion_point(field_release:chatservice.LogBlock.data)
+  return _impl_.data_.Release();
 }
-inline void Operation::set_allocated_username2(std::string* username2) {
-  if (username2 != nullptr) {
+inline void LogBlock::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  _impl_.username2_.SetAllocated(username2, GetArenaForAllocation());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.username2_.IsDefault()) {
-    _impl_.username2_.Set("", GetArenaForAllocation());
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.username2)
+  // @@protoc_insertion_point(field_set_allocated:chatservice.LogBlock.data)
 }
 
-// string password = 4;
-inline void Operation::clear_password() {
-  _impl_.password_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// ReplicateRequest
+
+// repeated .chatservice.LogEntry entries = 1;
+inline int ReplicateRequest::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline const std::string& Operation::password() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.password)
-  return _internal_password();
+inline int ReplicateRequest::entries_size() const {
+  return _internal_entries_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_password(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.password)
+inline void ReplicateRequest::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline std::string* Operation::mutable_password() {
-  std::string* _s = _internal_mutable_password();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.password)
-  return _s;
+inline ::chatservice::LogEntry* ReplicateRequest::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:chatservice.ReplicateRequest.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline const std::string& Operation::_internal_password() const {
-  return _impl_.password_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chatservice::LogEntry >*
+ReplicateRequest::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:chatservice.ReplicateRequest.entries)
+  return &_impl_.entries_;
 }
-inline void Operation::_internal_set_password(const std::string& value) {
-  
-  _impl_.password_.Set(value, GetArenaForAllocation());
+inline const ::chatservice::LogEntry& ReplicateRequest::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline std::string* Operation::_internal_mutable_password() {
-  
-  return _impl_.password_.Mutable(GetArenaForAllocation());
+inline const ::chatservice::LogEntry& ReplicateRequest::entries(int index) const {
+  // @@protoc_insertion_point(field_get:chatservice.ReplicateRequest.entries)
+  return _internal_entries(index);
 }
-inline std::string* Operation::release_password() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.password)
-  return _impl_.password_.Release();
+inline ::chatservice::LogEntry* ReplicateRequest::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-inline void Operation::set_allocated_password(std::string* password) {
-  if (password != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.password_.IsDefault()) {
-    _impl_.password_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.password)
+inline ::chatservice::LogEntry* ReplicateRequest::add_entries() {
+  ::chatservice::LogEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:chatservice.ReplicateRequest.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chatservice::LogEntry >&
+ReplicateRequest::entries() const {
+  // @@protoc_insertion_point(field_list:chatservice.ReplicateRequest.entries)
+  return _impl_.entries_;
 }
 
-// string message_content = 5;
-inline void Operation::clear_message_content() {
-  _impl_.message_content_.ClearToEmpty();
+// uint64 commitIndex = 2;
+inline void ReplicateRequest::clear_commitindex() {
+  _impl_.commitindex_ = uint64_t{0u};
 }
-inline const std::string& Operation::message_content() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.message_content)
-  return _internal_message_content();
+inline uint64_t ReplicateRequest::_internal_commitindex() const {
+  return _impl_.commitindex_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_message_content(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.message_content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.message_content)
+inline uint64_t ReplicateRequest::commitindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.ReplicateRequest.commitIndex)
+  return _internal_commitindex();
 }
-inline std::string* Operation::mutable_message_content() {
-  std::string* _s = _internal_mutable_message_content();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.message_content)
-  return _s;
+inline void ReplicateRequest::_internal_set_commitindex(uint64_t value) {
+  
+  _impl_.commitindex_ = value;
 }
-inline const std::string& Operation::_internal_message_content() const {
-  return _impl_.message_content_.Get();
+inline void ReplicateRequest::set_commitindex(uint64_t value) {
+  _internal_set_commitindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.ReplicateRequest.commitIndex)
 }
-inline void Operation::_internal_set_message_content(const std::string& value) {
-  
-  _impl_.message_content_.Set(value, GetArenaForAllocation());
+
+// -------------------------------------------------------------------
+
+// ReplicateAck
+
+// uint64 lastIndex = 1;
+inline void ReplicateAck::clear_lastindex() {
+  _impl_.lastindex_ = uint64_t{0u};
 }
-inline std::string* Operation::_internal_mutable_message_content() {
-  
-  return _impl_.message_content_.Mutable(GetArenaForAllocation());
+inline uint64_t ReplicateAck::_internal_lastindex() const {
+  return _impl_.lastindex_;
 }
-inline std::string* Operation::release_message_content() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.message_content)
-  return _impl_.message_content_.Release();
+inline uint64_t ReplicateAck::lastindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.ReplicateAck.lastIndex)
+  return _internal_lastindex();
 }
-inline void Operation::set_allocated_message_content(std::string* message_content) {
-  if (message_content != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.message_content_.SetAllocated(message_content, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_content_.IsDefault()) {
-    _impl_.message_content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.message_content)
+inline void ReplicateAck::_internal_set_lastindex(uint64_t value) {
+  
+  _impl_.lastindex_ = value;
+}
+inline void ReplicateAck::set_lastindex(uint64_t value) {
+  _internal_set_lastindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.ReplicateAck.lastIndex)
 }
 
-// string messagesseen = 6;
-inline void Operation::clear_messagesseen() {
-  _impl_.messagesseen_.ClearToEmpty();
+// bool success = 2;
+inline void ReplicateAck::clear_success() {
+  _impl_.success_ = false;
 }
-inline const std::string& Operation::messagesseen() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.messagesseen)
-  return _internal_messagesseen();
+inline bool ReplicateAck::_internal_success() const {
+  return _impl_.success_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_messagesseen(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.messagesseen_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.messagesseen)
+inline bool ReplicateAck::success() const {
+  // @@protoc_insertion_point(field_get:chatservice.ReplicateAck.success)
+  return _internal_success();
 }
-inline std::string* Operation::mutable_messagesseen() {
-  std::string* _s = _internal_mutable_messagesseen();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.messagesseen)
-  return _s;
+inline void ReplicateAck::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline const std::string& Operation::_internal_messagesseen() const {
-  return _impl_.messagesseen_.Get();
+inline void ReplicateAck::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:chatservice.ReplicateAck.success)
 }
-inline void Operation::_internal_set_messagesseen(const std::string& value) {
-  
-  _impl_.messagesseen_.Set(value, GetArenaForAllocation());
+
+// bool needsSnapshot = 3;
+inline void ReplicateAck::clear_needssnapshot() {
+  _impl_.needssnapshot_ = false;
 }
-inline std::string* Operation::_internal_mutable_messagesseen() {
-  
-  return _impl_.messagesseen_.Mutable(GetArenaForAllocation());
+inline bool ReplicateAck::_internal_needssnapshot() const {
+  return _impl_.needssnapshot_;
 }
-inline std::string* Operation::release_messagesseen() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.messagesseen)
-  return _impl_.messagesseen_.Release();
+inline bool ReplicateAck::needssnapshot() const {
+  // @@protoc_insertion_point(field_get:chatservice.ReplicateAck.needsSnapshot)
+  return _internal_needssnapshot();
 }
-inline void Operation::set_allocated_messagesseen(std::string* messagesseen) {
-  if (messagesseen != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.messagesseen_.SetAllocated(messagesseen, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.messagesseen_.IsDefault()) {
-    _impl_.messagesseen_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.messagesseen)
+inline void ReplicateAck::_internal_set_needssnapshot(bool value) {
+  
+  _impl_.needssnapshot_ = value;
+}
+inline void ReplicateAck::set_needssnapshot(bool value) {
+  _internal_set_needssnapshot(value);
+  // @@protoc_insertion_point(field_set:chatservice.ReplicateAck.needsSnapshot)
 }
 
-// string leader = 7;
-inline void Operation::clear_leader() {
-  _impl_.leader_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// SnapshotChunk
+
+// bytes data = 1;
+inline void SnapshotChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline const std::string& Operation::leader() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.leader)
-  return _internal_leader();
+inline const std::string& SnapshotChunk::data() const {
+  // @@protoc_insertion_point(field_get:chatservice.SnapshotChunk.data)
+  return _internal_data();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_leader(ArgT0&& arg0, ArgT... args) {
+void SnapshotChunk::set_data(ArgT0&& arg0, ArgT... args) {
  
- _impl_.leader_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.leader)
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chatservice.SnapshotChunk.data)
 }
-inline std::string* Operation::mutable_leader() {
-  std::string* _s = _internal_mutable_leader();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.leader)
+inline std::string* SnapshotChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:chatservice.SnapshotChunk.data)
   return _s;
 }
-inline const std::string& Operation::_internal_leader() const {
-  return _impl_.leader_.Get();
+inline const std::string& SnapshotChunk::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Operation::_internal_set_leader(const std::string& value) {
+inline void SnapshotChunk::_internal_set_data(const std::string& value) {
   
-  _impl_.leader_.Set(value, GetArenaForAllocation());
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Operation::_internal_mutable_leader() {
+inline std::string* SnapshotChunk::_internal_mutable_data() {
   
-  return _impl_.leader_.Mutable(GetArenaForAllocation());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Operation::release_leader() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.leader)
-  return _impl_.leader_.Release();
+inline std::string* SnapshotChunk::release_data() {
+  // @@protoc_insertion_point(field_release:chatservice.SnapshotChunk.data)
+  return _impl_.data_.Release();
 }
-inline void Operation::set_allocated_leader(std::string* leader) {
-  if (leader != nullptr) {
+inline void SnapshotChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  _impl_.leader_.SetAllocated(leader, GetArenaForAllocation());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.leader_.IsDefault()) {
-    _impl_.leader_.Set("", GetArenaForAllocation());
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.leader)
+  // @@protoc_insertion_point(field_set_allocated:chatservice.SnapshotChunk.data)
 }
 
-// string clockVal = 8;
-inline void Operation::clear_clockval() {
-  _impl_.clockval_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// InstallSnapshotResponse
+
+// -------------------------------------------------------------------
+
+// LogPositionRequest
+
+// -------------------------------------------------------------------
+
+// LogPosition
+
+// uint64 appliedIndex = 1;
+inline void LogPosition::clear_appliedindex() {
+  _impl_.appliedindex_ = uint64_t{0u};
 }
-inline const std::string& Operation::clockval() const {
-  // @@protoc_insertion_point(field_get:chatservice.Operation.clockVal)
-  return _internal_clockval();
+inline uint64_t LogPosition::_internal_appliedindex() const {
+  return _impl_.appliedindex_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Operation::set_clockval(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.clockval_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:chatservice.Operation.clockVal)
+inline uint64_t LogPosition::appliedindex() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogPosition.appliedIndex)
+  return _internal_appliedindex();
 }
-inline std::string* Operation::mutable_clockval() {
-  std::string* _s = _internal_mutable_clockval();
-  // @@protoc_insertion_point(field_mutable:chatservice.Operation.clockVal)
-  return _s;
+inline void LogPosition::_internal_set_appliedindex(uint64_t value) {
+  
+  _impl_.appliedindex_ = value;
+}
+inline void LogPosition::set_appliedindex(uint64_t value) {
+  _internal_set_appliedindex(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogPosition.appliedIndex)
+}
+
+// int64 clockVal = 2;
+inline void LogPosition::clear_clockval() {
+  _impl_.clockval_ = int64_t{0};
+}
+inline int64_t LogPosition::_internal_clockval() const {
+  return _impl_.clockval_;
 }
-inline const std::string& Operation::_internal_clockval() const {
-  return _impl_.clockval_.Get();
+inline int64_t LogPosition::clockval() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogPosition.clockVal)
+  return _internal_clockval();
 }
-inline void Operation::_internal_set_clockval(const std::string& value) {
+inline void LogPosition::_internal_set_clockval(int64_t value) {
   
-  _impl_.clockval_.Set(value, GetArenaForAllocation());
+  _impl_.clockval_ = value;
+}
+inline void LogPosition::set_clockval(int64_t value) {
+  _internal_set_clockval(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogPosition.clockVal)
+}
+
+// bool hasAppliedChecksum = 3;
+inline void LogPosition::clear_hasappliedchecksum() {
+  _impl_.hasappliedchecksum_ = false;
+}
+inline bool LogPosition::_internal_hasappliedchecksum() const {
+  return _impl_.hasappliedchecksum_;
 }
-inline std::string* Operation::_internal_mutable_clockval() {
+inline bool LogPosition::hasappliedchecksum() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogPosition.hasAppliedChecksum)
+  return _internal_hasappliedchecksum();
+}
+inline void LogPosition::_internal_set_hasappliedchecksum(bool value) {
   
-  return _impl_.clockval_.Mutable(GetArenaForAllocation());
+  _impl_.hasappliedchecksum_ = value;
 }
-inline std::string* Operation::release_clockval() {
-  // @@protoc_insertion_point(field_release:chatservice.Operation.clockVal)
-  return _impl_.clockval_.Release();
+inline void LogPosition::set_hasappliedchecksum(bool value) {
+  _internal_set_hasappliedchecksum(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogPosition.hasAppliedChecksum)
 }
-inline void Operation::set_allocated_clockval(std::string* clockval) {
-  if (clockval != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.clockval_.SetAllocated(clockval, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.clockval_.IsDefault()) {
-    _impl_.clockval_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:chatservice.Operation.clockVal)
+
+// uint32 appliedChecksum = 4;
+inline void LogPosition::clear_appliedchecksum() {
+  _impl_.appliedchecksum_ = 0u;
+}
+inline uint32_t LogPosition::_internal_appliedchecksum() const {
+  return _impl_.appliedchecksum_;
+}
+inline uint32_t LogPosition::appliedchecksum() const {
+  // @@protoc_insertion_point(field_get:chatservice.LogPosition.appliedChecksum)
+  return _internal_appliedchecksum();
+}
+inline void LogPosition::_internal_set_appliedchecksum(uint32_t value) {
+  
+  _impl_.appliedchecksum_ = value;
+}
+inline void LogPosition::set_appliedchecksum(uint32_t value) {
+  _internal_set_appliedchecksum(value);
+  // @@protoc_insertion_point(field_set:chatservice.LogPosition.appliedChecksum)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// AddToPendingResponse
+// -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// PendingLogRequest
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
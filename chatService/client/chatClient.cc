@@ -19,6 +19,11 @@ int main (void) {
         client.changeStub(server_addr);
     }
 
+    // Client chooses whether reads may come from a follower that is slightly behind
+    std::string staleReads;
+    std::cout << "Allow list_users and query_messages to read from followers that may be slightly behind? (y/n)\n";
+    std::cin >> staleReads;
+    client.allowStaleReads(staleReads == "y");
 
 
     char userInput[g_InputLimit];
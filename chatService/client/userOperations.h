@@ -61,6 +61,19 @@ struct ChatServiceClient {
 
         std::vector<std::string> serverAddresses;       // List of all potential server IP addresses the client can connect to
 
+        bool staleReads = false;                        // Whether list_users and query_messages may be answered by a follower
+        std::unique_ptr<ChatService::Stub> readStub_;   // Stub for the server answering stale reads
+        std::string readIP;                             // IP address stale reads are sent to
+
+        // Picks a random server for stale reads, so reads are spread over the replicas
+        ChatService::Stub* readStub() {
+            if (!readStub_ && serverAddresses.size() > 0) {
+                readIP = serverAddresses[rand() % serverAddresses.size()];
+                readStub_ = ChatService::NewStub(grpc::CreateChannel(readIP, grpc::InsecureChannelCredentials()));
+            }
+            return readStub_.get();
+        }
+
     public:
         ChatServiceClient() {}
 
@@ -77,6 +90,11 @@ struct ChatServiceClient {
             currentIP = address;
         }
 
+        // Lets list_users and query_messages be answered by a follower that may be slightly behind
+        void allowStaleReads(bool allow) {
+            staleReads = allow;
+        }
+
         // Calls the stub's CreateAccount RPC and handles surrounding logic
         void createAccount(std::string username, std::string password) {
             if (USER_LOGGED_IN) {
@@ -249,7 +267,7 @@ struct ChatServiceClient {
         }
 
         // Calls the stub's ListUsers RPC and handles surrounding logic
-        void listUsers(std::string prefix) {
+        void listUsers(std::string prefix, bool tryFollower = true) {
             if (!USER_LOGGED_IN) {
                 throw std::runtime_error(loggedInErrorMsg("list_users"));
             }
@@ -259,14 +277,27 @@ struct ChatServiceClient {
             message.set_username(prefix);
 
             User user;
+
+            // Stale reads go to the read replica, which sends us to the leader if it is too far behind
+            bool readingFollower = tryFollower && staleReads && readStub() != nullptr;
+            ChatService::Stub* stub = stub_.get();
+            if (readingFollower) {
+                message.set_allowstaleread(true);
+                stub = readStub_.get();
+            }
             
             // Attempt to list users
-            std::unique_ptr<ClientReader<User>> reader(stub_->ListUsers(&context, message));
+            std::unique_ptr<ClientReader<User>> reader(stub->ListUsers(&context, message));
             std::cout << "Found Following Users:" << std::endl;
 
             // Read the useres from the stream
             while (reader->Read(&user)) {
-                if (user.has_leader()) {
+                if (user.has_leader() && readingFollower) {
+                    // Read replica is too stale, ask the leader
+                    listUsers(prefix, false);
+                    return;
+
+                } else if (user.has_leader()) {
                     // If we contacted a replica and it's not in the middle of an election, contact the real leader
                     if (user.leader() != g_ElectionString) {
                         changeStub(user.leader());
@@ -284,6 +315,13 @@ struct ChatServiceClient {
 
             Status status = reader->Finish();
 
+            // If the read replica is down, pick another one next time and ask the leader now
+            if (!status.ok() && readingFollower) {
+                readStub_.reset();
+                listUsers(prefix, false);
+                return;
+            }
+
             // If the connection was dropped
             if (!status.ok()) { 
                 // Delete current IP address from vector
@@ -418,7 +456,7 @@ struct ChatServiceClient {
         }
 
         // Calls the stub's QueryMessages RPC and handles surrounding logic
-        void queryMessages(std::string username) {
+        void queryMessages(std::string username, bool tryFollower = true) {
             if (!USER_LOGGED_IN) {
                 throw std::runtime_error(loggedInErrorMsg("query_messages"));
             }
@@ -427,14 +465,28 @@ struct ChatServiceClient {
             message.set_otherusername(username);
             message.set_clientusername(clientUsername);
 
+            // Stale reads go to the read replica, which sends us to the leader if it is too far behind
+            bool readingFollower = tryFollower && staleReads && readStub() != nullptr;
+            ChatService::Stub* stub = stub_.get();
+            if (readingFollower) {
+                message.set_allowstaleread(true);
+                stub = readStub_.get();
+            }
+
             // Attempts to query messages
             ChatMessage msg;
             int messagesRead = 0;
-            std::unique_ptr<ClientReader<ChatMessage>> reader(stub_->QueryMessages(&context, message));
+            int firstMessageIndex = -1;
+            std::unique_ptr<ClientReader<ChatMessage>> reader(stub->QueryMessages(&context, message));
 
             // Reads messages from the stream
             while (reader->Read(&msg)) {
-                if (msg.has_leader()) {
+                if (msg.has_leader() && readingFollower) {
+                    // Read replica is too stale, ask the leader
+                    queryMessages(username, false);
+                    return;
+
+                } else if (msg.has_leader()) {
                     // If we contacted a replica and it's not in the middle of an election, connect to the real leader
                     if (msg.leader() != g_ElectionString) {
                         changeStub(msg.leader());
@@ -446,11 +498,21 @@ struct ChatServiceClient {
                 
                 }
                 std::cout << msg.senderusername() << ": " << msg.msgcontent() << std::endl;
+                if (messagesRead == 0 && msg.has_messageindex()) {
+                    firstMessageIndex = msg.messageindex();
+                }
                 messagesRead++;
             }
 
             Status status = reader->Finish();
 
+            // If the read replica is down, pick another one next time and ask the leader now
+            if (!status.ok() && readingFollower) {
+                readStub_.reset();
+                queryMessages(username, false);
+                return;
+            }
+
             // If the connection dropped
             if (!status.ok()) {
                 // Delete current IP address from vector
@@ -477,6 +539,10 @@ struct ChatServiceClient {
             message2.set_messagesseen(messagesRead);
             message2.set_clientusername(clientUsername);
             message2.set_otherusername(username);
+            // The leader does not know where a page read from a follower starts
+            if (readingFollower && firstMessageIndex >= 0) {
+                message2.set_firstmessageindex(firstMessageIndex);
+            }
 
             // Tell the server that the messages were seen
             MessagesSeenReply server_reply;
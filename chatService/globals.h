@@ -49,7 +49,7 @@ const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwx
 // check that character follows allowed alphabet
 bool validString(std::string inputString) {
     // Check that all characters are from alphabet
-    int found = inputString.find_first_not_of(alphabet);
+    size_t found = inputString.find_first_not_of(alphabet);
     if (found != std::string::npos) {
         return false;
     }
@@ -0,0 +1,748 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Adaptive radix tree nodes for the username index (Leis et al., "The Adaptive Radix Tree").
+//
+// Inner nodes come in four sizes and grow as children are added: Node4 and Node16 keep sorted
+// key bytes next to their children, Node16 searching all 16 at once with SSE2; Node48 maps each
+// byte to one of 48 child slots; Node256 is indexed by the byte directly. Chains of nodes with a
+// single child are collapsed into the prefix of the node below them. Only the first
+// g_artMaxPrefix bytes of a prefix are stored, the rest is checked against a leaf underneath.
+//
+// Keys are read as if followed by a 0 byte, which usernames never contain, so a key that is a
+// prefix of another ("Vic", "Victor") still ends at its own leaf.
+//
+// Nodes live in an ArtArena, one slab of fixed size slots per node type. Removing a key frees its
+// leaf, shrinks nodes left with few children and merges a Node4 with one child into that child,
+// and freed slots are handed out again before a new chunk is taken. Memory thus follows the keys
+// that are live rather than every key ever added.
+
+const uint32_t g_artMaxPrefix = 8;
+
+enum ArtNodeType : uint8_t {
+    ART_LEAF,
+    ART_NODE4,
+    ART_NODE16,
+    ART_NODE48,
+    ART_NODE256,
+};
+
+struct ArtNode {
+    uint8_t type;
+
+    explicit ArtNode(uint8_t nodeType) : type(nodeType) {}
+};
+
+const uint32_t g_userRecordCreated = 1;
+
+// Everything the index knows about one account, kept in its leaf so a login is a single lookup
+struct UserRecord {
+    uint32_t id = 0;            // the username's id in userIds
+    uint32_t flags = 0;
+    int64_t createdAt = 0;      // clock value of the log entry that created the account
+    std::string credential;
+};
+
+// Holds one key and its user's record
+struct ArtLeaf : ArtNode {
+    std::string key;
+    UserRecord record;
+
+    explicit ArtLeaf(const std::string& leafKey) : ArtNode(ART_LEAF), key(leafKey) {}
+};
+
+struct ArtInnerNode : ArtNode {
+    uint16_t childCount = 0;
+    uint32_t prefixLength = 0;
+    unsigned char prefix[g_artMaxPrefix];
+
+    explicit ArtInnerNode(uint8_t nodeType) : ArtNode(nodeType) {}
+};
+
+struct ArtNode4 : ArtInnerNode {
+    unsigned char keys[4];
+    ArtNode* children[4];
+
+    ArtNode4() : ArtInnerNode(ART_NODE4) {}
+};
+
+struct ArtNode16 : ArtInnerNode {
+    unsigned char keys[16];
+    ArtNode* children[16];
+
+    ArtNode16() : ArtInnerNode(ART_NODE16) {}
+};
+
+// childIndex holds slot + 1 for every byte with a child, 0 otherwise
+struct ArtNode48 : ArtInnerNode {
+    unsigned char childIndex[256];
+    ArtNode* children[48];
+
+    ArtNode48() : ArtInnerNode(ART_NODE48) {
+        memset(childIndex, 0, sizeof(childIndex));
+    }
+};
+
+struct ArtNode256 : ArtInnerNode {
+    ArtNode* children[256];
+
+    ArtNode256() : ArtInnerNode(ART_NODE256) {
+        memset(children, 0, sizeof(children));
+    }
+};
+
+const size_t g_artSlabChunkBytes = 64 * 1024;
+
+// Fixed size slots for one node type, carved out of chunks of about g_artSlabChunkBytes. A released
+// slot goes on a free list threaded through the slots themselves and is reused first
+template <typename Node>
+struct ArtSlab {
+    private:
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+        static const size_t slotsPerChunk = sizeof(Node) >= g_artSlabChunkBytes ? 1 : g_artSlabChunkBytes / sizeof(Node);
+
+        std::vector<char*> chunks;
+        size_t chunkSlotsUsed = slotsPerChunk;
+        FreeSlot* freeSlots = nullptr;
+        size_t liveSlots = 0;
+
+    public:
+        ArtSlab() {}
+        ArtSlab(const ArtSlab&) = delete;
+        ArtSlab& operator=(const ArtSlab&) = delete;
+
+        ~ArtSlab() {
+            freeChunks();
+        }
+
+        template <typename... Args>
+        Node* allocate(Args&&... args) {
+            void* slot;
+            if (freeSlots != nullptr) {
+                slot = freeSlots;
+                freeSlots = freeSlots->next;
+            } else {
+                if (chunkSlotsUsed == slotsPerChunk) {
+                    chunks.push_back(static_cast<char*>(::operator new(slotsPerChunk * sizeof(Node))));
+                    chunkSlotsUsed = 0;
+                }
+                slot = chunks.back() + chunkSlotsUsed * sizeof(Node);
+                chunkSlotsUsed++;
+            }
+            liveSlots++;
+            return new (slot) Node(std::forward<Args>(args)...);
+        }
+
+        void release(Node* node) {
+            node->~Node();
+            FreeSlot* slot = reinterpret_cast<FreeSlot*>(node);
+            slot->next = freeSlots;
+            freeSlots = slot;
+            liveSlots--;
+        }
+
+        // Returns every chunk, the nodes in them must have been released
+        void freeChunks() {
+            for (char* chunk : chunks) {
+                ::operator delete(chunk);
+            }
+            chunks.clear();
+            chunkSlotsUsed = slotsPerChunk;
+            freeSlots = nullptr;
+            liveSlots = 0;
+        }
+
+        size_t bytes() const {
+            return chunks.size() * slotsPerChunk * sizeof(Node);
+        }
+
+        size_t live() const {
+            return liveSlots;
+        }
+};
+
+// Owns every node of one tree
+struct ArtArena {
+    ArtSlab<ArtLeaf> leaves;
+    ArtSlab<ArtNode4> node4s;
+    ArtSlab<ArtNode16> node16s;
+    ArtSlab<ArtNode48> node48s;
+    ArtSlab<ArtNode256> node256s;
+
+    void release(ArtNode* node) {
+        switch (node->type) {
+            case ART_LEAF:
+                leaves.release(static_cast<ArtLeaf*>(node));
+                break;
+            case ART_NODE4:
+                node4s.release(static_cast<ArtNode4*>(node));
+                break;
+            case ART_NODE16:
+                node16s.release(static_cast<ArtNode16*>(node));
+                break;
+            case ART_NODE48:
+                node48s.release(static_cast<ArtNode48*>(node));
+                break;
+            case ART_NODE256:
+                node256s.release(static_cast<ArtNode256*>(node));
+                break;
+        }
+    }
+
+    void freeChunks() {
+        leaves.freeChunks();
+        node4s.freeChunks();
+        node16s.freeChunks();
+        node48s.freeChunks();
+        node256s.freeChunks();
+    }
+
+    // Bytes of chunks taken from the heap
+    size_t bytes() const {
+        return leaves.bytes() + node4s.bytes() + node16s.bytes() + node48s.bytes() + node256s.bytes();
+    }
+
+    size_t liveNodes() const {
+        return leaves.live() + node4s.live() + node16s.live() + node48s.live() + node256s.live();
+    }
+};
+
+// Byte of key at depth, with the implicit terminator past its end
+unsigned char artKeyByte(const std::string& key, size_t depth) {
+    return depth < key.size() ? static_cast<unsigned char>(key[depth]) : 0;
+}
+
+// Position of byte among the first count keys of a Node16, or -1
+int artNode16Find(const ArtNode16* node, unsigned char byte) {
+#if defined(__SSE2__)
+    __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(node->keys)));
+    unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches)) & ((1u << node->childCount) - 1);
+    return mask == 0 ? -1 : __builtin_ctz(mask);
+#else
+    for (int i = 0; i < node->childCount; i++) {
+        if (node->keys[i] == byte) {
+            return i;
+        }
+    }
+    return -1;
+#endif
+}
+
+// Slot holding the child for byte, or nullptr
+ArtNode** artFindChild(ArtNode* node, unsigned char byte) {
+    switch (node->type) {
+        case ART_NODE4: {
+            ArtNode4* node4 = static_cast<ArtNode4*>(node);
+            for (int i = 0; i < node4->childCount; i++) {
+                if (node4->keys[i] == byte) {
+                    return &node4->children[i];
+                }
+            }
+            return nullptr;
+        }
+        case ART_NODE16: {
+            ArtNode16* node16 = static_cast<ArtNode16*>(node);
+            int i = artNode16Find(node16, byte);
+            return i < 0 ? nullptr : &node16->children[i];
+        }
+        case ART_NODE48: {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            int slot = node48->childIndex[byte];
+            return slot == 0 ? nullptr : &node48->children[slot - 1];
+        }
+        case ART_NODE256: {
+            ArtNode256* node256 = static_cast<ArtNode256*>(node);
+            return node256->children[byte] == nullptr ? nullptr : &node256->children[byte];
+        }
+    }
+    return nullptr;
+}
+
+// Calls back with every child in key byte order until the callback returns false
+template <typename Callback>
+bool artForEachChild(ArtNode* node, Callback& callback) {
+    switch (node->type) {
+        case ART_NODE4: {
+            ArtNode4* node4 = static_cast<ArtNode4*>(node);
+            for (int i = 0; i < node4->childCount; i++) {
+                if (!callback(node4->keys[i], node4->children[i])) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case ART_NODE16: {
+            ArtNode16* node16 = static_cast<ArtNode16*>(node);
+            for (int i = 0; i < node16->childCount; i++) {
+                if (!callback(node16->keys[i], node16->children[i])) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case ART_NODE48: {
+            ArtNode48* node48 = static_cast<ArtNode48*>(node);
+            for (int byte = 0; byte < 256; byte++) {
+                if (node48->childIndex[byte] != 0 &&
+                        !callback(static_cast<unsigned char>(byte), node48->children[node48->childIndex[byte] - 1])) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case ART_NODE256: {
+            ArtNode256* node256 = static_cast<ArtNode256*>(node);
+            for (int byte = 0; byte < 256; byte++) {
+                if (node256->children[byte] != nullptr && !callback(static_cast<unsigned char>(byte), node256->children[byte])) {
+                    return false;
+                }
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+// Leftmost leaf under node, whose key holds the prefix bytes that were not stored
+ArtLeaf* artMinimumLeaf(ArtNode* node) {
+    while (node->type != ART_LEAF) {
+        ArtNode* first = nullptr;
+        auto takeFirst = [&first](unsigned char byte, ArtNode* child) {
+            first = child;
+            return false;
+        };
+        artForEachChild(node, takeFirst);
+        node = first;
+    }
+    return static_cast<ArtLeaf*>(node);
+}
+
+// Prefix byte i of an inner node at depth
+unsigned char artPrefixByte(ArtInnerNode* node, size_t depth, uint32_t i) {
+    return i < g_artMaxPrefix ? node->prefix[i] : artKeyByte(artMinimumLeaf(node)->key, depth + i);
+}
+
+// Copies an inner node's header into its replacement
+void artCopyHeader(ArtInnerNode* to, const ArtInnerNode* from) {
+    to->childCount = from->childCount;
+    to->prefixLength = from->prefixLength;
+    memcpy(to->prefix, from->prefix, std::min(from->prefixLength, g_artMaxPrefix));
+}
+
+// Adds child under byte, replacing nodeRef with a bigger node when it is full
+void artAddChild(ArtNode*& nodeRef, unsigned char byte, ArtNode* child, ArtArena& arena) {
+    switch (nodeRef->type) {
+        case ART_NODE4: {
+            ArtNode4* node4 = static_cast<ArtNode4*>(nodeRef);
+            if (node4->childCount < 4) {
+                int position = 0;
+                while (position < node4->childCount && node4->keys[position] < byte) {
+                    position++;
+                }
+                memmove(node4->keys + position + 1, node4->keys + position, node4->childCount - position);
+                memmove(node4->children + position + 1, node4->children + position, (node4->childCount - position) * sizeof(ArtNode*));
+                node4->keys[position] = byte;
+                node4->children[position] = child;
+                node4->childCount++;
+                return;
+            }
+            ArtNode16* node16 = arena.node16s.allocate();
+            artCopyHeader(node16, node4);
+            memcpy(node16->keys, node4->keys, 4);
+            memcpy(node16->children, node4->children, 4 * sizeof(ArtNode*));
+            arena.release(node4);
+            nodeRef = node16;
+            artAddChild(nodeRef, byte, child, arena);
+            return;
+        }
+        case ART_NODE16: {
+            ArtNode16* node16 = static_cast<ArtNode16*>(nodeRef);
+            if (node16->childCount < 16) {
+                int position = 0;
+                while (position < node16->childCount && node16->keys[position] < byte) {
+                    position++;
+                }
+                memmove(node16->keys + position + 1, node16->keys + position, node16->childCount - position);
+                memmove(node16->children + position + 1, node16->children + position, (node16->childCount - position) * sizeof(ArtNode*));
+                node16->keys[position] = byte;
+                node16->children[position] = child;
+                node16->childCount++;
+                return;
+            }
+            ArtNode48* node48 = arena.node48s.allocate();
+            artCopyHeader(node48, node16);
+            for (int i = 0; i < 16; i++) {
+                node48->children[i] = node16->children[i];
+                node48->childIndex[node16->keys[i]] = i + 1;
+            }
+            arena.release(node16);
+            nodeRef = node48;
+            artAddChild(nodeRef, byte, child, arena);
+            return;
+        }
+        case ART_NODE48: {
+            ArtNode48* node48 = static_cast<ArtNode48*>(nodeRef);
+            if (node48->childCount < 48) {
+                node48->children[node48->childCount] = child;
+                node48->childIndex[byte] = node48->childCount + 1;
+                node48->childCount++;
+                return;
+            }
+            ArtNode256* node256 = arena.node256s.allocate();
+            artCopyHeader(node256, node48);
+            for (int i = 0; i < 256; i++) {
+                if (node48->childIndex[i] != 0) {
+                    node256->children[i] = node48->children[node48->childIndex[i] - 1];
+                }
+            }
+            arena.release(node48);
+            nodeRef = node256;
+            artAddChild(nodeRef, byte, child, arena);
+            return;
+        }
+        case ART_NODE256: {
+            ArtNode256* node256 = static_cast<ArtNode256*>(nodeRef);
+            node256->children[byte] = child;
+            node256->childCount++;
+            return;
+        }
+    }
+}
+
+// Number of prefix bytes of node that match key from depth
+uint32_t artPrefixMismatch(ArtInnerNode* node, const std::string& key, size_t depth) {
+    uint32_t stored = std::min(node->prefixLength, g_artMaxPrefix);
+    for (uint32_t i = 0; i < stored; i++) {
+        if (node->prefix[i] != artKeyByte(key, depth + i)) {
+            return i;
+        }
+    }
+    if (node->prefixLength > g_artMaxPrefix) {
+        ArtLeaf* leaf = artMinimumLeaf(node);
+        for (uint32_t i = g_artMaxPrefix; i < node->prefixLength; i++) {
+            if (artKeyByte(leaf->key, depth + i) != artKeyByte(key, depth + i)) {
+                return i;
+            }
+        }
+    }
+    return node->prefixLength;
+}
+
+// Finds the leaf of key, or nullptr. Stored prefix bytes are checked on the way down and the
+// rest by comparing the whole key at the leaf
+ArtLeaf* artSearch(ArtNode* node, const std::string& key) {
+    size_t depth = 0;
+    while (node != nullptr) {
+        if (node->type == ART_LEAF) {
+            ArtLeaf* leaf = static_cast<ArtLeaf*>(node);
+            return leaf->key == key ? leaf : nullptr;
+        }
+        ArtInnerNode* inner = static_cast<ArtInnerNode*>(node);
+        uint32_t stored = std::min(inner->prefixLength, g_artMaxPrefix);
+        for (uint32_t i = 0; i < stored; i++) {
+            if (inner->prefix[i] != artKeyByte(key, depth + i)) {
+                return nullptr;
+            }
+        }
+        depth += inner->prefixLength;
+        if (depth > key.size()) {
+            return nullptr;
+        }
+        ArtNode** child = artFindChild(node, artKeyByte(key, depth));
+        if (child == nullptr) {
+            return nullptr;
+        }
+        node = *child;
+        depth++;
+    }
+    return nullptr;
+}
+
+// Returns the leaf of key, adding it under nodeRef first if it is new
+ArtLeaf* artInsert(ArtNode*& nodeRef, const std::string& key, ArtArena& arena, size_t depth = 0) {
+    if (nodeRef == nullptr) {
+        ArtLeaf* leaf = arena.leaves.allocate(key);
+        nodeRef = leaf;
+        return leaf;
+    }
+
+    if (nodeRef->type == ART_LEAF) {
+        ArtLeaf* existing = static_cast<ArtLeaf*>(nodeRef);
+        if (existing->key == key) {
+            return existing;
+        }
+        // Split the leaf into a Node4 holding both keys after their common bytes
+        ArtNode4* node4 = arena.node4s.allocate();
+        uint32_t common = 0;
+        while (artKeyByte(existing->key, depth + common) == artKeyByte(key, depth + common)) {
+            common++;
+        }
+        node4->prefixLength = common;
+        for (uint32_t i = 0; i < std::min(common, g_artMaxPrefix); i++) {
+            node4->prefix[i] = artKeyByte(key, depth + i);
+        }
+        ArtLeaf* leaf = arena.leaves.allocate(key);
+        ArtNode* node = node4;
+        artAddChild(node, artKeyByte(existing->key, depth + common), existing, arena);
+        artAddChild(node, artKeyByte(key, depth + common), leaf, arena);
+        nodeRef = node;
+        return leaf;
+    }
+
+    ArtInnerNode* inner = static_cast<ArtInnerNode*>(nodeRef);
+    if (inner->prefixLength > 0) {
+        uint32_t mismatch = artPrefixMismatch(inner, key, depth);
+        if (mismatch < inner->prefixLength) {
+            // The key leaves the compressed path part way, split it with a Node4 above
+            ArtNode4* node4 = arena.node4s.allocate();
+            node4->prefixLength = mismatch;
+            memcpy(node4->prefix, inner->prefix, std::min(mismatch, g_artMaxPrefix));
+            unsigned char innerByte = artPrefixByte(inner, depth, mismatch);
+            if (inner->prefixLength <= g_artMaxPrefix) {
+                memmove(inner->prefix, inner->prefix + mismatch + 1, inner->prefixLength - mismatch - 1);
+            } else {
+                ArtLeaf* minimum = artMinimumLeaf(inner);
+                for (uint32_t i = 0; i < std::min(inner->prefixLength - mismatch - 1, g_artMaxPrefix); i++) {
+                    inner->prefix[i] = artKeyByte(minimum->key, depth + mismatch + 1 + i);
+                }
+            }
+            inner->prefixLength -= mismatch + 1;
+
+            ArtLeaf* leaf = arena.leaves.allocate(key);
+            ArtNode* node = node4;
+            artAddChild(node, innerByte, inner, arena);
+            artAddChild(node, artKeyByte(key, depth + mismatch), leaf, arena);
+            nodeRef = node;
+            return leaf;
+        }
+        depth += inner->prefixLength;
+    }
+
+    unsigned char byte = artKeyByte(key, depth);
+    ArtNode** child = artFindChild(nodeRef, byte);
+    if (child != nullptr) {
+        return artInsert(*child, key, arena, depth + 1);
+    }
+    ArtLeaf* leaf = arena.leaves.allocate(key);
+    artAddChild(nodeRef, byte, leaf, arena);
+    return leaf;
+}
+
+// Finds the node under which every key starts with prefix, or nullptr if no key does
+ArtNode* artSearchPrefix(ArtNode* node, const std::string& prefix) {
+    size_t depth = 0;
+    while (node != nullptr) {
+        if (node->type == ART_LEAF) {
+            const std::string& key = static_cast<ArtLeaf*>(node)->key;
+            return key.compare(0, prefix.size(), prefix) == 0 ? node : nullptr;
+        }
+        ArtInnerNode* inner = static_cast<ArtInnerNode*>(node);
+        for (uint32_t i = 0; i < inner->prefixLength && depth + i < prefix.size(); i++) {
+            if (artPrefixByte(inner, depth, i) != static_cast<unsigned char>(prefix[depth + i])) {
+                return nullptr;
+            }
+        }
+        depth += inner->prefixLength;
+        if (depth >= prefix.size()) {
+            return node;
+        }
+        ArtNode** child = artFindChild(node, static_cast<unsigned char>(prefix[depth]));
+        if (child == nullptr) {
+            return nullptr;
+        }
+        node = *child;
+        depth++;
+    }
+    return nullptr;
+}
+
+// Calls back with every leaf under node in key order
+template <typename Callback>
+void artForEachLeaf(ArtNode* node, Callback& callback) {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->type == ART_LEAF) {
+        callback(static_cast<ArtLeaf*>(node));
+        return;
+    }
+    auto visit = [&callback](unsigned char byte, ArtNode* child) {
+        artForEachLeaf(child, callback);
+        return true;
+    };
+    artForEachChild(node, visit);
+}
+
+// Removes the child under byte from the node in nodeRef. A node left with few children is
+// replaced by a smaller one, and a Node4 left with one child by that child
+void artRemoveChild(ArtNode*& nodeRef, unsigned char byte, ArtArena& arena) {
+    switch (nodeRef->type) {
+        case ART_NODE4: {
+            ArtNode4* node4 = static_cast<ArtNode4*>(nodeRef);
+            int position = static_cast<int>(artFindChild(node4, byte) - node4->children);
+            memmove(node4->keys + position, node4->keys + position + 1, node4->childCount - position - 1);
+            memmove(node4->children + position, node4->children + position + 1, (node4->childCount - position - 1) * sizeof(ArtNode*));
+            node4->childCount--;
+            if (node4->childCount > 1) {
+                return;
+            }
+            // Merge this node's prefix and the remaining byte into the prefix of its child
+            ArtNode* child = node4->children[0];
+            if (child->type != ART_LEAF) {
+                ArtInnerNode* inner = static_cast<ArtInnerNode*>(child);
+                uint32_t length = node4->prefixLength;
+                if (length < g_artMaxPrefix) {
+                    node4->prefix[length] = node4->keys[0];
+                    length++;
+                }
+                if (length < g_artMaxPrefix) {
+                    uint32_t childBytes = std::min(inner->prefixLength, g_artMaxPrefix - length);
+                    memcpy(node4->prefix + length, inner->prefix, childBytes);
+                    length += childBytes;
+                }
+                memcpy(inner->prefix, node4->prefix, std::min(length, g_artMaxPrefix));
+                inner->prefixLength += node4->prefixLength + 1;
+            }
+            arena.release(node4);
+            nodeRef = child;
+            return;
+        }
+        case ART_NODE16: {
+            ArtNode16* node16 = static_cast<ArtNode16*>(nodeRef);
+            int position = artNode16Find(node16, byte);
+            memmove(node16->keys + position, node16->keys + position + 1, node16->childCount - position - 1);
+            memmove(node16->children + position, node16->children + position + 1, (node16->childCount - position - 1) * sizeof(ArtNode*));
+            node16->childCount--;
+            if (node16->childCount > 3) {
+                return;
+            }
+            ArtNode4* node4 = arena.node4s.allocate();
+            artCopyHeader(node4, node16);
+            memcpy(node4->keys, node16->keys, node16->childCount);
+            memcpy(node4->children, node16->children, node16->childCount * sizeof(ArtNode*));
+            arena.release(node16);
+            nodeRef = node4;
+            return;
+        }
+        case ART_NODE48: {
+            // Keep the slots dense by moving the last one into the hole
+            ArtNode48* node48 = static_cast<ArtNode48*>(nodeRef);
+            int slot = node48->childIndex[byte] - 1;
+            int last = node48->childCount - 1;
+            if (slot != last) {
+                node48->children[slot] = node48->children[last];
+                for (int i = 0; i < 256; i++) {
+                    if (node48->childIndex[i] == last + 1) {
+                        node48->childIndex[i] = slot + 1;
+                        break;
+                    }
+                }
+            }
+            node48->childIndex[byte] = 0;
+            node48->childCount--;
+            if (node48->childCount > 12) {
+                return;
+            }
+            ArtNode16* node16 = arena.node16s.allocate();
+            artCopyHeader(node16, node48);
+            int position = 0;
+            for (int i = 0; i < 256; i++) {
+                if (node48->childIndex[i] != 0) {
+                    node16->keys[position] = static_cast<unsigned char>(i);
+                    node16->children[position] = node48->children[node48->childIndex[i] - 1];
+                    position++;
+                }
+            }
+            arena.release(node48);
+            nodeRef = node16;
+            return;
+        }
+        case ART_NODE256: {
+            ArtNode256* node256 = static_cast<ArtNode256*>(nodeRef);
+            node256->children[byte] = nullptr;
+            node256->childCount--;
+            if (node256->childCount > 37) {
+                return;
+            }
+            ArtNode48* node48 = arena.node48s.allocate();
+            artCopyHeader(node48, node256);
+            int slot = 0;
+            for (int i = 0; i < 256; i++) {
+                if (node256->children[i] != nullptr) {
+                    node48->children[slot] = node256->children[i];
+                    node48->childIndex[i] = slot + 1;
+                    slot++;
+                }
+            }
+            arena.release(node256);
+            nodeRef = node48;
+            return;
+        }
+    }
+}
+
+// Removes the leaf of key from under nodeRef and frees it, returns false if there is none
+bool artRemove(ArtNode*& nodeRef, const std::string& key, ArtArena& arena, size_t depth = 0) {
+    if (nodeRef == nullptr) {
+        return false;
+    }
+    if (nodeRef->type == ART_LEAF) {
+        ArtLeaf* leaf = static_cast<ArtLeaf*>(nodeRef);
+        if (leaf->key != key) {
+            return false;
+        }
+        arena.release(leaf);
+        nodeRef = nullptr;
+        return true;
+    }
+
+    ArtInnerNode* inner = static_cast<ArtInnerNode*>(nodeRef);
+    if (inner->prefixLength > 0) {
+        if (artPrefixMismatch(inner, key, depth) != inner->prefixLength) {
+            return false;
+        }
+        depth += inner->prefixLength;
+    }
+    unsigned char byte = artKeyByte(key, depth);
+    ArtNode** child = artFindChild(nodeRef, byte);
+    if (child == nullptr) {
+        return false;
+    }
+    if ((*child)->type != ART_LEAF) {
+        return artRemove(*child, key, arena, depth + 1);
+    }
+    ArtLeaf* leaf = static_cast<ArtLeaf*>(*child);
+    if (leaf->key != key) {
+        return false;
+    }
+    artRemoveChild(nodeRef, byte, arena);
+    arena.release(leaf);
+    return true;
+}
+
+// Releases node and everything under it back to the arena
+void artReleaseTree(ArtNode* node, ArtArena& arena) {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->type != ART_LEAF) {
+        auto releaseChild = [&arena](unsigned char byte, ArtNode* child) {
+            artReleaseTree(child, arena);
+            return true;
+        };
+        artForEachChild(node, releaseChild);
+    }
+    arena.release(node);
+}
@@ -7,6 +7,9 @@
 #include <grpcpp/server_context.h>
 
 #include <netdb.h>
+#include <cctype>
+#include <cerrno>
+#include <climits>
 
 const int g_backlogSize = 50;
 
@@ -25,14 +28,32 @@ void RunServer(std::string server_addr) {
 }
 
 int main (int argc, char const* argv[]) {
+
+    // Optional durability policy: none, batch, or a number of milliseconds between background syncs
+    if (argc > 1) {
+        std::string durability = argv[1];
+        char* end = nullptr;
+        errno = 0;
+        long syncMillis = strtol(argv[1], &end, 10);
+        if (durability == "none") {
+            g_Service.setDurability(DURABILITY_NONE, g_durabilitySyncMillis);
+        } else if (durability == "batch") {
+            g_Service.setDurability(DURABILITY_BATCH, g_durabilitySyncMillis);
+        } else if (!durability.empty() && isdigit(static_cast<unsigned char>(durability[0])) && *end == '\0' &&
+                   errno == 0 && syncMillis <= INT_MAX) {
+            g_Service.setDurability(DURABILITY_INTERVAL, std::max(1, static_cast<int>(syncMillis)));
+        } else {
+            std::cout << "Usage: " << argv[0] << " [none | batch | SYNC_MILLIS]" << std::endl;
+            return 1;
+        }
+    }
  
     // For getting host IP address we followed tutorial found here: 
     //      https://www.tutorialspoint.com/how-to-get-the-ip-address-of-local-computer-using-c-cplusplus
     char host[256];
     char *IP;
     hostent *host_entry;
-    int hostname;
-    hostname = gethostname(host, sizeof(host)); //find the host name
+    gethostname(host, sizeof(host)); //find the host name
     host_entry = gethostbyname(host); //find host information
     IP = inet_ntoa(*((struct in_addr*) host_entry->h_addr_list[0])); //Convert into IP string
     int port;
@@ -0,0 +1,33 @@
+#include <zlib.h>
+
+#include <cstdint>
+#include <string>
+
+// zlib block compression, used for sealed log segments and the entries sent to catch up a
+// follower. Blocks hold whole records so each one inflates on its own
+
+// Level 1 keeps compression well ahead of the network on message-heavy logs, see
+// tests/compressionBenchmark.cc
+int g_compressionLevel = 1;
+size_t g_compressionBlockBytes = 64 * 1024;
+
+// Compresses length bytes of data into compressed, returns false if zlib fails
+bool compressBlock(const char* data, size_t length, std::string& compressed, int level = g_compressionLevel) {
+    uLongf compressedLength = compressBound(length);
+    compressed.resize(compressedLength);
+    if (compress2(reinterpret_cast<Bytef*>(&compressed[0]), &compressedLength,
+                  reinterpret_cast<const Bytef*>(data), length, level) != Z_OK) {
+        return false;
+    }
+    compressed.resize(compressedLength);
+    return true;
+}
+
+// Inflates a block that held rawLength bytes into raw, returns false if it is corrupt
+bool decompressBlock(const char* data, size_t length, size_t rawLength, std::string& raw) {
+    raw.resize(rawLength);
+    uLongf inflatedLength = rawLength;
+    int status = uncompress(reinterpret_cast<Bytef*>(&raw[0]), &inflatedLength,
+                            reinterpret_cast<const Bytef*>(data), length);
+    return status == Z_OK && inflatedLength == rawLength;
+}
@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CSV_SCAN_X86 1
+#endif
+
+// Finds the ',' and '\n' separators of the CSV log format. Each block of 16 (SSE2) or
+// 32 (AVX2) bytes is compared against both characters at once, and the set bits of the
+// resulting mask are the delimiter positions. Everything else falls back to a byte loop.
+
+enum CsvScanLevel {
+    CSV_SCAN_SCALAR,
+    CSV_SCAN_SSE2,
+    CSV_SCAN_AVX2,
+};
+
+// Calls back with the offset and character of every delimiter, one byte at a time.
+// Also finishes the bytes after the last full block, whose offsets start at base
+template <typename Callback>
+void forEachCsvDelimiterScalar(const char* data, size_t length, Callback& callback, size_t base = 0) {
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] == ',' || data[i] == '\n') {
+            callback(base + i, data[i]);
+        }
+    }
+}
+
+#ifdef CSV_SCAN_X86
+template <typename Callback>
+__attribute__((target("sse2")))
+void forEachCsvDelimiterSse2(const char* data, size_t length, Callback& callback) {
+    const __m128i commas = _mm_set1_epi8(',');
+    const __m128i newlines = _mm_set1_epi8('\n');
+    size_t offset = 0;
+    for (; offset + 16 <= length; offset += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, commas), _mm_cmpeq_epi8(block, newlines));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+        while (mask != 0) {
+            size_t position = offset + __builtin_ctz(mask);
+            callback(position, data[position]);
+            mask &= mask - 1;
+        }
+    }
+    forEachCsvDelimiterScalar(data + offset, length - offset, callback, offset);
+}
+
+template <typename Callback>
+__attribute__((target("avx2")))
+void forEachCsvDelimiterAvx2(const char* data, size_t length, Callback& callback) {
+    const __m256i commas = _mm256_set1_epi8(',');
+    const __m256i newlines = _mm256_set1_epi8('\n');
+    size_t offset = 0;
+    for (; offset + 32 <= length; offset += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+        __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, commas), _mm256_cmpeq_epi8(block, newlines));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+        while (mask != 0) {
+            size_t position = offset + __builtin_ctz(mask);
+            callback(position, data[position]);
+            mask &= mask - 1;
+        }
+    }
+    forEachCsvDelimiterScalar(data + offset, length - offset, callback, offset);
+}
+#endif
+
+// Widest scan the CPU we are running on supports
+CsvScanLevel detectCsvScanLevel() {
+#ifdef CSV_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return CSV_SCAN_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return CSV_SCAN_SSE2;
+    }
+#endif
+    return CSV_SCAN_SCALAR;
+}
+
+CsvScanLevel g_csvScanLevel = detectCsvScanLevel();
+
+// Calls back with the offset and character of every ',' and '\n' in data, in order
+template <typename Callback>
+void forEachCsvDelimiter(const char* data, size_t length, Callback& callback, CsvScanLevel level = g_csvScanLevel) {
+    switch (level) {
+#ifdef CSV_SCAN_X86
+        case CSV_SCAN_AVX2:
+            forEachCsvDelimiterAvx2(data, length, callback);
+            return;
+        case CSV_SCAN_SSE2:
+            forEachCsvDelimiterSse2(data, length, callback);
+            return;
+#endif
+        default:
+            forEachCsvDelimiterScalar(data, length, callback);
+    }
+}
@@ -1,7 +1,5 @@
 #include "serviceImplementations.h"
 
-#include <cstdlib>
-
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/create_channel.h>
@@ -32,7 +30,6 @@ void serverThread(const std::vector<std::string> serverAddresses) {
         g_Service.setAsLeader();
     }
 
-    srand(time(NULL));
     while (true) {
         // sleep
         std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -44,53 +41,11 @@ void serverThread(const std::vector<std::string> serverAddresses) {
         if (!g_Service.heartbeat()) {
             // if heartbeat fails
             //      propose / execute leader election
-            if (g_Service.proposeLeaderElection()) {
-                g_Service.leaderElection();
-            }
-        }
-
-        // If leader
-        if(g_Service.isLeader() && g_startingUp) {
-            // Request pending with Request Pending Log
-            std::vector<OperationClass> operations;
-            std::cout << "Requesting pending logs" << std::endl;
-            g_Service.requestLogs(operations);
-            std::cout << "Reading own pending file" << std::endl;
-            std::vector<std::vector<std::string>> vectorizedLines;
-            readFile(&vectorizedLines, g_Service.getPendingFilename());
-            std::cout << "Adding operations to vector" << std::endl;
-            for (int idx = 1; idx < vectorizedLines.size(); idx++) {
-                std::vector<std::string> line = vectorizedLines[idx];
-                OperationClass op;
-                op.clockVal = std::stoi(line[7]);
-                op.opCode = std::stoi(line[0]);
-                op.username1 = line[1];
-                op.username2 = line[2];
-                op.password = line[3];
-                op.message_content = line[4];
-                op.messagesseen = line[5];
-                op.leader = line[6];
-                operations.push_back(op);
+            //      the winner merges every server's pending entries before it leads, on every election
+            if (g_Service.proposeLeaderElection() && g_Service.leaderElection()) {
+                g_Service.reconcileLogs();
             }
-            std::cout << "Sorting operations" << std::endl;
-            sortOperations(operations);
-            std::cout << "Writing pending operatiions to pending file" << std::endl;
-            g_Service.writePendingOperations(operations);
-
-            // Send commit logs
-            std::cout << "sending commit logs" << std::endl;
-            g_Service.sendLogs(g_Service.getCommitFilename());
-
-            // Move pending logs to commit
-            std::cout << "moving pending logs to commit" << std::endl;
-            g_Service.moveAllPendingToCommit();
-
-            // Sending pending logs
-            std::cout << "sending pending logs" << std::endl;
-            g_Service.sendLogs(g_Service.getPendingFilename());
-            g_startingUp = false;
         }
 
-
     }
 }
\ No newline at end of file
@@ -0,0 +1,403 @@
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#define LOG_WRITER_IO_URING 1
+#endif
+#endif
+
+// Log writer stage. Threads that append to the log queue their records here and return, or wait
+// until they are written; one writer thread submits everything queued to io_uring, so many writes
+// are in flight at once and nobody else blocks in the kernel. Writes carry explicit offsets and
+// may finish in any order, but the written index only advances over a finished prefix. A sync is
+// submitted to drain after every write queued before it. Without io_uring, or if the kernel
+// refuses to set up a ring, the writer thread falls back to pwrite and fdatasync.
+
+bool g_logWriterUseIoUring = true;
+const unsigned g_logWriterQueueDepth = 256;
+
+// A record write or a sync handed to the writer
+struct LogWriteRequest {
+    int fd = -1;
+    off_t offset = 0;
+    std::string data;
+    size_t written = 0;
+    bool sync = false;
+    uint64_t lastIndex = 0;     // log entry this write finishes, 0 for syncs
+    bool completed = false;     // set by the writer thread when the kernel is done with it
+    bool retired = false;       // set once every request before it completed too
+    bool failed = false;
+};
+
+#ifdef LOG_WRITER_IO_URING
+// Just enough io_uring to submit writes and syncs and reap their completions, without liburing
+class IoUring {
+    private:
+        int ringFd = -1;
+        void* sqRing = MAP_FAILED;
+        void* cqRing = MAP_FAILED;
+        void* sqeArray = MAP_FAILED;
+        size_t sqRingBytes = 0;
+        size_t cqRingBytes = 0;
+        size_t sqeBytes = 0;
+
+        unsigned* sqTail;
+        unsigned* sqRingArray;
+        unsigned sqMask;
+        unsigned* cqHead;
+        unsigned* cqTail;
+        unsigned cqMask;
+        io_uring_cqe* cqes;
+        io_uring_sqe* sqes;
+        unsigned prepared = 0;
+
+        void teardown() {
+            if (sqeArray != MAP_FAILED) {
+                munmap(sqeArray, sqeBytes);
+            }
+            if (cqRing != MAP_FAILED) {
+                munmap(cqRing, cqRingBytes);
+            }
+            if (sqRing != MAP_FAILED) {
+                munmap(sqRing, sqRingBytes);
+            }
+            if (ringFd >= 0) {
+                close(ringFd);
+            }
+            sqeArray = cqRing = sqRing = MAP_FAILED;
+            ringFd = -1;
+        }
+
+    public:
+        ~IoUring() {
+            teardown();
+        }
+
+        // Creates the ring, returns false if the kernel does not allow it
+        bool setup(unsigned entries) {
+            io_uring_params params;
+            memset(&params, 0, sizeof(params));
+            ringFd = syscall(__NR_io_uring_setup, entries, &params);
+            if (ringFd < 0) {
+                return false;
+            }
+
+            sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cqRingBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            sqeBytes = params.sq_entries * sizeof(io_uring_sqe);
+            sqRing = mmap(nullptr, sqRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+            cqRing = mmap(nullptr, cqRingBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+            sqeArray = mmap(nullptr, sqeBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+            if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqeArray == MAP_FAILED) {
+                teardown();
+                return false;
+            }
+
+            char* sq = static_cast<char*>(sqRing);
+            sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            sqRingArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            char* cq = static_cast<char*>(cqRing);
+            cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            sqes = static_cast<io_uring_sqe*>(sqeArray);
+            return true;
+        }
+
+        // Fills in the next submission entry for a request
+        void prepare(LogWriteRequest* request) {
+            unsigned slot = (*sqTail + prepared) & sqMask;
+            io_uring_sqe* sqe = &sqes[slot];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->fd = request->fd;
+            sqe->user_data = reinterpret_cast<uint64_t>(request);
+            if (request->sync) {
+                sqe->opcode = IORING_OP_FSYNC;
+                sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+                sqe->flags = IOSQE_IO_DRAIN;
+            } else {
+                sqe->opcode = IORING_OP_WRITE;
+                sqe->addr = reinterpret_cast<uint64_t>(request->data.data() + request->written);
+                sqe->len = request->data.size() - request->written;
+                sqe->off = request->offset + request->written;
+            }
+            sqRingArray[slot] = slot;
+            prepared++;
+        }
+
+        // Submits what was prepared and waits until at least waitFor requests completed
+        bool submitAndWait(unsigned waitFor) {
+            __atomic_store_n(sqTail, *sqTail + prepared, __ATOMIC_RELEASE);
+            unsigned toSubmit = prepared;
+            prepared = 0;
+            while (syscall(__NR_io_uring_enter, ringFd, toSubmit, waitFor, waitFor > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0) < 0) {
+                if (errno != EINTR) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Takes the next completion, returns false if there is none
+        bool nextCompletion(LogWriteRequest*& request, int& result) {
+            unsigned head = *cqHead;
+            if (head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+                return false;
+            }
+            io_uring_cqe* cqe = &cqes[head & cqMask];
+            request = reinterpret_cast<LogWriteRequest*>(cqe->user_data);
+            result = cqe->res;
+            __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+            return true;
+        }
+};
+#endif
+
+class LogWriter {
+    private:
+        std::mutex writerMutex;
+        std::condition_variable writerCondition;
+        std::condition_variable completionCondition;
+        std::deque<LogWriteRequest*> queued;
+        std::deque<LogWriteRequest*> inFlight;      // in submission order
+        uint64_t writtenIdx = 0;
+        bool failed = false;
+        bool running = false;
+        bool stopping = false;
+        std::thread writerThread;
+
+#ifdef LOG_WRITER_IO_URING
+        IoUring ring;
+#endif
+        bool usingRing = false;
+
+        // Writes or syncs a request with blocking calls
+        void finishBlocking(LogWriteRequest* request) {
+            if (request->sync) {
+                request->failed = fdatasync(request->fd) != 0;
+            }
+            while (!request->sync && request->written < request->data.size()) {
+                ssize_t result = pwrite(request->fd, request->data.data() + request->written,
+                                        request->data.size() - request->written, request->offset + request->written);
+                if (result < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (result <= 0) {
+                    request->failed = true;
+                    break;
+                }
+                request->written += result;
+            }
+            request->completed = true;
+        }
+
+#ifdef LOG_WRITER_IO_URING
+        // Submits a batch to the ring and handles whatever completed
+        void submitToRing(std::vector<LogWriteRequest*>& batch) {
+            for (LogWriteRequest* request : batch) {
+                ring.prepare(request);
+            }
+            if (!ring.submitAndWait(1)) {
+                // The ring broke, finish everything in flight and everything after it without it.
+                // Requests from earlier batches would otherwise never complete
+                std::cout << "io_uring submit failed, log writer falling back to blocking writes" << std::endl;
+                usingRing = false;
+                std::vector<LogWriteRequest*> unfinished;
+                writerMutex.lock();
+                for (LogWriteRequest* request : inFlight) {
+                    if (!request->completed) {
+                        unfinished.push_back(request);
+                    }
+                }
+                writerMutex.unlock();
+                for (LogWriteRequest* request : unfinished) {
+                    finishBlocking(request);
+                }
+                return;
+            }
+
+            LogWriteRequest* request;
+            int result;
+            while (ring.nextCompletion(request, result)) {
+                if (result < 0) {
+                    // Unsupported or failed in the ring, retry it the old way
+                    finishBlocking(request);
+                    continue;
+                }
+                if (!request->sync) {
+                    request->written += result;
+                    if (request->written < request->data.size()) {
+                        finishBlocking(request);
+                        continue;
+                    }
+                }
+                request->completed = true;
+            }
+        }
+#endif
+
+        // Retires completed requests from the front, called with writerMutex held
+        void retireCompleted() {
+            while (!inFlight.empty() && inFlight.front()->completed) {
+                LogWriteRequest* request = inFlight.front();
+                inFlight.pop_front();
+                if (request->failed) {
+                    failed = true;
+                }
+                if (request->sync) {
+                    // The thread that queued the sync owns it
+                    request->retired = true;
+                } else {
+                    writtenIdx = std::max(writtenIdx, request->lastIndex);
+                    delete request;
+                }
+            }
+            completionCondition.notify_all();
+        }
+
+        void run() {
+            std::unique_lock<std::mutex> lock(writerMutex);
+            while (true) {
+                writerCondition.wait(lock, [this] { return stopping || !queued.empty() || !inFlight.empty(); });
+                if (queued.empty() && inFlight.empty()) {
+                    return;
+                }
+
+                std::vector<LogWriteRequest*> batch;
+                while (!queued.empty() && inFlight.size() < g_logWriterQueueDepth) {
+                    batch.push_back(queued.front());
+                    inFlight.push_back(queued.front());
+                    queued.pop_front();
+                }
+                lock.unlock();
+
+#ifdef LOG_WRITER_IO_URING
+                if (usingRing) {
+                    submitToRing(batch);
+                } else {
+                    for (LogWriteRequest* request : batch) {
+                        finishBlocking(request);
+                    }
+                }
+#else
+                for (LogWriteRequest* request : batch) {
+                    finishBlocking(request);
+                }
+#endif
+
+                lock.lock();
+                retireCompleted();
+            }
+        }
+
+    public:
+        ~LogWriter() {
+            stop();
+        }
+
+        // Starts the writer thread, entries up to writtenIndex are already on the log
+        void start(uint64_t writtenIndex) {
+            if (running) {
+                return;
+            }
+#ifdef LOG_WRITER_IO_URING
+            usingRing = g_logWriterUseIoUring && ring.setup(g_logWriterQueueDepth);
+            if (g_logWriterUseIoUring && !usingRing) {
+                std::cout << "Could not set up io_uring, log writer falling back to blocking writes" << std::endl;
+            }
+#endif
+            writtenIdx = writtenIndex;
+            failed = false;
+            stopping = false;
+            running = true;
+            writerThread = std::thread(&LogWriter::run, this);
+        }
+
+        // Finishes everything queued and stops the writer thread
+        void stop() {
+            if (!running) {
+                return;
+            }
+            writerMutex.lock();
+            stopping = true;
+            writerMutex.unlock();
+            writerCondition.notify_all();
+            writerThread.join();
+            running = false;
+        }
+
+        // Queues a record for entry index at offset of fd and returns without waiting. Callers
+        // queue entries in index order
+        void write(int fd, off_t offset, std::string data, uint64_t index) {
+            LogWriteRequest* request = new LogWriteRequest();
+            request->fd = fd;
+            request->offset = offset;
+            request->data = std::move(data);
+            request->lastIndex = index;
+            writerMutex.lock();
+            queued.push_back(request);
+            writerMutex.unlock();
+            writerCondition.notify_all();
+        }
+
+        // Syncs fd once every write queued before this call is done, returns false if that failed
+        bool sync(int fd) {
+            LogWriteRequest request;
+            request.fd = fd;
+            request.sync = true;
+            std::unique_lock<std::mutex> lock(writerMutex);
+            queued.push_back(&request);
+            writerCondition.notify_all();
+            completionCondition.wait(lock, [&request] { return request.retired; });
+            return !request.failed;
+        }
+
+        // Waits until every entry up to index is written
+        void waitWritten(uint64_t index) {
+            std::unique_lock<std::mutex> lock(writerMutex);
+            completionCondition.wait(lock, [this, index] { return writtenIdx >= index || failed; });
+            if (failed) {
+                throw std::runtime_error("Could not append to write-ahead log");
+            }
+        }
+
+        // Waits until nothing is queued or in flight, so files can be closed or truncated
+        void drain() {
+            std::unique_lock<std::mutex> lock(writerMutex);
+            completionCondition.wait(lock, [this] { return queued.empty() && inFlight.empty(); });
+        }
+
+        uint64_t writtenIndex() {
+            writerMutex.lock();
+            uint64_t toReturn = writtenIdx;
+            writerMutex.unlock();
+            return toReturn;
+        }
+
+        // Moves the written index after entries were truncated or the log was reset
+        void setWrittenIndex(uint64_t index) {
+            writerMutex.lock();
+            writtenIdx = index;
+            writerMutex.unlock();
+        }
+
+        bool usingIoUring() {
+            return usingRing;
+        }
+};
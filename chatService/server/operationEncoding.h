@@ -0,0 +1,411 @@
+#include "storageUpdates.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+// Binary encoding of an operation, shared by log records, replication and the pending log
+// exchanged during elections, so an entry is encoded once and shipped as is.
+//
+// An entry is [u8 0x80 | opCode][varint clockVal][u8 field mask][fields in mask order]. Strings
+// are a varint length and their bytes, numbers are zigzag varints, and a field is only written
+// when it is set and the operation's schema carries it, so LOGOUT takes a few bytes instead of
+// six length prefixed "NULL"s.
+//
+// Usernames are stored through a UsernameDictionary, flagged by g_internedUsernamesFlag in the
+// mask: a varint holding (id << 1) for a name an earlier entry defined, or ((length << 1) | 1)
+// followed by the bytes for a name not seen yet. Log entries use the log's dictionary. Entries
+// sent outside the log's order, like the pending log during elections, use a dictionary both
+// ends of the stream build as it goes.
+
+const uint8_t g_operationFormatTag = 0x80;
+const uint8_t g_internedUsernamesFlag = 0x80;
+
+void putU32(std::string& buffer, uint32_t value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putU64(std::string& buffer, uint64_t value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putString(std::string& buffer, const std::string& value) {
+    putU32(buffer, value.size());
+    buffer.append(value);
+}
+
+uint32_t getU32(const char* data) {
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+uint64_t getU64(const char* data) {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void putVarint(std::string& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+// Reads a varint and moves data past it, returns false if it runs past end
+bool getVarint(const char*& data, const char* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && data < end; shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(*data++);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Signed numbers are zigzagged so small negatives like an unset firstMessageIndex stay short
+void putSignedVarint(std::string& buffer, int64_t value) {
+    putVarint(buffer, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+bool getSignedVarint(const char*& data, const char* end, int64_t& value) {
+    uint64_t zigzag;
+    if (!getVarint(data, end, zigzag)) {
+        return false;
+    }
+    value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    return true;
+}
+
+void putVarString(std::string& buffer, const char* data, size_t size) {
+    putVarint(buffer, size);
+    buffer.append(data, size);
+}
+
+void putVarString(std::string& buffer, const std::string& value) {
+    putVarString(buffer, value.data(), value.size());
+}
+
+// Reads a length prefixed string in place
+bool getVarString(const char*& data, const char* end, FieldView& field) {
+    uint64_t size;
+    if (!getVarint(data, end, size) || static_cast<uint64_t>(end - data) < size) {
+        return false;
+    }
+    field.data = data;
+    field.size = size;
+    data += size;
+    return true;
+}
+
+// Usernames interned by a log. A name gets the next id when the first entry using it is logged,
+// so every server holding the same log prefix has the same dictionary and entries shipped from
+// one log decode against another. Names sit in a deque, whose elements never move, so views of
+// them stay valid while names are added
+struct UsernameDictionary {
+    private:
+        std::mutex dictionaryMutex;
+        std::deque<std::string> names;          // by id
+        std::deque<uint64_t> definedAt;         // index of the entry that defined each id
+        std::unordered_map<std::string, uint32_t> ids;
+
+    public:
+        bool find(const char* data, size_t size, uint32_t& id) {
+            dictionaryMutex.lock();
+            auto found = ids.find(std::string(data, size));
+            bool known = found != ids.end();
+            if (known) {
+                id = found->second;
+            }
+            dictionaryMutex.unlock();
+            return known;
+        }
+
+        bool lookup(uint64_t id, FieldView& name) {
+            dictionaryMutex.lock();
+            bool known = id < names.size();
+            if (known) {
+                name.data = names[id].data();
+                name.size = names[id].size();
+            }
+            dictionaryMutex.unlock();
+            return known;
+        }
+
+        // Gives name the next id unless it already has one
+        void define(const std::string& name, uint64_t index) {
+            dictionaryMutex.lock();
+            if (ids.find(name) == ids.end()) {
+                ids[name] = names.size();
+                names.push_back(name);
+                definedAt.push_back(index);
+            }
+            dictionaryMutex.unlock();
+        }
+
+        // Gives the names an entry wrote by value their ids, definedFields comes from decoding it
+        void learn(const OperationView& op, uint8_t definedFields, uint64_t index) {
+            if (definedFields & FIELD_USERNAME1) {
+                define(op.username1.str(), index);
+            }
+            if (definedFields & FIELD_USERNAME2) {
+                define(op.username2.str(), index);
+            }
+        }
+
+        // Forgets names defined by entries after index, which were dropped from the log
+        void truncate(uint64_t index) {
+            dictionaryMutex.lock();
+            while (!definedAt.empty() && definedAt.back() > index) {
+                ids.erase(names.back());
+                names.pop_back();
+                definedAt.pop_back();
+            }
+            dictionaryMutex.unlock();
+        }
+
+        void clear() {
+            dictionaryMutex.lock();
+            names.clear();
+            definedAt.clear();
+            ids.clear();
+            dictionaryMutex.unlock();
+        }
+
+        size_t size() {
+            dictionaryMutex.lock();
+            size_t toReturn = names.size();
+            dictionaryMutex.unlock();
+            return toReturn;
+        }
+
+        // Names defined by entries up to index, in id order
+        std::vector<std::string> namesUpTo(uint64_t index) {
+            std::vector<std::string> toReturn;
+            dictionaryMutex.lock();
+            for (size_t id = 0; id < names.size() && definedAt[id] <= index; id++) {
+                toReturn.push_back(names[id]);
+            }
+            dictionaryMutex.unlock();
+            return toReturn;
+        }
+
+        // [u64 index][varint length][bytes] for every name defined by entries up to index
+        std::string encode(uint64_t index) {
+            std::string buffer;
+            dictionaryMutex.lock();
+            for (size_t id = 0; id < names.size() && definedAt[id] <= index; id++) {
+                putU64(buffer, definedAt[id]);
+                putVarString(buffer, names[id]);
+            }
+            dictionaryMutex.unlock();
+            return buffer;
+        }
+
+        // Replaces the dictionary with the output of encode, returns false if it is malformed
+        bool decode(const char* data, size_t length) {
+            clear();
+            const char* end = data + length;
+            while (data < end) {
+                FieldView name;
+                if (end - data < 8) {
+                    return false;
+                }
+                uint64_t index = getU64(data);
+                data += 8;
+                if (!getVarString(data, end, name)) {
+                    return false;
+                }
+                define(name.str(), index);
+            }
+            return true;
+        }
+};
+
+// Writes a username by id if the dictionary knows it and by value otherwise
+void putUsername(std::string& buffer, const char* data, size_t size, UsernameDictionary& usernames) {
+    uint32_t id;
+    if (usernames.find(data, size, id)) {
+        putVarint(buffer, static_cast<uint64_t>(id) << 1);
+    } else {
+        putVarint(buffer, (static_cast<uint64_t>(size) << 1) | 1);
+        buffer.append(data, size);
+    }
+}
+
+// Reads a username written by putUsername. defined is set if it was written by value
+bool getUsername(const char*& data, const char* end, FieldView& field, UsernameDictionary& usernames, bool& defined) {
+    uint64_t value;
+    if (!getVarint(data, end, value)) {
+        return false;
+    }
+    defined = value & 1;
+    if (defined) {
+        if (static_cast<uint64_t>(end - data) < (value >> 1)) {
+            return false;
+        }
+        field.data = data;
+        field.size = value >> 1;
+        data += field.size;
+        return true;
+    }
+    return usernames.lookup(value >> 1, field);
+}
+
+// Serializes an OperationClass or OperationView into the payload used by the log and replication.
+// Names usernames already knows are written as ids
+template <typename Operation>
+std::string encodeOperation(const Operation& op, UsernameDictionary& usernames) {
+    uint8_t fields = operationFields(op.opCode);
+    const char* stringData[] = {fieldData(op.username1), fieldData(op.username2), fieldData(op.password),
+                                fieldData(op.message_content), fieldData(op.leader)};
+    size_t stringSize[] = {fieldSize(op.username1), fieldSize(op.username2), fieldSize(op.password),
+                           fieldSize(op.message_content), fieldSize(op.leader)};
+
+    uint8_t mask = 0;
+    size_t reserve = 12;
+    for (int i = 0; i < 5; i++) {
+        if ((fields & (1 << i)) && stringSize[i] > 0) {
+            mask |= 1 << i;
+            reserve += 5 + stringSize[i];
+        }
+    }
+    mask |= (fields & FIELD_MESSAGES_SEEN) && op.messagesSeen != 0 ? FIELD_MESSAGES_SEEN : 0;
+    mask |= (fields & FIELD_FIRST_MESSAGE_INDEX) && op.firstMessageIndex != -1 ? FIELD_FIRST_MESSAGE_INDEX : 0;
+
+    std::string payload;
+    payload.reserve(reserve);
+    payload.push_back(static_cast<char>(g_operationFormatTag | op.opCode));
+    putSignedVarint(payload, op.clockVal);
+    payload.push_back(static_cast<char>(mask | g_internedUsernamesFlag));
+    for (int i = 0; i < 5; i++) {
+        if (!(mask & (1 << i))) {
+            continue;
+        }
+        if ((1 << i) <= FIELD_USERNAME2) {
+            putUsername(payload, stringData[i], stringSize[i], usernames);
+        } else {
+            putVarString(payload, stringData[i], stringSize[i]);
+        }
+    }
+    if (mask & FIELD_MESSAGES_SEEN) {
+        putSignedVarint(payload, op.messagesSeen);
+    }
+    if (mask & FIELD_FIRST_MESSAGE_INDEX) {
+        putSignedVarint(payload, op.firstMessageIndex);
+    }
+    return payload;
+}
+
+// Decodes a payload without copying, the view's fields point into data or the dictionary.
+// Usernames written by value are flagged in definedFields. Returns false if the payload is
+// malformed or refers to a username id the dictionary does not have
+bool decodeOperationView(const char* data, size_t length, OperationView& op,
+                         UsernameDictionary& usernames, uint8_t* definedFields = nullptr) {
+    if (definedFields != nullptr) {
+        *definedFields = 0;
+    }
+    op = OperationView();
+    if (length < 1) {
+        return false;
+    }
+    uint8_t tag = static_cast<uint8_t>(data[0]);
+    if ((tag & g_operationFormatTag) == 0) {
+        return false;
+    }
+
+    const char* end = data + length;
+    op.opCode = tag & ~g_operationFormatTag;
+    data++;
+    int64_t clockVal;
+    if (!getSignedVarint(data, end, clockVal) || data == end) {
+        return false;
+    }
+    op.clockVal = clockVal;
+    uint8_t mask = static_cast<uint8_t>(*data++);
+    if (!(mask & g_internedUsernamesFlag)) {
+        return false;
+    }
+    mask &= ~g_internedUsernamesFlag;
+    if (mask & ~operationFields(op.opCode)) {
+        return false;
+    }
+
+    FieldView* usernameFields[] = {&op.username1, &op.username2};
+    for (int i = 0; i < 2; i++) {
+        if (!(mask & (1 << i))) {
+            continue;
+        }
+        bool defined = true;
+        if (!getUsername(data, end, *usernameFields[i], usernames, defined)) {
+            return false;
+        }
+        if (defined && definedFields != nullptr) {
+            *definedFields |= 1 << i;
+        }
+    }
+    if (((mask & FIELD_PASSWORD) && !getVarString(data, end, op.password)) ||
+            ((mask & FIELD_MESSAGE_CONTENT) && !getVarString(data, end, op.message_content)) ||
+            ((mask & FIELD_LEADER) && !getVarString(data, end, op.leader))) {
+        return false;
+    }
+    int64_t number;
+    if (mask & FIELD_MESSAGES_SEEN) {
+        if (!getSignedVarint(data, end, number)) {
+            return false;
+        }
+        op.messagesSeen = static_cast<int>(number);
+    }
+    if (mask & FIELD_FIRST_MESSAGE_INDEX) {
+        if (!getSignedVarint(data, end, number)) {
+            return false;
+        }
+        op.firstMessageIndex = static_cast<int>(number);
+    }
+    return data == end;
+}
+
+// Deserializes a payload, returns false if it is malformed
+bool decodeOperation(const char* data, size_t length, OperationClass& op, UsernameDictionary& usernames) {
+    OperationView view;
+    if (!decodeOperationView(data, length, view, usernames)) {
+        return false;
+    }
+    op = copyOperation(view);
+    return true;
+}
+
+bool decodeOperation(const std::string& payload, OperationClass& op, UsernameDictionary& usernames) {
+    return decodeOperation(payload.data(), payload.size(), op, usernames);
+}
+
+// Encodes the entry at index of a stream sent outside the log's order, names it writes by value
+// get ids for the entries after it
+template <typename Operation>
+std::string encodeStreamedOperation(const Operation& op, UsernameDictionary& usernames, uint64_t index) {
+    std::string payload = encodeOperation(op, usernames);
+    OperationView view;
+    uint8_t definedFields;
+    if (decodeOperationView(payload.data(), payload.size(), view, usernames, &definedFields)) {
+        usernames.learn(view, definedFields, index);
+    }
+    return payload;
+}
+
+// Decodes an entry written by encodeStreamedOperation, with a dictionary of the receiving end's own
+bool decodeStreamedOperation(const std::string& payload, OperationClass& op, UsernameDictionary& usernames, uint64_t index) {
+    OperationView view;
+    uint8_t definedFields;
+    if (!decodeOperationView(payload.data(), payload.size(), view, usernames, &definedFields)) {
+        return false;
+    }
+    usernames.learn(view, definedFields, index);
+    op = copyOperation(view);
+    return true;
+}
@@ -1,5 +1,5 @@
 #include "../chatService.grpc.pb.h"
-#include "storageUpdates.h"
+#include "snapshot.h"
 
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
@@ -8,6 +8,8 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <condition_variable>
+
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -38,9 +40,12 @@ using chatservice::MessagesSeenMessage;
 using chatservice::HeartBeatRequest;
 using chatservice::LeaderElectionProposal;
 using chatservice::CandidateValue;
-using chatservice::CommitRequest;
+using chatservice::ReplicateRequest;
+using chatservice::LogEntry;
+using chatservice::LogBlock;
 using chatservice::PendingLogRequest;
-using chatservice::Operation;
+using chatservice::SnapshotChunk;
+using chatservice::LogPositionRequest;
 // Replies
 using chatservice::CreateAccountReply;
 using chatservice::LoginReply;
@@ -55,11 +60,139 @@ using chatservice::MessagesSeenReply;
 using chatservice::HeartBeatResponse;
 using chatservice::LeaderElectionProposalResponse;
 using chatservice::LeaderElectionResponse;
-using chatservice::CommitResponse;
+using chatservice::ReplicateAck;
 using chatservice::AddToPendingResponse;
+using chatservice::InstallSnapshotResponse;
+using chatservice::LogPosition;
 
 bool g_startingUp = true;
 
+// Group commit: the leader waits this long after the first queued write for others to join
+// its batch, and never puts more than g_groupCommitMaxOperations writes in one batch
+int g_groupCommitWindowMicros = 200;
+size_t g_groupCommitMaxOperations = 64;
+
+// Follower acknowledgements the leader waits for before committing, 0 means a majority of the cluster.
+// Followers that have not answered yet keep catching up in the background.
+int g_replicationAcks = 0;
+
+// Most entries the leader sends a follower ahead of its last ack
+uint64_t g_replicationWindow = 256;
+
+// Reads are served from the leader's memory while a majority of the cluster acked requests sent within the lease.
+// Followers refuse to elect a new leader until the lease has run out since the leader's last Replicate request.
+int g_leaderLeaseMillis = 500;
+
+// Followers answer reads that opt in to staleness while they are at most g_staleReadMaxEntries
+// behind the leader's commit index, or were caught up with it at most g_staleReadMaxMillis ago.
+// Either way they must have heard from the leader within g_staleReadMaxMillis, so the leader
+// sends them its commit index at least twice that often
+uint64_t g_staleReadMaxEntries = 64;
+int g_staleReadMaxMillis = 200;
+
+// A snapshot of the in-memory state is taken once this many entries were applied since the last one,
+// and the log segments it covers are deleted. Snapshots are sent to followers in chunks of g_snapshotChunkBytes
+uint64_t g_snapshotEntries = 10000;
+int g_snapshotCheckMillis = 1000;
+size_t g_snapshotChunkBytes = 1 << 20;
+
+// How the log reaches disk before a write is acknowledged. DURABILITY_NONE leaves it to the page
+// cache. DURABILITY_BATCH syncs each group commit batch on the leader, and each replicated batch on
+// a follower before it acks. DURABILITY_INTERVAL syncs every g_durabilitySyncMillis in the
+// background, so a crash of every replica can lose that much acknowledged work
+enum DurabilityMode {
+    DURABILITY_NONE,
+    DURABILITY_BATCH,
+    DURABILITY_INTERVAL,
+};
+DurabilityMode g_durabilityMode = DURABILITY_BATCH;
+int g_durabilitySyncMillis = 10;
+
+// A client write waiting for the group commit stage
+struct QueuedWrite {
+    OperationClass op;
+    int status = 0;
+    std::vector<ChatMessage> messages;
+    bool done = false;
+    bool failed = false;    // the log could not be made durable, the write was not applied
+
+    QueuedWrite(OperationClass operation) : op(operation) {}
+};
+
+// Long lived Replicate stream from the leader to one follower. Requests are written
+// one at a time in the order they were sent, acks are handed to onAck as they arrive.
+class ReplicationStream : public grpc::ClientBidiReactor<ReplicateRequest, ReplicateAck> {
+    private:
+        ClientContext context;
+        ReplicateAck ack;
+
+        std::mutex writeMutex;
+        std::deque<ReplicateRequest> writeQueue;
+        bool writing = false;
+
+        std::function<void(const ReplicateAck&)> onAck;
+        std::function<void()> onDone;
+
+    public:
+        ReplicationStream(ChatService::Stub* stub, std::function<void(const ReplicateAck&)> ackCallback,
+                          std::function<void()> doneCallback) : onAck(ackCallback), onDone(doneCallback) {
+            stub->async()->Replicate(&context, this);
+            StartRead(&ack);
+            StartCall();
+        }
+
+        void send(const ReplicateRequest& request) {
+            writeMutex.lock();
+            writeQueue.push_back(request);
+            if (!writing) {
+                writing = true;
+                StartWrite(&writeQueue.front());
+            }
+            writeMutex.unlock();
+        }
+
+        void OnWriteDone(bool ok) override {
+            writeMutex.lock();
+            writeQueue.pop_front();
+            if (ok && !writeQueue.empty()) {
+                StartWrite(&writeQueue.front());
+            } else {
+                writing = false;
+            }
+            writeMutex.unlock();
+        }
+
+        void OnReadDone(bool ok) override {
+            if (ok) {
+                onAck(ack);
+                StartRead(&ack);
+            }
+        }
+
+        void OnDone(const Status& status) override {
+            onDone();
+        }
+};
+
+// Batch of writes sent to followers, waiting for a quorum to commit
+struct InFlightBatch {
+    uint64_t lastIndex;
+    std::vector<QueuedWrite*> writes;
+};
+
+// Replication state the leader keeps for each follower
+struct FollowerProgress {
+    std::string address;
+    ReplicationStream* stream = nullptr;
+    uint64_t matchIndex = 0;    // highest index the follower has acked
+    uint64_t sentIndex = 0;     // highest index sent to the follower
+    bool failed = false;
+    bool streamDone = false;
+    bool installingSnapshot = false;    // entries it needs were compacted away, a snapshot is on its way
+    std::deque<std::chrono::steady_clock::time_point> sendTimes;    // of unacked requests, acks come back in order
+    std::chrono::steady_clock::time_point ackedSendTime;    // when the last acked request was sent
+};
+
 struct LeaderValues {
     bool isLeader = false;
     int leaderidx = -1;
@@ -69,24 +202,31 @@ struct LeaderValues {
 };
 
 struct ElectionValues {
-    int numberOfCandidatesReceived = 0;
-    int maxLeaderElectionVal = -1;
+    size_t numberOfCandidatesReceived = 0;
+    uint64_t maxLastIndex = 0;      // log position of the winning candidate so far
+    uint64_t maxCommitIndex = 0;
     std::string currLeaderCandidateAddr;
 
     ElectionValues() {}
+
+    // Keeps the candidate with the most up to date log, a tie goes to the lexicographically smaller address
+    void consider(uint64_t lastIndex, uint64_t commitIndex, const std::string& address) {
+        bool newer = lastIndex > maxLastIndex || (lastIndex == maxLastIndex && commitIndex > maxCommitIndex);
+        bool tied = lastIndex == maxLastIndex && commitIndex == maxCommitIndex;
+        if (currLeaderCandidateAddr.empty() || newer || (tied && currLeaderCandidateAddr.compare(address) > 0)) {
+            maxLastIndex = lastIndex;
+            maxCommitIndex = commitIndex;
+            currLeaderCandidateAddr = address;
+        }
+    }
 };
 
 
 class ChatServiceImpl final : public chatservice::ChatService::Service {
     private:
-        // This might be where we store the conversations open per user or something
-        std::ofstream pendingLogWriter;
-        std::ofstream commitLogWriter;
-        std::string pendingFilename;
-        std::string commitFilename;
-
-        // for reading logs
-        std::ifstream pendingLogReader;
+        // Replicated log, entries past the commit index are pending
+        WriteAheadLog wal;
+        std::string walDirectory;
 
         // For interserver communication
         std::mutex connectionMutex;
@@ -101,7 +241,522 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
         ElectionValues electionVals;
 
         // logical clock
-        int clockVal;
+        int64_t clockVal;
+
+        // Writes waiting to be replicated and committed as one batch
+        std::mutex groupCommitMutex;
+        std::condition_variable groupCommitCondition;
+        std::deque<QueuedWrite*> queuedWrites;
+
+        // Keeps followers applying in log order, and snapshots from seeing half applied batches
+        std::mutex applyMutex;
+        uint64_t appliedIndex = 0;
+
+        // Index of the last entry covered by the snapshot on disk
+        uint64_t snapshotIndex = 0;
+
+        // Durability policy, set before initialize
+        DurabilityMode durabilityMode = g_durabilityMode;
+        int durabilitySyncMillis = g_durabilitySyncMillis;
+
+        // Leader's commit index as last heard by this follower, and when we last had all of it applied
+        std::mutex followerReadMutex;
+        bool leaderCommitKnown = false;
+        uint64_t leaderCommitIndex = 0;
+        std::chrono::steady_clock::time_point lastCaughtUp;
+
+        // When the leader's last Replicate request reached us, our ack may be holding up its lease
+        std::chrono::steady_clock::time_point lastReplicate;
+
+        // Replication progress of each follower, only used while leader
+        std::mutex replicationMutex;
+        std::condition_variable replicationCondition;
+        std::unordered_map<std::string, FollowerProgress> followerProgress;
+        std::deque<InFlightBatch> inFlightBatches;
+
+        // Number of servers in the cluster, including this one
+        int clusterSize = 1;
+
+        // Follower acknowledgements needed to commit
+        int requiredAcks() {
+            if (g_replicationAcks > 0) {
+                return g_replicationAcks;
+            }
+            return clusterSize / 2;
+        }
+
+        // Sends a follower the entries it is missing, as many as fit in its window of unacked
+        // entries. Call with replicationMutex held. request is used as is when it is the next
+        // thing the follower needs and fits in the window.
+        void sendToFollower(FollowerProgress& progress, const ReplicateRequest* request) {
+            uint64_t lastIndex = wal.lastIndex();
+            // After a nack we resend from below matchIndex
+            uint64_t acked = std::min(progress.matchIndex, progress.sentIndex);
+            if (progress.failed || progress.installingSnapshot || progress.sentIndex >= lastIndex ||
+                    progress.sentIndex - acked >= g_replicationWindow) {
+                return;
+            }
+            uint64_t from = progress.sentIndex + 1;
+
+            // The follower is behind the start of the log, it gets the snapshot instead
+            if (from < wal.firstIndex()) {
+                progress.installingSnapshot = true;
+                std::thread snapshotThread(&ChatServiceImpl::catchUpWithSnapshot, this, progress.address);
+                snapshotThread.detach();
+                return;
+            }
+            uint64_t to = std::min(lastIndex, acked + g_replicationWindow);
+
+            ReplicateRequest toSend;
+            if (request != nullptr && request->entries(0).index() == from &&
+                    request->entries(request->entries_size() - 1).index() <= to) {
+                toSend = *request;
+            } else {
+                // Lagging follower, read what it is missing back from the log
+                wal.forEachEncodedEntry(from, to, [&toSend](uint64_t index, const char* payload, uint32_t length) {
+                    LogEntry* entry = toSend.add_entries();
+                    entry->set_index(index);
+                    entry->set_operation(payload, length);
+                });
+            }
+            if (toSend.entries_size() == 0) {
+                return;
+            }
+            toSend.set_commitindex(wal.commitIndex());
+            progress.sentIndex = toSend.entries(toSend.entries_size() - 1).index();
+            sendRequest(progress, toSend);
+        }
+
+        // Sends a request on a follower's stream and notes when, call with replicationMutex held
+        void sendRequest(FollowerProgress& progress, const ReplicateRequest& request) {
+            progress.sendTimes.push_back(std::chrono::steady_clock::now());
+            progress.stream->send(request);
+        }
+
+        // Highest index a quorum of followers has appended, call with replicationMutex held.
+        // With too few live followers for a quorum every live one has to have it.
+        uint64_t quorumIndex() {
+            std::vector<uint64_t> matchIndexes;
+            for (auto it = followerProgress.begin(); it != followerProgress.end(); it++) {
+                if (!it->second.failed) {
+                    matchIndexes.push_back(it->second.matchIndex);
+                }
+            }
+            // Our own copy only counts once it is as durable as the policy asks
+            uint64_t localIndex = durableIndex();
+            int acksNeeded = std::min(requiredAcks(), (int) matchIndexes.size());
+            if (acksNeeded == 0) {
+                return localIndex;
+            }
+            std::sort(matchIndexes.begin(), matchIndexes.end(), std::greater<uint64_t>());
+            return std::min(matchIndexes[acksNeeded - 1], localIndex);
+        }
+
+        // Ack from a follower's Replicate stream
+        void onReplicateAck(std::string address, const ReplicateAck& ack) {
+            std::lock_guard<std::mutex> lock(replicationMutex);
+            FollowerProgress& progress = followerProgress[address];
+            if (!progress.sendTimes.empty()) {
+                progress.ackedSendTime = progress.sendTimes.front();
+                progress.sendTimes.pop_front();
+            }
+            if (ack.needssnapshot()) {
+                // The follower committed entries that differ from ours, replace its state with the snapshot
+                progress.sentIndex = ack.lastindex();
+                if (!progress.installingSnapshot) {
+                    progress.installingSnapshot = true;
+                    std::thread snapshotThread(&ChatServiceImpl::catchUpWithSnapshot, this, progress.address);
+                    snapshotThread.detach();
+                }
+                replicationCondition.notify_all();
+                return;
+            }
+            if (ack.success()) {
+                // Only entries we sent count, whatever else the follower holds is unchecked
+                progress.matchIndex = std::max(progress.matchIndex, std::min(ack.lastindex(), progress.sentIndex));
+                progress.sentIndex = std::max(progress.sentIndex, progress.matchIndex);
+            } else {
+                // Follower is missing entries or has unchecked ones, resend from the last one it verified.
+                // What it holds past that does not count towards a commit
+                progress.sentIndex = ack.lastindex();
+            }
+
+            // Keep a lagging follower catching up in the background
+            sendToFollower(progress, nullptr);
+            replicationCondition.notify_all();
+        }
+
+        // A follower's Replicate stream ended, it gets dropped on the next round
+        void onReplicateDone(std::string address) {
+            std::lock_guard<std::mutex> lock(replicationMutex);
+            FollowerProgress& progress = followerProgress[address];
+            progress.failed = true;
+            progress.streamDone = true;
+            replicationCondition.notify_all();
+        }
+
+        // Sends the snapshot to a follower that fell behind the log or diverged from it, then resumes
+        // replicating after it
+        void catchUpWithSnapshot(std::string address) {
+            std::cout << "Sending snapshot to " << address << ", the entries it needs were compacted" << std::endl;
+            std::unique_ptr<ChatService::Stub> stub = ChatService::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+            uint64_t index = 0;
+            bool sent = sendSnapshot(stub.get(), index);
+
+            std::lock_guard<std::mutex> lock(replicationMutex);
+            auto it = followerProgress.find(address);
+            if (it == followerProgress.end()) {
+                return;
+            }
+            FollowerProgress& progress = it->second;
+            progress.installingSnapshot = false;
+            if (sent) {
+                // The follower's log now ends at the snapshot, whatever it held past it is gone
+                progress.matchIndex = index;
+                progress.sentIndex = index;
+                sendToFollower(progress, nullptr);
+            }
+            replicationCondition.notify_all();
+        }
+
+        // Opens a Replicate stream to every connection that lacks one. New followers are assumed to
+        // hold our committed entries, which every server got when we were elected, and are sent the
+        // rest. Call with connectionMutex and replicationMutex held.
+        void connectFollowers() {
+            uint64_t matchIndex = wal.commitIndex();
+            for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
+                if (followerProgress.find(it->first) != followerProgress.end()) {
+                    continue;
+                }
+                std::string address = it->first;
+                FollowerProgress& progress = followerProgress[address];
+                progress.address = address;
+                progress.matchIndex = matchIndex;
+                progress.sentIndex = matchIndex;
+                progress.stream = new ReplicationStream(it->second.get(),
+                    [this, address](const ReplicateAck& ack) { onReplicateAck(address, ack); },
+                    [this, address]() { onReplicateDone(address); });
+            }
+        }
+
+        // Whether enough followers to make a majority with us acked requests sent since the given time,
+        // call with replicationMutex held. Followers that are down count against it, so only a single
+        // server cluster holds the lease alone
+        bool quorumAckedSince(std::chrono::steady_clock::time_point since) {
+            int acks = 0;
+            for (auto it = followerProgress.begin(); it != followerProgress.end(); it++) {
+                if (!it->second.failed && it->second.ackedSendTime >= since) {
+                    acks++;
+                }
+            }
+            return acks >= clusterSize / 2;
+        }
+
+        // Whether the leader may still hold a lease that counts our ack, we take no part in an election until it ran out
+        bool withinLeaderLease() {
+            followerReadMutex.lock();
+            bool within = std::chrono::steady_clock::now() - lastReplicate < std::chrono::milliseconds(g_leaderLeaseMillis);
+            followerReadMutex.unlock();
+            return within;
+        }
+
+        // Whether a follower may answer a stale read from its own memory
+        bool withinStaleness() {
+            if (leaderVals.isLeader || leaderVals.leaderidx == -1) {
+                return false;
+            }
+            uint64_t applied = wal.commitIndex();
+            followerReadMutex.lock();
+            // A follower the leader dropped keeps heartbeating but hears of no new commits
+            if (std::chrono::steady_clock::now() - lastReplicate > std::chrono::milliseconds(g_staleReadMaxMillis)) {
+                leaderCommitKnown = false;
+            }
+            bool closeEnough = leaderCommitKnown && (leaderCommitIndex <= applied + g_staleReadMaxEntries ||
+                std::chrono::steady_clock::now() - lastCaughtUp <= std::chrono::milliseconds(g_staleReadMaxMillis));
+            followerReadMutex.unlock();
+            return closeEnough;
+        }
+
+        // Checks the leader lease, renewing it with an empty Replicate round if it ran out.
+        // Returns false if a quorum could not be reached within the lease time.
+        bool holdsLease() {
+            auto now = std::chrono::steady_clock::now();
+            auto lease = std::chrono::milliseconds(g_leaderLeaseMillis);
+
+            connectionMutex.lock();
+            std::unique_lock<std::mutex> lock(replicationMutex);
+            connectFollowers();
+            connectionMutex.unlock();
+
+            if (quorumAckedSince(now - lease)) {
+                return true;
+            }
+
+            ReplicateRequest ping;
+            ping.set_commitindex(wal.commitIndex());
+            for (auto it = followerProgress.begin(); it != followerProgress.end(); it++) {
+                if (!it->second.failed) {
+                    sendRequest(it->second, ping);
+                }
+            }
+            return replicationCondition.wait_for(lock, lease, [this, now] { return quorumAckedSince(now); });
+        }
+
+        // Sends entries to every follower without waiting for acks, the commit stage picks them up
+        void replicate(const ReplicateRequest& request, std::vector<QueuedWrite*>& batch) {
+            std::vector<std::string> droppedConnections;
+
+            std::lock_guard<std::mutex> lock(replicationMutex);
+            InFlightBatch inFlight;
+            inFlight.lastIndex = request.entries(request.entries_size() - 1).index();
+            inFlight.writes = batch;
+            inFlightBatches.push_back(inFlight);
+
+            connectFollowers();
+            for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
+                FollowerProgress& progress = followerProgress[it->first];
+                if (progress.failed) {
+                    if (progress.streamDone) {
+                        droppedConnections.push_back(it->first);
+                    }
+                    continue;
+                }
+                sendToFollower(progress, &request);
+            }
+
+            // Remove dropped connections
+            for (size_t i = 0; i < droppedConnections.size(); i++) {
+                std::cout << "Erasing connection to " << droppedConnections[i] << std::endl;
+                delete followerProgress[droppedConnections[i]].stream;
+                followerProgress.erase(droppedConnections[i]);
+                addressToStub.erase(droppedConnections[i]);
+            }
+            replicationCondition.notify_all();
+        }
+
+        // Piggybacks the new commit index to followers without waiting for their acks
+        void sendCommit(uint64_t commitIndex) {
+            std::lock_guard<std::mutex> lock(replicationMutex);
+            ReplicateRequest request;
+            request.set_commitindex(commitIndex);
+            for (auto it = followerProgress.begin(); it != followerProgress.end(); it++) {
+                if (!it->second.failed) {
+                    sendRequest(it->second, request);
+                }
+            }
+        }
+
+        // While leader, sends followers the commit index twice per staleness window so they keep
+        // serving stale reads while idle
+        void pingLoop() {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(std::max(1, g_staleReadMaxMillis / 2)));
+                if (!isLeader()) {
+                    continue;
+                }
+                connectionMutex.lock();
+                replicationMutex.lock();
+                connectFollowers();
+                replicationMutex.unlock();
+                connectionMutex.unlock();
+                sendCommit(wal.commitIndex());
+            }
+        }
+
+        // Last log entry that may count towards a commit under the durability policy
+        uint64_t durableIndex() {
+            if (durabilityMode == DURABILITY_BATCH) {
+                return wal.syncedIndex();
+            }
+            return wal.writtenIndex();
+        }
+
+        // Waits until the log is written up to index, and synced if every batch has to be durable.
+        // Returns false if the log could not be synced
+        bool waitDurable(uint64_t index) {
+            if (durabilityMode == DURABILITY_BATCH) {
+                return wal.sync(index);
+            }
+            wal.waitWritten(index);
+            return true;
+        }
+
+        // Appends a batch of writes to the log and starts replicating it
+        void sendBatch(std::vector<QueuedWrite*>& batch) {
+            ReplicateRequest request;
+            uint64_t logIndex = 0;
+            for (QueuedWrite* write : batch) {
+                clockVal++;
+                write->op.clockVal = clockVal;
+                std::string payload;
+                logIndex = wal.appendAsync(write->op, &payload);
+
+                LogEntry* entry = request.add_entries();
+                entry->set_index(logIndex);
+                entry->set_operation(std::move(payload));
+            }
+
+            // Tell replicas to write the batch to pending
+            connectionMutex.lock();
+            replicate(request, batch);
+            connectionMutex.unlock();
+
+            // Our write overlaps with the followers', the next batch gathers meanwhile
+            if (!waitDurable(logIndex)) {
+                failBatch(logIndex);
+                return;
+            }
+            replicationMutex.lock();
+            replicationMutex.unlock();
+            replicationCondition.notify_all();
+        }
+
+        // Gives up on the in-flight batch ending at lastIndex, its writers are told it failed
+        void failBatch(uint64_t lastIndex) {
+            std::cout << "Could not sync write-ahead log, failing writes up to " << lastIndex << std::endl;
+            std::vector<QueuedWrite*> writes;
+            replicationMutex.lock();
+            for (auto it = inFlightBatches.begin(); it != inFlightBatches.end(); it++) {
+                if (it->lastIndex == lastIndex) {
+                    writes = it->writes;
+                    inFlightBatches.erase(it);
+                    break;
+                }
+            }
+            replicationMutex.unlock();
+            replicationCondition.notify_all();
+
+            groupCommitMutex.lock();
+            for (QueuedWrite* write : writes) {
+                write->failed = true;
+                write->done = true;
+            }
+            groupCommitMutex.unlock();
+            groupCommitCondition.notify_all();
+        }
+
+        // Syncs the log in the background under DURABILITY_INTERVAL
+        void syncLoop() {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(durabilitySyncMillis));
+                if (durabilityMode == DURABILITY_INTERVAL && !wal.sync(wal.lastIndex())) {
+                    std::cout << "Could not sync write-ahead log, stopping background syncs" << std::endl;
+                    return;
+                }
+            }
+        }
+
+        // Group commit stage, takes every write queued during the window and sends it as one batch.
+        // It does not wait for acks, so several batches can be in flight at once.
+        void groupCommitLoop() {
+            while (true) {
+                std::unique_lock<std::mutex> lock(groupCommitMutex);
+                groupCommitCondition.wait(lock, [this] { return !queuedWrites.empty(); });
+
+                // Give concurrent writes a chance to join the batch
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(g_groupCommitWindowMicros);
+                groupCommitCondition.wait_until(lock, deadline, [this] {
+                    return queuedWrites.size() >= g_groupCommitMaxOperations;
+                });
+
+                std::vector<QueuedWrite*> batch;
+                while (!queuedWrites.empty() && batch.size() < g_groupCommitMaxOperations) {
+                    batch.push_back(queuedWrites.front());
+                    queuedWrites.pop_front();
+                }
+                lock.unlock();
+
+                sendBatch(batch);
+            }
+        }
+
+        // Commit stage, commits batches in log order once a quorum has them and applies them
+        void commitLoop() {
+            while (true) {
+                std::unique_lock<std::mutex> lock(replicationMutex);
+                replicationCondition.wait(lock, [this] {
+                    return !inFlightBatches.empty() && inFlightBatches.front().lastIndex <= quorumIndex();
+                });
+
+                uint64_t commitIndex = quorumIndex();
+                std::vector<InFlightBatch> committed;
+                while (!inFlightBatches.empty() && inFlightBatches.front().lastIndex <= commitIndex) {
+                    committed.push_back(inFlightBatches.front());
+                    inFlightBatches.pop_front();
+                }
+                lock.unlock();
+
+                // Commit by advancing the commit index
+                uint64_t lastCommitted = committed.back().lastIndex;
+                wal.commit(lastCommitted);
+
+                // Tell replicas to commit, lagging ones learn it with their next entries
+                sendCommit(lastCommitted);
+
+                // Add to storage
+                applyMutex.lock();
+                for (InFlightBatch& batch : committed) {
+                    for (QueuedWrite* write : batch.writes) {
+                        write->status = applyOperation(write->op, &write->messages);
+                    }
+                }
+                appliedIndex = lastCommitted;
+                applyMutex.unlock();
+
+                groupCommitMutex.lock();
+                for (InFlightBatch& batch : committed) {
+                    for (QueuedWrite* write : batch.writes) {
+                        write->done = true;
+                    }
+                }
+                groupCommitMutex.unlock();
+                groupCommitCondition.notify_all();
+            }
+        }
+
+        std::string snapshotPath() {
+            return walDirectory + "/" + g_snapshotFile;
+        }
+
+        // Snapshots the applied state and drops the log segments it covers
+        void takeSnapshot() {
+            applyMutex.lock();
+            uint64_t index = appliedIndex;
+            std::string snapshot = encodeSnapshot(index, clockVal, wal.usernamesUpTo(index));
+            applyMutex.unlock();
+
+            if (!writeSnapshotFile(snapshotPath(), snapshot)) {
+                return;
+            }
+            applyMutex.lock();
+            snapshotIndex = index;
+            applyMutex.unlock();
+            wal.compact(index);
+            std::cout << "Took snapshot at index " << index << ", log now starts at " << wal.firstIndex() << std::endl;
+        }
+
+        void snapshotLoop() {
+            while (true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(g_snapshotCheckMillis));
+                // State is only complete once startup recovery is done
+                if (g_startingUp) {
+                    continue;
+                }
+                applyMutex.lock();
+                bool due = appliedIndex >= snapshotIndex + g_snapshotEntries;
+                applyMutex.unlock();
+                if (due) {
+                    takeSnapshot();
+                }
+                // Committed segments are archived compressed
+                if (g_walCompressSegments) {
+                    int compressedSegments = wal.compressSealedSegments();
+                    if (compressedSegments > 0) {
+                        std::cout << "Compressed " << compressedSegments << " log segments" << std::endl;
+                    }
+                }
+            }
+        }
 
     public:
         explicit ChatServiceImpl() {}
@@ -110,40 +765,80 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             myAddress = addr;
             std::cout << "My address is " << myAddress << std::endl;
 
-            pendingFilename = g_pendingLogFile + addr + ".csv";
-            commitFilename = g_committedLogFile + addr + ".csv";
-            
-            // open CSV files in append mode
-            pendingLogWriter.open(pendingFilename, std::fstream::app);
-            commitLogWriter.open(commitFilename, std::fstream::app);
-
-            // open pendingLogFile in read mode
-            pendingLogReader.open(pendingFilename, std::fstream::in);
+            walDirectory = g_walDirectory + addr;
+            wal.open(walDirectory);
+            std::cout << "Log writer using " << (wal.usingIoUring() ? "io_uring" : "blocking writes") << std::endl;
 
-            // get to the end of the file
-            pendingLogReader.seekg(0, pendingLogReader.end);
-            if (pendingLogReader.tellg() == 0) {
-                addFields();
+            // A fresh log picks up whatever the old CSV logs held
+            if (wal.lastIndex() == 0) {
+                importCsvLogs(g_committedLogFile + addr + ".csv", g_pendingLogFile + addr + ".csv");
             }
 
+            // Rebuild in-memory state from our own snapshot and log, the leader only sends what is missing
             clockVal = 0;
+            replayLog();
+
+            std::thread groupCommitThread(&ChatServiceImpl::groupCommitLoop, this);
+            groupCommitThread.detach();
+            std::thread commitThread(&ChatServiceImpl::commitLoop, this);
+            commitThread.detach();
+            std::thread snapshotThread(&ChatServiceImpl::snapshotLoop, this);
+            snapshotThread.detach();
+            std::thread pingThread(&ChatServiceImpl::pingLoop, this);
+            pingThread.detach();
+            if (durabilityMode == DURABILITY_INTERVAL) {
+                std::thread syncThread(&ChatServiceImpl::syncLoop, this);
+                syncThread.detach();
+            }
+        }
 
+        // Chooses how the log is made durable, called before initialize
+        void setDurability(DurabilityMode mode, int syncMillis) {
+            durabilityMode = mode;
+            durabilitySyncMillis = syncMillis;
         }
 
-        // Getter for pending filename
-        std::string getPendingFilename() {
-            return pendingFilename;
+        // Queues a write for the group commit stage and waits until it is committed and applied.
+        // Returns false if it could not be made durable
+        bool commitWrite(QueuedWrite& write) {
+            std::unique_lock<std::mutex> lock(groupCommitMutex);
+            queuedWrites.push_back(&write);
+            groupCommitCondition.notify_all();
+            groupCommitCondition.wait(lock, [&write] { return write.done; });
+            return !write.failed;
         }
 
-        // Getter for commit filename
-        std::string getCommitFilename() {
-            return commitFilename;
+        // Getter for the log directory
+        std::string getWalDirectory() {
+            return walDirectory;
         }
 
-        // Called when CSV file was found to be empty (i.e. a new log file) so we define the CSV fields
-        void addFields() {
-            pendingLogWriter << g_csvFields << std::endl;
-            commitLogWriter << g_csvFields << std::endl;
+        // Copies operations from legacy CSV logs into the write-ahead log, one row at a time
+        void importCsvLogs(std::string committedFile, std::string pendingFile) {
+            int committed = 0;
+            int pending = 0;
+            std::ifstream committedExists(committedFile);
+            if (committedExists.good()) {
+                forEachCsvOperation(committedFile, [this, &committed](const OperationClass& op) {
+                    wal.appendAsync(op);
+                    committed++;
+                });
+            }
+            wal.waitWritten(wal.lastIndex());
+            wal.commit(wal.lastIndex());
+            std::ifstream pendingExists(pendingFile);
+            if (pendingExists.good()) {
+                forEachCsvOperation(pendingFile, [this, &pending](const OperationClass& op) {
+                    wal.appendAsync(op);
+                    pending++;
+                });
+            }
+            wal.waitWritten(wal.lastIndex());
+
+            if (committed > 0 || pending > 0) {
+                std::cout << "Imported " << committed << " committed and " << pending
+                          << " pending operations from CSV logs" << std::endl;
+            }
         }
 
         // Getter for number of connections
@@ -163,54 +858,14 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             std::string username = create_account_message->username();
             std::string password = create_account_message->password();
 
-            // Update clock value and write to pending if the message was from the leader
-            if (create_account_message->fromleader()) {
-                clockVal = std::max(create_account_message->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, CREATE_ACCOUNT, username, g_nullString, password, g_nullString, g_nullString, g_nullString, clockVal);
-            } 
-            
-             // If master, talk to replicas, if not master just return ok after writing to pending
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, CREATE_ACCOUNT, username, g_nullString, password, g_nullString, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Tell replicas to write to pending
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CreateAccountReply reply;
-                    CreateAccountMessage new_msg;
-                    new_msg.set_fromleader(true);
-                    new_msg.set_password(create_account_message->password());
-                    new_msg.set_username(create_account_message->username());
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->CreateAccount(&context, new_msg, &reply);
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
+                // Replicated, committed and applied together with other queued writes
+                QueuedWrite write(makeOperation(CREATE_ACCOUNT, username, "", password));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
                 }
 
-                // Remove dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
-                }
-
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
-                }
-                connectionMutex.unlock();
-
-                // Add to storage
-                int createAccountStatus = tryCreateAccount(username, password);
+                int createAccountStatus = write.status;
 
 
                 // Update error messages and reply based on account creation status
@@ -234,55 +889,14 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             std::string username = login_message->username();
             std::string password = login_message->password();
 
-            // Update clock value and write to pending if the message was from the leader
-            if (login_message->fromleader()) {
-                clockVal = std::max(login_message->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, LOGIN, username, g_nullString, password, g_nullString, g_nullString, g_nullString, clockVal);
-            }
-
-            // If master, talk to replicas, if not master just return ok after writing to pending
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, LOGIN, username, g_nullString, password, g_nullString, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    LoginReply reply;
-                    LoginMessage new_msg;
-                    new_msg.set_fromleader(true);
-                    new_msg.set_password(login_message->password());
-                    new_msg.set_username(login_message->username());
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->Login(&context, new_msg, &reply);
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
-                }
-
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
-                }
-
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
+                // Replicated, committed and applied together with other queued writes
+                QueuedWrite write(makeOperation(LOGIN, username, "", password));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
                 }
 
-                connectionMutex.unlock();
-
-                // Add to storage
-                int loginStatus = tryLogin(username, password);
+                int loginStatus = write.status;
                 
                 if (loginStatus == 0) {
                     server_reply->set_loginsuccess(true);
@@ -304,55 +918,12 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
 
         // Logout RPC implementation
         Status Logout(ServerContext* context, const LogoutMessage* logout_message, LogoutReply* server_reply) {
-            // Update clock value and write to pending if the message was from the leader
-            if (logout_message->fromleader()) {
-                clockVal = std::max(logout_message->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, LOGOUT, logout_message->username(), g_nullString, g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-            }
-            
-            // check if master, talk to replicas
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, LOGOUT, logout_message->username(), g_nullString, g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    LogoutReply reply;
-                    LogoutMessage new_msg;
-                    new_msg.set_fromleader(true);
-                    new_msg.set_username(logout_message->username());
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->Logout(&context, new_msg, &reply);
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
-                }
-
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
-                }
-
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
+                // Replicated, committed and applied together with other queued writes
+                QueuedWrite write(makeOperation(LOGOUT, logout_message->username()));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
                 }
-
-                connectionMutex.unlock();
-
-                // Add to storage
-                int logoutStatus = tryLogout(logout_message->username());
-
             } else if (leaderVals.leaderidx != -1) {
                 // If there is a leader, but it's not me
                 server_reply->set_leader(leaderVals.leaderAddress);
@@ -366,7 +937,8 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
 
         // ListUsers RPC implementation
         Status ListUsers(ServerContext* context, const QueryUsersMessage* query, ServerWriter<User>* writer) {
-            if (leaderVals.isLeader) {
+            // Reads come straight from memory, no log entry
+            if ((leaderVals.isLeader && holdsLease()) || (query->allowstaleread() && withinStaleness())) {
                 std::string prefix = query->username();
                 std::vector<std::string> usernames;
                 userTrie_mutex.lock();
@@ -405,58 +977,14 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             std::string recipientUsername = msg->recipientusername();
             std::string messageContent = msg->msgcontent();
 
-            // Update clock value and write to pending if the message was from the leader
-            if (msg->fromleader()) {
-                clockVal = std::max(msg->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, SEND_MESSAGE, senderUsername, recipientUsername, g_nullString, messageContent, g_nullString, g_nullString, clockVal);
-            }
-             
-            // check if master, talk to replicas
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, SEND_MESSAGE, senderUsername, recipientUsername, g_nullString, messageContent, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    SendMessageReply reply;
-                    ChatMessage new_msg;
-                    new_msg.set_msgcontent(msg->msgcontent());
-                    new_msg.set_senderusername(msg->senderusername());
-                    new_msg.set_recipientusername(msg->recipientusername());
-                    new_msg.set_leader(msg->leader());
-                    new_msg.set_fromleader(true);
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->SendMessage(&context, new_msg, &reply);
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
-                }
-
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
-                }
-
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
+                // Replicated, committed and applied together with other queued writes
+                QueuedWrite write(makeOperation(SEND_MESSAGE, senderUsername, recipientUsername, "", messageContent));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
                 }
-                
-                connectionMutex.unlock();
 
-                // Add to storage
-                int sendMessageStatus = trySendMessage(senderUsername, recipientUsername, messageContent);
+                int sendMessageStatus = write.status;
 
                 if (sendMessageStatus == 0) {
                     server_reply->set_messagesent(true);
@@ -479,10 +1007,10 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
         // QUeryNotifications RPC implementation
         Status QueryNotifications(ServerContext* context, const QueryNotificationsMessage* query, 
                                 ServerWriter<Notification>* writer) {
-            // Update clock value and write to pending if the message was from the leader
-            if (leaderVals.isLeader) {
+            // Reads come straight from memory, no log entry
+            if (leaderVals.isLeader && holdsLease()) {
                 std::string clientUsername = query->user();
-                std::vector<std::pair<char [g_UsernameLimit], char> > notifications = conversationsDictionary.getNotifications(clientUsername);
+                std::vector<std::pair<char [g_UsernameLimit], char> > notifications = conversationsDictionary.getNotifications(userIds.find(clientUsername));
                 
                 for (auto notification : notifications) {
                     std::cout << "Username: " << notification.first << ", " << std::to_string(notification.second) << " notifications" << std::endl;
@@ -509,56 +1037,8 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
         // QueryMessages RPC implemetation
         Status QueryMessages(ServerContext* context, const QueryMessagesMessage* query, 
                             ServerWriter<ChatMessage>* writer) {
-            // Update clock value and write to pending if the message was from the leader
-            if (query->fromleader()) {
-                clockVal = std::max(query->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, QUERY_MESSAGES, query->clientusername(), query->otherusername(), g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-            }
-
-            // check if master, talk to replicas
-            if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, QUERY_MESSAGES, query->clientusername(), query->otherusername(), g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    QueryMessagesMessage new_msg;
-                    new_msg.set_clientusername(query->clientusername());
-                    new_msg.set_otherusername(query->otherusername());
-                    new_msg.set_fromleader(true);
-                    new_msg.set_clockval(clockVal);
-                    std::unique_ptr<ClientReader<ChatMessage>> reader(it->second->QueryMessages(&context, new_msg));
-                    Status status = reader->Finish();
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
-                }
-
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    std::cout << "Erasing connection to " << droppedConnections[i] << std::endl;
-                    addressToStub.erase(droppedConnections[i]);
-                }
-               
-               // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
-                }
-
-                connectionMutex.unlock();
-
-                // Add to storage
+            // Reads come straight from memory, the paging cursor is local to this server
+            if ((leaderVals.isLeader && holdsLease()) || (query->allowstaleread() && withinStaleness())) {
                 std::cout << "Getting messages between '" << query->clientusername() << "' and '"<< query->otherusername() << "'" << std::endl;
 
                 std::vector<ChatMessage> queryMessagesMessageList = tryQueryMessages(query->clientusername(), query->otherusername());
@@ -566,12 +1046,12 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
                 for (auto message : queryMessagesMessageList) {
                     writer->Write(message);
                 }
-            } else if (leaderVals.leaderidx != -1 && !query->fromleader()) {
+            } else if (leaderVals.leaderidx != -1) {
                 // If there is a leader, but it's not me
                 ChatMessage message;
                 message.set_leader(leaderVals.leaderAddress);
                 writer->Write(message);
-            } else if (!query->fromleader()) {
+            } else {
                 // if there is no leader, election is going on
                 ChatMessage message;
                 message.set_leader(g_ElectionString);
@@ -584,58 +1064,15 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
         Status DeleteAccount(ServerContext* context, const DeleteAccountMessage* delete_account_message,
                             DeleteAccountReply* server_reply) {
 
-            // Update clock value and write to pending if the message was from the leader
-            if (delete_account_message->fromleader()) {
-                clockVal = std::max(delete_account_message->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, DELETE_ACCOUNT, delete_account_message->username(), g_nullString, g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-            }
-            
-            // check if master, talk to replicas
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, DELETE_ACCOUNT, delete_account_message->username(), g_nullString, g_nullString, g_nullString, g_nullString, g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    DeleteAccountReply reply;
-                    
-                    DeleteAccountMessage new_msg;
-                    new_msg.set_username(delete_account_message->username());
-                    new_msg.set_password(delete_account_message->password());
-                    new_msg.set_fromleader(true);
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->DeleteAccount(&context, new_msg, &reply); 
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
+                // Replicated, committed and applied together with other queued writes
+                QueuedWrite write(makeOperation(DELETE_ACCOUNT, delete_account_message->username()));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
                 }
 
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
-                }
-
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
-                }
-
-                connectionMutex.unlock();
-
-                // Add to storage
                std::cout << "Deleting account of '" << delete_account_message->username() << "'" << std::endl;
-                // Flag user account as deleted in trie
-                int deleteAccountStatus = tryDeleteAccount(delete_account_message->username());
+                int deleteAccountStatus = write.status;
 
                 if (deleteAccountStatus == 1) {
                     server_reply->set_deletedaccount(false);
@@ -656,59 +1093,37 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
 
         // MessagesSeen RPC implementation
         Status MessagesSeen(ServerContext* context, const MessagesSeenMessage* msg, MessagesSeenReply* reply) {
-            // Update clock value and write to pending if the message was from the leader
-            if (msg->fromleader()) {
-                clockVal = std::max(msg->clockval(), clockVal);
-                writeToLogs(pendingLogWriter, MESSAGES_SEEN, msg->clientusername(), msg->otherusername(), g_nullString, g_nullString, std::to_string(msg->messagesseen()), g_nullString, clockVal);
-            }
-
-            // check if master, talk to replicas
             if (leaderVals.isLeader) {
-                clockVal++;
-                writeToLogs(pendingLogWriter, MESSAGES_SEEN, msg->clientusername(), msg->otherusername(), g_nullString, g_nullString, std::to_string(msg->messagesseen()), g_nullString, clockVal);
-                std::vector<std::string> droppedConnections;
-                
-                // Get consensus 
-                connectionMutex.lock();
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    MessagesSeenReply reply;
-
-                    MessagesSeenMessage new_msg;
-                    new_msg.set_clientusername(msg->clientusername());
-                    new_msg.set_otherusername(msg->otherusername());
-                    new_msg.set_messagesseen(msg->messagesseen());
-                    new_msg.set_fromleader(true);  
-                    new_msg.set_clockval(clockVal);
-                    Status status = it->second->MessagesSeen(&context, new_msg, &reply);
-                    
-                    if (!status.ok()) {
-                        droppedConnections.push_back(it->first);
-                    }
-                }
-                
-                // Removing dropped connections
-                for (int i = 0; i < droppedConnections.size(); i++) {
-                    addressToStub.erase(droppedConnections[i]);
+                // Replicated, committed and applied together with other queued writes
+                // The cursor is not replicated, so log where the client's page starts.
+                // Pages read from a follower carry their own start index
+                int startIdx;
+                if (msg->has_firstmessageindex()) {
+                    startIdx = msg->firstmessageindex();
+                } else {
+                    currentConversationsDictMutex.lock();
+                    startIdx = currentConversationsDict[userIds.find(msg->clientusername())].messagesSentStartIndex;
+                    currentConversationsDictMutex.unlock();
                 }
 
-                // Move last pending line to commit 
-                moveToCommit(pendingFilename, commitLogWriter);
-
-
-                // Tell replicas to commit
-                for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
-                    ClientContext context;
-                    CommitRequest request;
-                    CommitResponse reply;
-                    Status status = it->second->Commit(&context, request, &reply);
+                // Every replica applies what is logged, so the range has to lie in the conversation.
+                // Messages are never removed, so one that does now still will when it is applied
+                storageReaders.beginRead();
+                uint32_t clientId = userIds.find(msg->clientusername());
+                uint32_t otherId = userIds.find(msg->otherusername());
+                StoredMessages* storedMessages = clientId != 0 && otherId != 0 ? messagesDictionary.find(UserPair(clientId, otherId)) : nullptr;
+                int messageCount = storedMessages != nullptr ? storedMessages->messageCount() : 0;
+                storageReaders.endRead();
+                if (startIdx < 0 || startIdx >= messageCount || msg->messagesseen() < 0) {
+                    std::cout << "Ignoring messages seen from " << startIdx << " in a conversation of " << messageCount << " messages" << std::endl;
+                    return Status::OK;
                 }
+                int messagesSeen = std::min(msg->messagesseen(), messageCount - startIdx);
 
-                connectionMutex.unlock();
-
-                // Add to storage
-                int messagesSeenStatus = tryMessagesSeen(msg->clientusername(), msg->otherusername(), msg->messagesseen());
-
+                QueuedWrite write(makeOperation(MESSAGES_SEEN, msg->clientusername(), msg->otherusername(), "", "", messagesSeen, "", 0, startIdx));
+                if (!commitWrite(write)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not write to the log");
+                }
             } else if (leaderVals.leaderidx != -1) {
                 // If there is a leader, but it's not me
                 reply->set_leader(leaderVals.leaderAddress);
@@ -724,14 +1139,15 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             std::cout << "Refreshing for " << request->clientusername() << std::endl;
             // Update clock value and write to pending if the message was from the leader
             if (leaderVals.isLeader) {
-                if (queuedOperationsDictionary.find(request->clientusername()) != queuedOperationsDictionary.end()) {
+                uint32_t clientId = userIds.find(request->clientusername());
+                if (queuedOperationsDictionary.find(clientId) != queuedOperationsDictionary.end()) {
                     std::cout << "Running queued operations for '" << request->clientusername() << "'" << std::endl;
-                    for (Notification note : queuedOperationsDictionary[request->clientusername()]) {
+                    for (Notification note : queuedOperationsDictionary[clientId]) {
                         Notification* n = reply->add_notifications();
                         n->set_user(note.user());
                     }
 
-                    queuedOperationsDictionary.erase(request->clientusername());
+                    queuedOperationsDictionary.erase(clientId);
                 }
             } else if (leaderVals.leaderidx != -1) {
                 // If there is a leader, but it's not me
@@ -743,15 +1159,95 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             return Status::OK;
         }
 
-        // Commit RPC implementation
-        Status Commit(ServerContext* context, const CommitRequest* request, CommitResponse* reply) {
+        // Replicate RPC implementation, appends the leader's entries to pending and acks each request.
+        // Entries up to verifiedIndex were checked against the leader's or appended from them on this
+        // stream, only those are committed and acked. Entries after it can be left from an earlier leader
+        Status Replicate(ServerContext* context, ServerReaderWriter<ReplicateAck, ReplicateRequest>* stream) {
+            ReplicateRequest request;
+            uint64_t verifiedIndex = wal.commitIndex();
+            while (stream->Read(&request)) {
+                followerReadMutex.lock();
+                lastReplicate = std::chrono::steady_clock::now();
+                followerReadMutex.unlock();
+
+                ReplicateAck ack;
+                // A snapshot from the leader may have replaced the log meanwhile, and a catch-up
+                // may have committed more
+                verifiedIndex = std::max(std::min(verifiedIndex, wal.lastIndex()), wal.commitIndex());
+                uint64_t lastIndex = wal.lastIndex();
+
+                // Entries before this request are unchecked or missing, the leader has to resend from verifiedIndex
+                if (request.entries_size() > 0 && request.entries(0).index() > verifiedIndex + 1) {
+                    ack.set_success(false);
+                    ack.set_lastindex(verifiedIndex);
+                    stream->Write(ack);
+                    continue;
+                }
 
-            std::vector<std::string> operationToCommit = moveToCommit(pendingFilename, commitLogWriter);
+                bool diverged = false;
+                for (const LogEntry& entry : request.entries()) {
+                    // Skip entries we already have. A pending one we logged under an earlier leader
+                    // can differ from the leader's, then it and everything after it are dropped
+                    if (entry.index() <= lastIndex) {
+                        if (wal.entryMatches(entry.index(), entry.operation())) {
+                            verifiedIndex = std::max(verifiedIndex, entry.index());
+                            continue;
+                        }
+                        // A committed one cannot be dropped, only the leader's snapshot can replace it
+                        if (entry.index() <= wal.commitIndex()) {
+                            std::cout << "Committed entry " << entry.index() << " differs from the leader's, asking for a snapshot" << std::endl;
+                            diverged = true;
+                            break;
+                        }
+                        std::cout << "Dropping pending entries from " << entry.index() << ", they differ from the leader's" << std::endl;
+                        wal.truncatePending(entry.index());
+                        lastIndex = wal.lastIndex();
+                    }
+                    OperationClass newOp;
+                    if (!wal.decode(entry.operation(), newOp)) {
+                        return Status(grpc::StatusCode::DATA_LOSS, "Malformed entry " + std::to_string(entry.index()));
+                    }
+                    clockVal = std::max(newOp.clockVal, clockVal);
+                    verifiedIndex = wal.appendEncodedAsync(entry.operation(), newOp);
+                    lastIndex = verifiedIndex;
+                }
+                if (diverged) {
+                    ack.set_success(false);
+                    ack.set_needssnapshot(true);
+                    ack.set_lastindex(verifiedIndex);
+                    stream->Write(ack);
+                    continue;
+                }
+                // Our ack counts towards the leader's quorum, so the entries have to be durable first
+                if (!waitDurable(verifiedIndex)) {
+                    return Status(grpc::StatusCode::UNAVAILABLE, "Could not sync the log");
+                }
+                commitUpTo(std::min(request.commitindex(), verifiedIndex));
 
-            parseLine(operationToCommit);
+                followerReadMutex.lock();
+                leaderCommitKnown = true;
+                leaderCommitIndex = std::max(leaderCommitIndex, request.commitindex());
+                if (wal.commitIndex() >= leaderCommitIndex) {
+                    lastCaughtUp = std::chrono::steady_clock::now();
+                }
+                followerReadMutex.unlock();
+
+                ack.set_success(true);
+                ack.set_lastindex(verifiedIndex);
+                stream->Write(ack);
+            }
 
             return Status::OK;
+        }
 
+        // Commits and applies every pending entry up to commitIndex
+        void commitUpTo(uint64_t commitIndex) {
+            applyMutex.lock();
+            for (const OperationClass& op : wal.commit(commitIndex)) {
+                applyOperation(op);
+            }
+            appliedIndex = wal.commitIndex();
+            applyMutex.unlock();
         }
 
         // Heartbeat RPC implementation
@@ -771,6 +1267,10 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
                 reply->set_accept(false);
                 reply->set_leader(leaderVals.leaderAddress);
             }
+            else if (withinLeaderLease()) {
+                std::cout << "Leader lease has not run out, reject leader election" << std::endl;
+                reply->set_accept(false);
+            }
             else {
                 std::cout << "Accept leader election" << std::endl;
                 reply->set_accept(true);
@@ -782,63 +1282,138 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
 
         // LeaderElection RPC implementation
         Status LeaderElection(ServerContext* context, const CandidateValue* request, LeaderElectionResponse* reply) {
+            if (withinLeaderLease()) {
+                std::cout << "Leader lease has not run out, reject vote" << std::endl;
+                return Status(grpc::StatusCode::FAILED_PRECONDITION, "Leader lease has not run out");
+            }
+
             // Update leader candidate values
             leaderElectionValuesMutex.lock();
             electionVals.numberOfCandidatesReceived++;
-            std::cout << "Current winning value: " << std::to_string(electionVals.maxLeaderElectionVal) << std::endl;
-            std::cout << "New value:" << std::to_string(request->number()) << std::endl;
-            if (request->number() > electionVals.maxLeaderElectionVal) {
-                electionVals.maxLeaderElectionVal = request->number();
-                electionVals.currLeaderCandidateAddr = request->address();
-            }
-            // tie breaker, choose candidate with address that is lexicographically larger
-            else if (request->number() == electionVals.maxLeaderElectionVal) {
-                if (electionVals.currLeaderCandidateAddr.compare(request->address()) > 0) {
-                    electionVals.currLeaderCandidateAddr = request->address();
-                }
-            }
+            std::cout << "Current winning log: " << electionVals.maxLastIndex << " entries, " << electionVals.maxCommitIndex << " committed" << std::endl;
+            std::cout << "New log: " << request->lastindex() << " entries, " << request->commitindex() << " committed" << std::endl;
+            electionVals.consider(request->lastindex(), request->commitindex(), request->address());
             leaderElectionValuesMutex.unlock();
             return Status::OK;
         }
 
         // Write stream of operations to logs
-        Status AddToPending(ServerContext* context, ServerReader<Operation>* reader, AddToPendingResponse* response) {
-            // delete your own commit logs
+        Status AddToPending(ServerContext* context, ServerReader<LogBlock>* reader, AddToPendingResponse* response) {
+            // The leader sends the committed entries after our log position, our own pending
+            // entries were merged into its log so they are dropped here
             std::cout << "Adding stuff to pending" << std::endl;
+            wal.truncatePending();
+
+            LogBlock block;
+            std::string entries;
+            applyMutex.lock();
+            while (reader->Read(&block)) {
+                // A block never inflates past one full block plus its last entry
+                if (block.rawlength() > g_compressionBlockBytes + g_walMaxPayloadBytes + 8 ||
+                        !decompressBlock(block.data().data(), block.data().size(), block.rawlength(), entries)) {
+                    applyMutex.unlock();
+                    return Status(grpc::StatusCode::DATA_LOSS, "Corrupt block at " + std::to_string(block.firstindex()));
+                }
+                const char* data = entries.data();
+                const char* end = data + entries.size();
+                for (uint64_t index = block.firstindex(); data < end; index++) {
+                    FieldView operation;
+                    if (!getVarString(data, end, operation)) {
+                        applyMutex.unlock();
+                        return Status(grpc::StatusCode::DATA_LOSS, "Malformed entry " + std::to_string(index));
+                    }
+                    uint64_t lastIndex = wal.lastIndex();
+                    if (index <= lastIndex) {
+                        continue;
+                    }
+                    if (index != lastIndex + 1) {
+                        applyMutex.unlock();
+                        return Status(grpc::StatusCode::FAILED_PRECONDITION, "Missing entries before " + std::to_string(index));
+                    }
+                    std::string payload(operation.data, operation.size);
+                    OperationClass newOp;
+                    if (!wal.decode(payload, newOp)) {
+                        applyMutex.unlock();
+                        return Status(grpc::StatusCode::DATA_LOSS, "Malformed entry " + std::to_string(index));
+                    }
+                    wal.commit(wal.appendEncodedAsync(payload, newOp));
 
-            Operation op;
-            while (reader->Read(&op)) {
-                writeToLogs(commitLogWriter, std::stoi(op.message_type()), op.username1(), op.username2(),
-                        op.password(), op.message_content(), op.messagesseen(), op.leader(), std::stoi(op.clockval()));
+                    clockVal = newOp.clockVal;
+                    applyOperation(newOp);
+                    appliedIndex = index;
+                }
+            }
+            applyMutex.unlock();
+            if (!waitDurable(wal.lastIndex())) {
+                return Status(grpc::StatusCode::UNAVAILABLE, "Could not sync the log");
+            }
+
+            return Status::OK;
+        }
 
-                std::vector<std::string> row{op.message_type(), op.username1(), op.username2(), op.password(),
-                                             op.message_content(), op.messagesseen(), op.leader(), op.clockval()};
-                clockVal = std::stoi(op.clockval());
-                parseLine(row);
+        // RequestLogPosition RPC implementation
+        Status RequestLogPosition(ServerContext* context, const LogPositionRequest* request, LogPosition* position) {
+            applyMutex.lock();
+            position->set_appliedindex(appliedIndex);
+            position->set_clockval(clockVal);
+            uint32_t checksum;
+            if (appliedIndex > 0 && wal.entryChecksum(appliedIndex, checksum)) {
+                position->set_hasappliedchecksum(true);
+                position->set_appliedchecksum(checksum);
             }
-            
+            applyMutex.unlock();
+            return Status::OK;
+        }
+
+        // InstallSnapshot RPC implementation, replaces this server's state and log with the leader's snapshot
+        Status InstallSnapshot(ServerContext* context, ServerReader<SnapshotChunk>* reader, InstallSnapshotResponse* response) {
+            std::string snapshot;
+            SnapshotChunk chunk;
+            while (reader->Read(&chunk)) {
+                snapshot.append(chunk.data());
+            }
+
+            uint64_t index = 0;
+            int64_t snapshotClockVal = 0;
+            std::vector<std::string> usernames;
+            applyMutex.lock();
+            // Stale reads hold on to the conversations about to be freed
+            storageReaders.beginReplace();
+            if (snapshot.empty()) {
+                clearStorage();
+                unlink(snapshotPath().c_str());
+            } else if (loadSnapshot(snapshot, index, snapshotClockVal, &usernames)) {
+                writeSnapshotFile(snapshotPath(), snapshot);
+            } else {
+                storageReaders.endReplace();
+                applyMutex.unlock();
+                return Status(grpc::StatusCode::DATA_LOSS, "Snapshot is corrupt");
+            }
+            storageReaders.endReplace();
+            std::cout << "Installed snapshot at index " << index << std::endl;
+
+            // delete your own log, it continues after the snapshot
+            wal.reset(index, usernames);
+            clockVal = snapshotClockVal;
+            appliedIndex = index;
+            snapshotIndex = index;
+            applyMutex.unlock();
+
             return Status::OK;
         }
 
         // RequestPendingLog RPC implementation
         Status RequestPendingLog(ServerContext* context, const PendingLogRequest* request, 
-                                ServerWriter<Operation>* writer) {
-            std::vector<std::vector<std::string>> vectorizedLines;
-            std::cout << "Pending logs were requested, reading file" << std::endl;
-            readFile(&vectorizedLines, pendingFilename);
-            for (int idx = 1; idx < vectorizedLines.size(); idx++) {
-                std::vector<std::string> line = vectorizedLines[idx];
-                Operation op;
-                op.set_clockval(line[7]);
-                op.set_message_type(line[0]);
-                op.set_username1(line[1]);
-                op.set_username2(line[2]);
-                op.set_password(line[3]);
-                op.set_message_content(line[4]);
-                op.set_messagesseen(line[5]);
-                op.set_leader(line[6]);
-                writer->Write(op);
-            }
+                                ServerWriter<LogEntry>* writer) {
+            std::cout << "Pending logs were requested, reading log" << std::endl;
+            // The new leader's log may intern usernames differently, so the stream interns them on its own
+            UsernameDictionary usernames;
+            wal.forEachEntryView(wal.commitIndex() + 1, wal.lastIndex(), [&writer, &usernames](uint64_t index, const OperationView& pendingOp) {
+                LogEntry entry;
+                entry.set_index(index);
+                entry.set_operation(encodeStreamedOperation(pendingOp, usernames, index));
+                writer->Write(entry);
+            });
             
             return Status::OK;
         }
@@ -849,6 +1424,7 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             std::unique_ptr<ChatService::Stub> stub_ = ChatService::NewStub(channel);
             std::cout << "Adding connection to " << server_address << std::endl;
             addressToStub[server_address] = std::move(stub_);
+            clusterSize++;
         }
 
         // Heartbeat message from replicas to leader
@@ -882,6 +1458,11 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
 
         // Proposes leader election
         bool proposeLeaderElection() {
+            // The leader may still be serving reads on a lease our ack renewed
+            if (withinLeaderLease()) {
+                std::cout << "Leader lease has not run out, not proposing leader election" << std::endl;
+                return false;
+            }
             std::cout << "Proposing leader election" << std::endl;
             LeaderElectionProposal message;
 
@@ -912,44 +1493,41 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             return true;
         }
 
-        // Conducts leader election
-        void leaderElection() {
-            int candidateValue;
-            if (g_startingUp) {
-                commitLogWriter.seekp(0, commitLogWriter.end);
-                candidateValue = commitLogWriter.tellp();
-                commitLogWriter.seekp(0, commitLogWriter.beg);
-            } else {
-                candidateValue = rand();
-            }
+        // Conducts leader election. The server with the most up to date log wins, so entries a
+        // quorum acked survive. Returns true if we won, then we only start leading once
+        // reconcileLogs has merged everyone's pending entries
+        bool leaderElection() {
+            uint64_t lastIndex = wal.lastIndex();
+            uint64_t commitIndex = wal.commitIndex();
 
             leaderElectionValuesMutex.lock();
-            if (candidateValue > electionVals.maxLeaderElectionVal) {
-                electionVals.currLeaderCandidateAddr = myAddress;
-                electionVals.maxLeaderElectionVal = candidateValue;
-            }
-            else if (candidateValue == electionVals.maxLeaderElectionVal) {
-                if (electionVals.currLeaderCandidateAddr.compare(myAddress) > 0) {
-                    electionVals.currLeaderCandidateAddr = myAddress;
-                }
-            }
+            electionVals.consider(lastIndex, commitIndex, myAddress);
             leaderElectionValuesMutex.unlock();
 
             CandidateValue message;
-            message.set_number(candidateValue);
             message.set_address(myAddress);
+            message.set_lastindex(lastIndex);
+            message.set_commitindex(commitIndex);
 
             // send election value to all other servers
-            for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
+            for (auto it = addressToStub.begin(); it != addressToStub.end();) {
                 ClientContext context;
                 LeaderElectionResponse reply;
                 Status status =  it->second->LeaderElection(&context, message, &reply);
                 if (status.ok()) {
-                    continue;
+                    it++;
+                }
+                else if (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) {
+                    // Still within the old leader's lease, try again once it ran out
+                    std::cout << "Vote was refused: " << status.error_message() << std::endl;
+                    leaderElectionValuesMutex.lock();
+                    electionVals = ElectionValues();
+                    leaderElectionValuesMutex.unlock();
+                    return false;
                 }
                 else {
                     std::cout << status.error_code() << ": " << status.error_message() << std::endl;
-                    addressToStub.erase(it->first);
+                    it = addressToStub.erase(it);
                 }
             }
 
@@ -966,75 +1544,156 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             // select new leader
             leaderMutex.lock();
             leaderVals.leaderAddress = electionVals.currLeaderCandidateAddr;
-            if (electionVals.currLeaderCandidateAddr == myAddress) {
-                leaderVals.isLeader = true;
-                leaderVals.leaderidx = -1;
-            }
-            else {
-                leaderVals.isLeader = false;
-                leaderVals.leaderidx = 1;
-            }
+            bool won = electionVals.currLeaderCandidateAddr == myAddress;
+            leaderVals.isLeader = false;
+            leaderVals.leaderidx = won ? -1 : 1;
             leaderMutex.unlock();
 
+            // No stale reads until the new leader tells us its commit index
+            followerReadMutex.lock();
+            leaderCommitKnown = false;
+            leaderCommitIndex = 0;
+            lastCaughtUp = std::chrono::steady_clock::time_point();
+            followerReadMutex.unlock();
+
             std::cout << "New leader is " << leaderVals.leaderAddress << std::endl;
 
             leaderElectionValuesMutex.lock();
-            electionVals.currLeaderCandidateAddr = "";
-            electionVals.maxLeaderElectionVal = -1;
-            electionVals.numberOfCandidatesReceived = 0;
+            electionVals = ElectionValues();
             leaderElectionValuesMutex.unlock();
 
             std::cout << "Leader election finished" << std::endl;
-            if (!leaderVals.isLeader && g_startingUp) {
+            if (!won && g_startingUp) {
                 g_startingUp = false;
-
-                // truncate leader
-                std::ofstream commitLogOverWriter;
-                commitLogOverWriter.open(commitFilename, std::fstream::trunc);
-                commitLogOverWriter.close();
-
-                commitLogWriter << g_csvFields << std::endl;
-                
             }
+            return won;
         }
         
-        // For leader to send commit logs
-        void sendLogs(std::string filename) {
-        
-            // Read committed content
-            std::vector<std::vector<std::string>> content;
-            readFile(&content, filename);
-
-            if (filename == commitFilename) {
-                for (int i = 1; i < content.size(); i++) {
-                    parseLine(content[i]);
-                    clockVal = std::stoi(content[i][7]);
+        // Loads the snapshot and applies the committed entries after it, used on startup
+        void replayLog() {
+            applyMutex.lock();
+            std::string snapshot;
+            uint64_t index = 0;
+            int64_t snapshotClockVal = 0;
+            if (readSnapshotFile(snapshotPath(), snapshot) && loadSnapshot(snapshot, index, snapshotClockVal)) {
+                std::cout << "Loaded snapshot at index " << index << std::endl;
+                snapshotIndex = index;
+                clockVal = snapshotClockVal;
+            }
+
+            // Replays straight out of the mapped log, fields are only copied into storage
+            wal.forEachCommittedView(snapshotIndex + 1, [this](uint64_t index, const OperationView& op) {
+                applyOperation(op);
+                clockVal = op.clockVal;
+            });
+            appliedIndex = wal.commitIndex();
+            applyMutex.unlock();
+        }
+
+        // Streams the snapshot on disk to a follower, an empty stream if there is none.
+        // index is set to the last entry the snapshot covers
+        bool sendSnapshot(ChatService::Stub* stub, uint64_t& index) {
+            std::string snapshot;
+            int64_t snapshotClockVal = 0;
+            index = 0;
+            if (readSnapshotFile(snapshotPath(), snapshot) && !readSnapshotHeader(snapshot, index, snapshotClockVal)) {
+                snapshot.clear();
+                index = 0;
+            }
+
+            // The snapshot is mostly message text, so gRPC compresses it on the wire
+            ClientContext context;
+            context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
+            InstallSnapshotResponse response;
+            std::unique_ptr<ClientWriter<SnapshotChunk>> writer(stub->InstallSnapshot(&context, &response));
+            for (size_t offset = 0; offset < snapshot.size(); offset += g_snapshotChunkBytes) {
+                SnapshotChunk chunk;
+                chunk.set_data(snapshot.substr(offset, g_snapshotChunkBytes));
+                if (!writer->Write(chunk)) {
+                    break;
                 }
             }
+            writer->WritesDone();
+
+            Status status = writer->Finish();
+            if (!status.ok()) {
+                std::cout << "Sending snapshot failed with error code: " << status.error_code() << ", message: " << status.error_message() << std::endl;
+            }
+            return status.ok();
+        }
 
+        // For leader to send commit logs
+        void sendLogs() {
             // Send to other connections
             std::cout << "Iterating over connections " << std::endl;
             for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
                 if (it->first != leaderVals.leaderAddress) {
-                    ClientContext context;
-                    AddToPendingResponse response;
-                    std::unique_ptr<ClientWriter<Operation>> writer(it->second->AddToPending(&context, &response));
-
-                    for (int i = 1; i < content.size(); i++) {
-                        Operation op;
-
-                        op.set_message_type(content[i][0]);
-                        op.set_username1(content[i][1]);
-                        op.set_username2(content[i][2]);
-                        op.set_password(content[i][3]);
-                        op.set_message_content(content[i][4]);
-                        op.set_messagesseen(content[i][5]);
-                        op.set_leader(content[i][6]);
-                        op.set_clockval(content[i][7]);
-
-                        writer->Write(op);
+                    // Find out how much of the log the follower already has
+                    ClientContext positionContext;
+                    LogPositionRequest positionRequest;
+                    LogPosition position;
+                    Status positionStatus = it->second->RequestLogPosition(&positionContext, positionRequest, &position);
+                    if (!positionStatus.ok()) {
+                        std::cout << "Could not get log position of " << it->first << std::endl;
+                        continue;
+                    }
 
+                    // Only the missing suffix is sent, unless it was compacted away, the follower is
+                    // somehow ahead of us, or its entry at appliedIndex is not the one we have there.
+                    // Then it gets the snapshot and the entries after it
+                    uint64_t from = position.appliedindex() + 1;
+                    bool agrees = true;
+                    if (position.appliedindex() > 0 && position.appliedindex() <= wal.commitIndex()) {
+                        uint32_t checksum;
+                        agrees = position.hasappliedchecksum() && wal.entryChecksum(position.appliedindex(), checksum) &&
+                            checksum == position.appliedchecksum();
+                    }
+                    if (!agrees) {
+                        std::cout << it->first << " applied a different entry " << position.appliedindex() << " than ours" << std::endl;
+                    }
+                    if (!agrees || from < wal.firstIndex() || position.appliedindex() > wal.commitIndex()) {
+                        uint64_t index;
+                        if (!sendSnapshot(it->second.get(), index)) {
+                            continue;
+                        }
+                        from = index + 1;
                     }
+                    std::cout << "Sending " << it->first << " entries from " << from << std::endl;
+
+                    ClientContext context;
+                    AddToPendingResponse response;
+                    std::unique_ptr<ClientWriter<LogBlock>> writer(it->second->AddToPending(&context, &response));
+
+                    // Entries go out in compressed blocks of about g_compressionBlockBytes
+                    std::string entries;
+                    uint64_t firstIndex = 0;
+                    size_t rawBytes = 0;
+                    size_t sentBytes = 0;
+                    auto sendBlock = [&]() {
+                        std::string compressed;
+                        if (entries.empty() || !compressBlock(entries.data(), entries.size(), compressed)) {
+                            return;
+                        }
+                        LogBlock block;
+                        block.set_firstindex(firstIndex);
+                        block.set_rawlength(entries.size());
+                        block.set_data(std::move(compressed));
+                        rawBytes += entries.size();
+                        sentBytes += block.data().size();
+                        writer->Write(block);
+                        entries.clear();
+                    };
+                    wal.forEachCommittedEncoded(from, [&](uint64_t index, const char* payload, uint32_t length) {
+                        if (entries.empty()) {
+                            firstIndex = index;
+                        }
+                        putVarString(entries, payload, length);
+                        if (entries.size() >= g_compressionBlockBytes) {
+                            sendBlock();
+                        }
+                    });
+                    sendBlock();
+                    std::cout << "Sent " << rawBytes << " bytes of entries as " << sentBytes << std::endl;
 
                     writer->WritesDone();
 
@@ -1072,27 +1731,34 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             leaderMutex.unlock();
         }
 
-        // Sends logs upon request
+        // Sends logs upon request. A follower's pending entry that we already committed at the same
+        // index is left out, it only missed the commit index
         void requestLogs(std::vector<OperationClass>& operations) {
             std::cout << "Iterating through connections" << std::endl;
             std::vector<std::string> droppedConnections;
+            uint64_t commitIndex = wal.commitIndex();
             for (auto it = addressToStub.begin(); it != addressToStub.end(); it++) {
                 std::cout << "Requesting pending logs from " << it->first << std::endl;
                 ClientContext context;
                 PendingLogRequest request;
-                Operation op;
-                std::unique_ptr<ClientReader<Operation>> reader(it->second->RequestPendingLog(&context, request));
-                while (reader->Read(&op)) {
-                    OperationClass newOp;
-                    newOp.clockVal = std::stoi(op.clockval());
-                    newOp.opCode = std::stoi(op.message_type());
-                    newOp.username1 = op.username1();
-                    newOp.username2 = op.username2();
-                    newOp.password = op.password();
-                    newOp.message_content = op.message_content();
-                    newOp.messagesseen = op.messagesseen();
-                    newOp.leader = op.leader();
-                    operations.push_back(newOp);
+                LogEntry entry;
+                std::unique_ptr<ClientReader<LogEntry>> reader(it->second->RequestPendingLog(&context, request));
+                UsernameDictionary usernames;
+                while (reader->Read(&entry)) {
+                    OperationClass op;
+                    if (!decodeStreamedOperation(entry.operation(), op, usernames, entry.index())) {
+                        std::cout << "Dropping malformed pending entry from " << it->first << std::endl;
+                        continue;
+                    }
+                    bool committed = false;
+                    if (entry.index() <= commitIndex) {
+                        wal.forEachEntry(entry.index(), entry.index(), [&op, &committed](uint64_t index, OperationClass& ours) {
+                            committed = sameOperation(op, ours);
+                        });
+                    }
+                    if (!committed) {
+                        operations.push_back(op);
+                    }
                 }
 
                 Status status = reader->Finish();
@@ -1108,31 +1774,60 @@ class ChatServiceImpl final : public chatservice::ChatService::Service {
             }
         }
 
-        // Writes vector of operations into pending
-        void writePendingOperations(std::vector<OperationClass> operations) {
+        // Getter for the operations that are pending in this server's log
+        std::vector<OperationClass> getPendingOperations() {
+            return wal.pendingEntries();
+        }
+
+        // Replaces the pending entries of the log with operations, returns false if they could not be made durable
+        bool writePendingOperations(std::vector<OperationClass> operations) {
+            wal.truncatePending();
             for (OperationClass op : operations) {
-                writeToLogs(pendingLogWriter, op.opCode, op.username1, op.username2, op.password,
-                            op.message_content, op.messagesseen, op.leader, op.clockVal);
+                wal.appendAsync(op);
             }
+            return waitDurable(wal.lastIndex());
         }
 
-        // Moves every operation from pending into the commit file
-        void moveAllPendingToCommit() {
-            // Read pending file
-            std::vector<std::vector<std::string>> content;
-            readFile(&content, pendingFilename);
-
-            // Write to commit file
-            for (int i = 1; i < content.size(); i++) {
-                writeToLogs(commitLogWriter, stoi(content[i][0]), content[i][1], content[i][2], content[i][3], content[i][4], content[i][5], content[i][6], stoi(content[i][7]));
-                parseLine(content[i]);
+        // Run by the winner of every election before it starts leading. Pending entries of every
+        // server are merged into our log and committed, then followers get what they are missing
+        void reconcileLogs() {
+            // Request pending with Request Pending Log
+            std::vector<OperationClass> operations;
+            std::cout << "Requesting pending logs" << std::endl;
+            requestLogs(operations);
+            std::cout << "Reading own pending log" << std::endl;
+            std::vector<OperationClass> ownPending = getPendingOperations();
+            operations.insert(operations.end(), ownPending.begin(), ownPending.end());
+            std::cout << "Sorting operations" << std::endl;
+            sortOperations(operations);
+            removeDuplicateOperations(operations);
+            std::cout << "Writing pending operations to log" << std::endl;
+            if (!writePendingOperations(operations)) {
+                std::cout << "Could not sync write-ahead log, not taking over as leader" << std::endl;
+                return;
             }
 
-            // Clear pending log, write first line back
-            std::ofstream pendingLogOverWriter;
-            pendingLogOverWriter.open(pendingFilename, std::fstream::trunc);
+            // Move pending logs to commit
+            std::cout << "moving pending logs to commit" << std::endl;
+            moveAllPendingToCommit();
+
+            // Send commit logs
+            std::cout << "sending commit logs" << std::endl;
+            sendLogs();
+
+            setAsLeader();
+            g_startingUp = false;
+        }
 
-            pendingLogOverWriter << g_csvFields << std::endl;
+        // Commits every pending operation by advancing the commit index, and applies them
+        void moveAllPendingToCommit() {
+            applyMutex.lock();
+            for (const OperationClass& op : wal.commit(wal.lastIndex())) {
+                applyOperation(op);
+                clockVal = std::max(clockVal, op.clockVal);
+            }
+            appliedIndex = wal.commitIndex();
+            applyMutex.unlock();
         }
 };
 
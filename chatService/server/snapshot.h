@@ -0,0 +1,277 @@
+#include "writeAheadLog.h"
+
+// Point-in-time snapshot of the replicated in-memory state.
+//
+// The file is [u32 magic][u32 checksum][u64 body length][body]. The body holds the index of the
+// last log entry the snapshot covers and the u64 clock value at that entry, followed by every user
+// with their record (password, u32 id, u64 creation clock value, u32 flags), every conversation
+// with its messages, every unread notification count and the usernames the log interned up to the
+// index, so a follower installing the snapshot can decode the entries after it. Everything at or
+// below the snapshot index can then be dropped from the log. Only user records keep their ids,
+// conversations and notifications name their users, so users deleted before the snapshot get new
+// ids on loading.
+
+std::string g_snapshotFile = "snapshot";
+const uint32_t g_snapshotMagic = 0x34504e53;     // "SNP4"
+const size_t g_snapshotHeaderBytes = 16;
+const size_t g_snapshotPositionBytes = 16;     // index and clock value at the start of the body
+
+// Serializes userTrie, messagesDictionary and conversationsDictionary. Callers must keep writes
+// from being applied while this runs, so the snapshot matches the log at index
+std::string encodeSnapshot(uint64_t index, int64_t clockVal, const std::vector<std::string>& usernames = std::vector<std::string>()) {
+    std::string body;
+    putU64(body, index);
+    putU64(body, static_cast<uint64_t>(clockVal));
+
+    // Users and their records
+    std::string users;
+    uint32_t numberOfUsers = 0;
+    userTrie_mutex.lock();
+    userTrie.forEachUser([&users, &numberOfUsers](const std::string& username, const UserRecord& record) {
+        putString(users, username);
+        putString(users, record.credential);
+        putU32(users, record.id);
+        putU64(users, static_cast<uint64_t>(record.createdAt));
+        putU32(users, record.flags);
+        numberOfUsers++;
+    });
+    userTrie_mutex.unlock();
+    putU32(body, numberOfUsers);
+    body.append(users);
+
+    // Conversations and their messages
+    // Queries may add empty conversations meanwhile, so they are counted as they are written
+    std::string conversations;
+    uint32_t numberOfConversations = 0;
+    messagesDictionary.forEach([&conversations, &numberOfConversations](const UserPair& pair, StoredMessages& storedMessages) {
+        putString(conversations, userIds.name(pair.smallerId()));
+        putString(conversations, userIds.name(pair.largerId()));
+        storedMessages.messageMutex.lock();
+        putU32(conversations, storedMessages.messageList.size());
+        for (const StoredMessage& message : storedMessages.messageList) {
+            putString(conversations, userIds.name(message.senderId));
+            conversations.push_back(message.isRead ? 1 : 0);
+            putString(conversations, message.messageContent);
+        }
+        storedMessages.messageMutex.unlock();
+        numberOfConversations++;
+    });
+    putU32(body, numberOfConversations);
+    body.append(conversations);
+
+    // Unread notification counts
+    conversationsDictionary.notificationsMutex.lock();
+    putU32(body, conversationsDictionary.conversations.size());
+    for (auto& recipient : conversationsDictionary.conversations) {
+        putString(body, userIds.name(recipient.first));
+        putU32(body, recipient.second.size());
+        for (auto& sender : recipient.second) {
+            putString(body, userIds.name(sender.first));
+            putU32(body, static_cast<uint32_t>(sender.second));
+        }
+    }
+    conversationsDictionary.notificationsMutex.unlock();
+
+    // Interned usernames in id order
+    putU32(body, usernames.size());
+    for (const std::string& username : usernames) {
+        putString(body, username);
+    }
+
+    std::string snapshot;
+    putU32(snapshot, g_snapshotMagic);
+    putU32(snapshot, logChecksum(body.data(), body.size()));
+    putU64(snapshot, body.size());
+    snapshot.append(body);
+    return snapshot;
+}
+
+// Reads values out of a snapshot body, remembering if it ran past the end
+struct SnapshotReader {
+    const char* data;
+    const char* end;
+    bool ok = true;
+
+    SnapshotReader(const char* begin, size_t length) : data(begin), end(begin + length) {}
+
+    uint32_t u32() {
+        if (end - data < 4) {
+            ok = false;
+            return 0;
+        }
+        uint32_t value = getU32(data);
+        data += 4;
+        return value;
+    }
+
+    uint64_t u64() {
+        if (end - data < 8) {
+            ok = false;
+            return 0;
+        }
+        uint64_t value = getU64(data);
+        data += 8;
+        return value;
+    }
+
+    char byte() {
+        if (end - data < 1) {
+            ok = false;
+            return 0;
+        }
+        return *data++;
+    }
+
+    std::string string() {
+        uint32_t length = u32();
+        if (!ok || static_cast<size_t>(end - data) < length) {
+            ok = false;
+            return "";
+        }
+        std::string value(data, length);
+        data += length;
+        return value;
+    }
+};
+
+// Checks a snapshot and reads its index and clock value without loading it
+bool readSnapshotHeader(const std::string& snapshot, uint64_t& index, int64_t& clockVal) {
+    if (snapshot.size() < g_snapshotHeaderBytes + g_snapshotPositionBytes || getU32(snapshot.data()) != g_snapshotMagic) {
+        return false;
+    }
+    uint64_t length = getU64(snapshot.data() + 8);
+    if (snapshot.size() - g_snapshotHeaderBytes != length ||
+            logChecksum(snapshot.data() + g_snapshotHeaderBytes, length) != getU32(snapshot.data() + 4)) {
+        return false;
+    }
+    index = getU64(snapshot.data() + g_snapshotHeaderBytes);
+    clockVal = static_cast<int64_t>(getU64(snapshot.data() + g_snapshotHeaderBytes + 8));
+    return true;
+}
+
+// Empties the replicated storage, used before loading a snapshot or rebuilding from the leader
+void clearStorage() {
+    userTrie_mutex.lock();
+    userTrie.clear();
+    userTrie_mutex.unlock();
+
+    messagesDictionary.clear();
+
+    conversationsDictionary.notificationsMutex.lock();
+    conversationsDictionary.conversations.clear();
+    conversationsDictionary.notificationsMutex.unlock();
+
+    currentConversationsDictMutex.lock();
+    currentConversationsDict.clear();
+    currentConversationsDictMutex.unlock();
+
+    userIds.clear();
+}
+
+// Replaces the replicated storage with the snapshot's contents, returns false if it is corrupt.
+// The log's interned usernames are put in usernames when it is given
+bool loadSnapshot(const std::string& snapshot, uint64_t& index, int64_t& clockVal, std::vector<std::string>* usernames = nullptr) {
+    if (!readSnapshotHeader(snapshot, index, clockVal)) {
+        return false;
+    }
+    clearStorage();
+
+    SnapshotReader reader(snapshot.data() + g_snapshotHeaderBytes + g_snapshotPositionBytes,
+                          snapshot.size() - g_snapshotHeaderBytes - g_snapshotPositionBytes);
+
+    uint32_t numberOfUsers = reader.u32();
+    userTrie_mutex.lock();
+    for (uint32_t i = 0; i < numberOfUsers && reader.ok; i++) {
+        std::string username = reader.string();
+        UserRecord record;
+        record.credential = reader.string();
+        record.id = reader.u32();
+        record.createdAt = static_cast<int64_t>(reader.u64());
+        record.flags = reader.u32();
+        if (reader.ok) {
+            userIds.assign(username, record.id);
+            userTrie.restoreUser(username, record);
+        }
+    }
+    userTrie_mutex.unlock();
+
+    uint32_t numberOfConversations = reader.u32();
+    for (uint32_t i = 0; i < numberOfConversations && reader.ok; i++) {
+        // Users deleted before the snapshot only have names here, they get their ids now
+        uint32_t smallerId = userIds.intern(reader.string());
+        uint32_t largerId = userIds.intern(reader.string());
+        StoredMessages& storedMessages = messagesDictionary[UserPair(smallerId, largerId)];
+        uint32_t numberOfMessages = reader.u32();
+        storedMessages.messageList.reserve(numberOfMessages);
+        for (uint32_t m = 0; m < numberOfMessages && reader.ok; m++) {
+            uint32_t senderId = userIds.intern(reader.string());
+            bool isRead = reader.byte() != 0;
+            std::string content = reader.string();
+            storedMessages.messageList.push_back(StoredMessage(senderId, isRead, content));
+        }
+    }
+
+    uint32_t numberOfRecipients = reader.u32();
+    conversationsDictionary.notificationsMutex.lock();
+    for (uint32_t i = 0; i < numberOfRecipients && reader.ok; i++) {
+        uint32_t recipientId = userIds.intern(reader.string());
+        uint32_t numberOfSenders = reader.u32();
+        for (uint32_t n = 0; n < numberOfSenders && reader.ok; n++) {
+            uint32_t senderId = userIds.intern(reader.string());
+            conversationsDictionary.conversations[recipientId][senderId] = static_cast<int>(reader.u32());
+        }
+    }
+    conversationsDictionary.notificationsMutex.unlock();
+
+    uint32_t numberOfUsernames = reader.u32();
+    for (uint32_t i = 0; i < numberOfUsernames && reader.ok; i++) {
+        std::string username = reader.string();
+        if (usernames != nullptr) {
+            usernames->push_back(username);
+        }
+    }
+
+    if (!reader.ok) {
+        std::cout << "Snapshot ended early" << std::endl;
+        clearStorage();
+    }
+    return reader.ok;
+}
+
+// Writes a snapshot next to the old one and renames it into place, so a crash leaves one intact
+bool writeSnapshotFile(std::string path, const std::string& snapshot) {
+    std::string tempPath = path + ".tmp";
+    int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cout << "Could not create " << tempPath << std::endl;
+        return false;
+    }
+    bool written = write(fd, snapshot.data(), snapshot.size()) == static_cast<ssize_t>(snapshot.size()) &&
+                   fsync(fd) == 0;
+    close(fd);
+    if (!written || rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::cout << "Could not write snapshot " << path << std::endl;
+        unlink(tempPath.c_str());
+        return false;
+    }
+
+    // Sync the directory too, or a crash can lose the rename
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : path.substr(0, slash);
+    int dirFd = ::open(directory.c_str(), O_RDONLY);
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        close(dirFd);
+    }
+    return true;
+}
+
+// Reads a whole snapshot file, returns false if there is none
+bool readSnapshotFile(std::string path, std::string& snapshot) {
+    std::ifstream reader(path, std::ios::binary);
+    if (!reader.good()) {
+        return false;
+    }
+    snapshot.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+    return true;
+}
@@ -1,5 +1,6 @@
 #include "../chatService.pb.h"
 #include "../globals.h"
+#include "adaptiveRadixTree.h"
 
 #include <arpa/inet.h>
 #include <string.h>
@@ -11,9 +12,14 @@
 #include <tuple>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <algorithm>
 #include <atomic>
+#include <functional>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <memory>
 #include <sstream>
 #include <algorithm>
 
@@ -26,52 +32,121 @@ using chatservice::Notification;
 std::string g_pendingLogFile = "pendingLog";
 std::string g_committedLogFile = "committedLog";
 std::string g_csvFields = "message_type,username1,username2,password,message_content,messagesseen,leader,clockVal";
-std::string g_nullString = "NULL";
+std::string g_nullString = "NULL";     // placeholder for unused fields in legacy CSV logs
 std::string g_ElectionString = "olive";
 
 
 const int g_numberOfServers = 3;
 
+// Ids of every username an account was ever created under, handed out in creation order as
+// accounts are created. Storage is keyed by ids rather than names, so sends and queries hash
+// and copy integers. A name keeps its id after its account is deleted, so an account created
+// again under it finds its old conversations. Id 0 is never used. Names sit in a deque, whose
+// elements never move, so references to them stay valid while names are added
+struct UserIdTable {
+    private:
+        std::mutex idsMutex;
+        std::deque<std::string> names;      // name of id i at i - 1, empty for ids not in use
+        std::unordered_map<std::string, uint32_t> ids;
+
+    public:
+        // The name's id, giving it the next one if it has none
+        uint32_t intern(const std::string& username) {
+            idsMutex.lock();
+            auto found = ids.find(username);
+            uint32_t id;
+            if (found != ids.end()) {
+                id = found->second;
+            } else {
+                names.push_back(username);
+                id = names.size();
+                ids[username] = id;
+            }
+            idsMutex.unlock();
+            return id;
+        }
+
+        // Gives the name the id a snapshot saved for it
+        void assign(const std::string& username, uint32_t id) {
+            idsMutex.lock();
+            if (names.size() < id) {
+                names.resize(id);
+            }
+            names[id - 1] = username;
+            ids[username] = id;
+            idsMutex.unlock();
+        }
+
+        // The name's id, or 0 if no account was created under it
+        uint32_t find(const std::string& username) {
+            idsMutex.lock();
+            auto found = ids.find(username);
+            uint32_t id = found == ids.end() ? 0 : found->second;
+            idsMutex.unlock();
+            return id;
+        }
+
+        const std::string& name(uint32_t id) {
+            idsMutex.lock();
+            const std::string& username = names[id - 1];
+            idsMutex.unlock();
+            return username;
+        }
+
+        void clear() {
+            idsMutex.lock();
+            names.clear();
+            ids.clear();
+            idsMutex.unlock();
+        }
+};
+
+UserIdTable userIds;
+
 struct CurrentConversation {
-    std::string username;
-    int messagesSentStartIndex;
-    int messagesSentEndIndex;
+    uint32_t userId = 0;        // the other user
+    int messagesSentStartIndex = 0;
+    int messagesSentEndIndex = 0;
 };
 
-std::map<std::string, CurrentConversation> currentConversationsDict;
+// Paging cursor of each user's open conversation, by user id. Only the server answering the
+// query keeps it, it is not part of the replicated state
+std::unordered_map<uint32_t, CurrentConversation> currentConversationsDict;
 std::mutex currentConversationsDictMutex;
 
-// Key: user with active conversations, Value: map from users to number of notifications they have
+// Key: id of a user with active conversations, Value: map from user ids to number of notifications they have
 struct ConversationsDictionary {
-    std::unordered_map<std::string, std::unordered_map<std::string, int> > conversations;
+    std::unordered_map<uint32_t, std::unordered_map<uint32_t, int> > conversations;
     std::mutex notificationsMutex;
 
     // increment new messages
-    void newNotification(std::string senderUsername, std::string recipientUsername) {
+    void newNotification(uint32_t senderId, uint32_t recipientId) {
         notificationsMutex.lock();
-        conversations[recipientUsername][senderUsername]++;
+        conversations[recipientId][senderId]++;
         notificationsMutex.unlock();
     }  
 
     // decrement seen messages
-    void notificationSeen(char senderUsername[g_UsernameLimit], std::string recipientUsername) {
+    void notificationSeen(uint32_t senderId, uint32_t recipientId) {
         notificationsMutex.lock();
-       conversations[recipientUsername][senderUsername]--;
+        conversations[recipientId][senderId]--;
         notificationsMutex.unlock();
     }
 
-    std::vector<std::pair<char [g_UsernameLimit], char> > getNotifications(std::string recipientUsername) {
+    std::vector<std::pair<char [g_UsernameLimit], char> > getNotifications(uint32_t recipientId) {
         std::vector<std::pair<char [g_UsernameLimit], char> > allNotifications;
 
-        for (auto const& pair : conversations[recipientUsername]) {
+        notificationsMutex.lock();
+        for (auto const& pair : conversations[recipientId]) {
             if (pair.second > 0) {
                 std::pair<char [g_UsernameLimit], char> notificationItem;
-                strcpy(notificationItem.first, pair.first.c_str());
+                strcpy(notificationItem.first, userIds.name(pair.first).c_str());
                 notificationItem.second = pair.second;
 
                 allNotifications.push_back(notificationItem);
             }
         }
+        notificationsMutex.unlock();
 
         return allNotifications;
     }
@@ -81,42 +156,41 @@ struct ConversationsDictionary {
 
 ConversationsDictionary conversationsDictionary;
 
-// Messages dictionary key, consists of two usernames.
+// Messages dictionary key, the ids of two users packed into one integer, smaller id first
 struct UserPair {
-    std::string smallerUsername; // lexicographically smaller username
-    std::string largerUsername; // lexicographically larger username
+    uint64_t key;
 
-    // Initializes user pair using lexicographic ordering
-    UserPair (std::string username1, std::string username2) {
+    UserPair (uint32_t userId1, uint32_t userId2) {
+        uint32_t smallerId = std::min(userId1, userId2);
+        uint32_t largerId = std::max(userId1, userId2);
+        key = (static_cast<uint64_t>(smallerId) << 32) | largerId;
+    }
 
-        int compResult = username1.compare(username2);
+    uint32_t smallerId() const {
+        return key >> 32;
+    }
 
-        if (compResult >= 0) {
-            smallerUsername = username2;
-            largerUsername = username1;
-        } else {
-            smallerUsername = username1;
-            largerUsername = username2;
-        }
+    uint32_t largerId() const {
+        return static_cast<uint32_t>(key);
     }
 
     friend bool operator== (const UserPair& pair1, const UserPair& pair2);
 };
 
 bool operator== (const UserPair& pair1, const UserPair& pair2) {
-    return (pair1.smallerUsername == pair2.smallerUsername) && (pair1.largerUsername == pair2.largerUsername);
+    return pair1.key == pair2.key;
 }
 
 // A single messsage from a the message dictionary value vector
 struct StoredMessage {
-    std::string senderUsername;
+    uint32_t senderId;
     bool isRead;
     std::string messageContent;
 
-    StoredMessage (std::string username, bool read, std::string content) {
-        senderUsername = username;
+    StoredMessage (uint32_t sender, bool read, std::string content) {
+        senderId = sender;
         isRead = read;
-        messageContent = content;
+        messageContent = std::move(content);
     }
 };
 
@@ -133,32 +207,42 @@ struct StoredMessages {
     std::mutex messageMutex;
 
     // Adding a new message onto the messageList
-    void addMessage(std::string senderUsername, std::string recipientUsername, std::string message) {
+    void addMessage(uint32_t senderId, uint32_t recipientId, std::string message) {
         messageMutex.lock();
 
-        StoredMessage newMessage(senderUsername, false, message);
-        messageList.push_back(newMessage);
+        messageList.push_back(StoredMessage(senderId, false, std::move(message)));
 
         // Increment unread messages for recipient 
-        conversationsDictionary.newNotification(senderUsername, recipientUsername);
+        conversationsDictionary.newNotification(senderId, recipientId);
         messageMutex.unlock();
     }
 
-    // Setting a subset of messages as read given the username of the reader
-    void setRead(int startingIndex, int endingIndex, std::string readerUsername) {
+    // Setting a subset of messages as read given the id of the reader
+    //      Indices come from the log, so ones outside the list are clamped to it
+    void setRead(int startingIndex, int endingIndex, uint32_t readerId) {
         messageMutex.lock();
-        for (int i = startingIndex; i < endingIndex + 1; i++) {
-            if (messageList[i].senderUsername != readerUsername) {
+        startingIndex = std::max(startingIndex, 0);
+        endingIndex = std::min(endingIndex, static_cast<int>(messageList.size()) - 1);
+        for (int i = startingIndex; i <= endingIndex; i++) {
+            if (messageList[i].senderId != readerId) {
                 messageList[i].isRead = true;
-                conversationsDictionary.notificationSeen(const_cast<char*>(messageList[i].senderUsername.c_str()), readerUsername);
+                conversationsDictionary.notificationSeen(messageList[i].senderId, readerId);
             }
         }
         messageMutex.unlock();
 
     }
 
-    // Returning the messages a user queries
-    GetStoredMessagesReturnValue getStoredMessages(std::string readerUsername, int lastMessageDeliveredIndex) {
+    int messageCount() {
+        messageMutex.lock();
+        int count = messageList.size();
+        messageMutex.unlock();
+        return count;
+    }
+
+    // Returning the messages a user queries. Senders are named from the two users of the conversation
+    GetStoredMessagesReturnValue getStoredMessages(uint32_t readerId, const std::string& readerUsername,
+                                                   const std::string& otherUsername, int lastMessageDeliveredIndex) {
         // assert(lastMessageDeliveredIndex!=0);
         messageMutex.lock();
 
@@ -186,8 +270,9 @@ struct StoredMessages {
         // Grab relevant messages
         for (int i = firstMessageIndex; i < lastMessageIndex+1; i++) {
             ChatMessage newItem;
-            newItem.set_senderusername(messageList[i].senderUsername);
+            newItem.set_senderusername(messageList[i].senderId == readerId ? readerUsername : otherUsername);
             newItem.set_msgcontent(messageList[i].messageContent);
+            newItem.set_messageindex(i);
 
             returnValue.messageList.push_back(newItem);
         }
@@ -205,161 +290,261 @@ struct std::hash<UserPair>
 {
     size_t operator()(const UserPair& pair) const
     {
-        std::string concat = pair.smallerUsername + pair.largerUsername;
-        return std::hash<std::string>{}(concat);
+        return std::hash<uint64_t>{}(pair.key);
     }
 };
 
-std::unordered_map<UserPair, StoredMessages> messagesDictionary;
+size_t g_messagesDictionaryShards = 64;
 
-std::mutex activeUser_mutex;
-std::unordered_set<std::string> activeUsers;
+// Conversations by user pair. Queries are served while writes are applied, so the map is split
+// into shards by the pair's hash, each with its own lock, and lookups of unrelated conversations
+// do not wait on each other. Elements of an unordered_map stay put when it rehashes, so the
+// StoredMessages a lookup returns can be used after its shard is unlocked; its messageMutex
+// guards the messages themselves
+struct MessagesDictionary {
+    private:
+        struct Shard {
+            std::mutex shardMutex;
+            std::unordered_map<UserPair, StoredMessages> conversations;
+        };
 
+        std::vector<std::unique_ptr<Shard> > shards;
 
-struct CharNode {
-    char character;
-    std::unordered_map<char, CharNode*> children;
-    bool isTerminal;
+        Shard& shardOf(const UserPair& pair) {
+            // Ids are handed out in order, so mix the key before picking a shard
+            uint64_t mixed = pair.key * 0x9e3779b97f4a7c15ULL;
+            return *shards[(mixed >> 32) % shards.size()];
+        }
 
-    CharNode(char c, bool b) {
-        character = c;
-        isTerminal = b;
-    }
+    public:
+        MessagesDictionary(size_t shardCount = g_messagesDictionaryShards) {
+            resize(shardCount);
+        }
+
+        // Changes the number of shards, only while the dictionary is empty
+        void resize(size_t shardCount) {
+            shards.clear();
+            for (size_t i = 0; i < std::max(shardCount, size_t(1)); i++) {
+                shards.push_back(std::unique_ptr<Shard>(new Shard()));
+            }
+        }
+
+        // The pair's conversation, added if they have none
+        StoredMessages& operator[](const UserPair& pair) {
+            Shard& shard = shardOf(pair);
+            shard.shardMutex.lock();
+            StoredMessages& storedMessages = shard.conversations[pair];
+            shard.shardMutex.unlock();
+            return storedMessages;
+        }
+
+        // The pair's conversation, or nullptr if they have none
+        StoredMessages* find(const UserPair& pair) {
+            Shard& shard = shardOf(pair);
+            shard.shardMutex.lock();
+            auto found = shard.conversations.find(pair);
+            StoredMessages* storedMessages = found == shard.conversations.end() ? nullptr : &found->second;
+            shard.shardMutex.unlock();
+            return storedMessages;
+        }
+
+        size_t size() {
+            size_t total = 0;
+            for (auto& shard : shards) {
+                shard->shardMutex.lock();
+                total += shard->conversations.size();
+                shard->shardMutex.unlock();
+            }
+            return total;
+        }
+
+        // Calls back with every conversation, holding one shard's lock at a time
+        void forEach(const std::function<void(const UserPair&, StoredMessages&)>& callback) {
+            for (auto& shard : shards) {
+                shard->shardMutex.lock();
+                for (auto& conversation : shard->conversations) {
+                    callback(conversation.first, conversation.second);
+                }
+                shard->shardMutex.unlock();
+            }
+        }
+
+        void clear() {
+            for (auto& shard : shards) {
+                shard->shardMutex.lock();
+                shard->conversations.clear();
+                shard->shardMutex.unlock();
+            }
+        }
+};
+
+MessagesDictionary messagesDictionary;
+
+// Reads served outside the apply path keep using conversations after looking them up, so
+// replacing the storage with a snapshot waits for running reads, and reads wait while it runs
+struct StorageReaders {
+    private:
+        std::mutex readersMutex;
+        std::condition_variable readersCondition;
+        int activeReads = 0;
+        bool replacing = false;
 
-    friend struct UserTrie;
+    public:
+        void beginRead() {
+            std::unique_lock<std::mutex> lock(readersMutex);
+            readersCondition.wait(lock, [this] { return !replacing; });
+            activeReads++;
+        }
+
+        void endRead() {
+            readersMutex.lock();
+            activeReads--;
+            readersMutex.unlock();
+            readersCondition.notify_all();
+        }
+
+        void beginReplace() {
+            std::unique_lock<std::mutex> lock(readersMutex);
+            replacing = true;
+            readersCondition.wait(lock, [this] { return activeReads == 0; });
+        }
+
+        void endReplace() {
+            readersMutex.lock();
+            replacing = false;
+            readersMutex.unlock();
+            readersCondition.notify_all();
+        }
 };
 
-std::unordered_map<CharNode*, std::string> userPasswordMap;
+StorageReaders storageReaders;
+
+// Ids of logged in users
+std::mutex activeUser_mutex;
+std::unordered_set<uint32_t> activeUsers;
 
 
+// Username index, an adaptive radix tree (adaptiveRadixTree.h) whose nodes live in its own arena
 struct UserTrie {
     private:
-        std::unordered_map<char, CharNode*> roots;
+        ArtNode* root = nullptr;
+        ArtArena arena;
 
-    public:
-        // add new username to trie; return whether username was added successfully or not
-        //      If username could not be added throws invalid_argument exception
-        void addUsername(std::string username, std::string password) {
-            if (!validString(username)) {
+        ArtLeaf* findLeaf(const std::string& username) {
+            ArtLeaf* leaf = artSearch(root, username);
+            return leaf != nullptr && (leaf->record.flags & g_userRecordCreated) ? leaf : nullptr;
+        }
+
+        static void validateUsername(const std::string& username) {
+            if (username.empty() || !validString(username)) {
                 std::string errorMsg = "Username '" + username + "' is invalid. Must be alphanumeric and at least 1 character.";
                 throw std::invalid_argument(errorMsg);
             }
+        }
 
-            std::pair<CharNode*, int> nodeIdxPair = findLongestMatchingPrefix(username);
-            CharNode* currNode = nodeIdxPair.first;
+    public:
+        UserTrie() {}
 
-            if (currNode == nullptr) {
-                currNode = new CharNode(username[0], false);
-                roots[username[0]] = currNode;
-                nodeIdxPair.second = 0;
-            }
-            else if (currNode->isTerminal) {
-                std::cout << "Username '" << username << "' has already been taken." << std::endl;
-            }
+        ~UserTrie() {
+            clear();
+        }
 
-            for (int idx = nodeIdxPair.second+1; idx < username.size(); idx++) {
-                char c = username[idx];
-                CharNode* newChild = new CharNode(c, false);
-                currNode->children[c] = newChild;
-                currNode = newChild;
+        // add new username to trie; return whether username was added successfully or not
+        //      If username could not be added throws invalid_argument exception. id is the name's
+        //      id in userIds
+        void addUsername(std::string username, std::string password, uint32_t id = 0, int64_t createdAt = 0) {
+            validateUsername(username);
+
+            ArtLeaf* leaf = artInsert(root, username, arena);
+            if (leaf->record.flags & g_userRecordCreated) {
+                std::cout << "Username '" << username << "' has already been taken." << std::endl;
+            } else {
+                leaf->record.id = id;
+                leaf->record.flags = g_userRecordCreated;
+                leaf->record.createdAt = createdAt;
             }
+            leaf->record.credential = std::move(password);
+        }
 
-            currNode->isTerminal = true;
-            userPasswordMap[currNode] = password;
+        // Adds a user with the record a snapshot saved
+        void restoreUser(const std::string& username, const UserRecord& record) {
+            validateUsername(username);
+            ArtLeaf* leaf = artInsert(root, username, arena);
+            leaf->record = record;
+            leaf->record.flags |= g_userRecordCreated;
         }
 
         // Returns a vector of users with given prefix, if none found returns a runtime exception
         std::vector<std::string> returnUsersWithPrefix(std::string usernamePrefix) {
-            if (usernamePrefix.size() == 0) {
-                // Perform DFS starting at deepest node
-                std::vector<std::string> usersFound;
-                performDFS(usernamePrefix, nullptr, usersFound);
-                std::cout << "Got usernames" << std::endl;
-                return usersFound;
-            }
-            std::pair<CharNode*, int> nodeIdxPair = findLongestMatchingPrefix(usernamePrefix);
-            CharNode* deepestNode = nodeIdxPair.first;
-            int index = nodeIdxPair.second;
-
-            if (index != usernamePrefix.size()-1) {
+            std::vector<std::string> usersFound;
+            ArtNode* deepestNode = usernamePrefix.empty() ? root : artSearchPrefix(root, usernamePrefix);
+            if (deepestNode == nullptr && !usernamePrefix.empty()) {
                 std::string errorMsg = "No usernames found for prefix '" + usernamePrefix + "'";
                 throw std::runtime_error(errorMsg);
             }
 
-            // Perform DFS starting at deepest node
-            std::vector<std::string> usersFound;
-            performDFS(usernamePrefix, deepestNode, usersFound);
+            auto collect = [&usersFound](ArtLeaf* leaf) {
+                if (leaf->record.flags & g_userRecordCreated) {
+                    usersFound.push_back(leaf->key);
+                }
+            };
+            artForEachLeaf(deepestNode, collect);
             return usersFound;
         }
 
-        std::pair<CharNode*, int> findLongestMatchingPrefix(std::string username) {
-            if (roots.find(username[0]) == roots.end()) {
-                return std::make_pair(nullptr, -1);
-            }
-
-            CharNode* deepestNode = roots[username[0]];
-
-            // Find deepest matching prefix
-            int idx = 1;
-            while (idx < username.size()) {
-                char c = username[idx];
-                if ((deepestNode->children).find(c) == (deepestNode->children).end()) {
-                    break;
-                }
-                deepestNode = deepestNode->children[c];
-                idx++;
-            }
-
-            return std::make_pair(deepestNode, idx-1);
+        bool userExists(const std::string& user) {
+            return findLeaf(user) != nullptr;
         }
 
-
-        // Given a substring and current node, append to vector if node ends a username
-        void performDFS(std::string substring, CharNode* currNode, std::vector<std::string> &usersFound) {
-            if (substring.size() == 0 || currNode == nullptr) {
-                for (auto it = roots.begin(); it != roots.end(); ++it) {
-                    std::string newSubstr = substring + (*it).first;
-                    performDFS(newSubstr, (*it).second, usersFound);
-                }
-                return;
-            }
-            if (currNode->isTerminal) {
-                usersFound.push_back(substring);
-            }
-            for (auto it = currNode->children.begin(); it != currNode->children.end(); ++it) {
-                std::string newSubstr = substring + (*it).first;
-                performDFS(newSubstr, (*it).second, usersFound);
-            }
+        // The user's record, or nullptr if there is no such user. Valid until the user is deleted
+        const UserRecord* findUser(const std::string& username) {
+            ArtLeaf* leaf = findLeaf(username);
+            return leaf == nullptr ? nullptr : &leaf->record;
         }
 
-        bool userExists(std::string user) {
-            std::pair<CharNode*, int> nodeIdxPair = findLongestMatchingPrefix(user);
-            if (nodeIdxPair.first == nullptr || nodeIdxPair.second < user.size()-1 || !nodeIdxPair.first->isTerminal) {
-                return false;
-            }
-
-            return nodeIdxPair.first->isTerminal;
-        }
-
-        bool verifyUser(std::string username, std::string password) {
-            std::pair<CharNode*, int> nodeIdxPair = findLongestMatchingPrefix(username);
-            if (nodeIdxPair.first == nullptr || nodeIdxPair.second < username.size()-1 || !nodeIdxPair.first->isTerminal) {
+        bool verifyUser(const std::string& username, const std::string& password) {
+            ArtLeaf* leaf = findLeaf(username);
+            if (leaf == nullptr) {
                 std::cout << "User '" << username << "' not found." << std::endl;
                 return false;
             }
 
-            return password == userPasswordMap[nodeIdxPair.first];
+            return password == leaf->record.credential;
         }
 
         void deleteUser(std::string username) {
-            std::pair<CharNode*, int> nodeIdxPair = findLongestMatchingPrefix(username);
-            if (nodeIdxPair.first == nullptr || nodeIdxPair.second < username.size()-1 || !nodeIdxPair.first->isTerminal) {
+            if (findLeaf(username) == nullptr) {
                 std::string errorMsg = "User '" + username + "' not found.";
                 throw std::runtime_error(errorMsg);
             }
 
-            nodeIdxPair.first->isTerminal = false;
-            userPasswordMap.erase(nodeIdxPair.first);
+            artRemove(root, username, arena);
+        }
+
+        // Calls back with the username and record of every user, used for snapshots
+        void forEachUser(const std::function<void(const std::string&, const UserRecord&)>& callback) {
+            auto visit = [&callback](ArtLeaf* leaf) {
+                if (leaf->record.flags & g_userRecordCreated) {
+                    callback(leaf->key, leaf->record);
+                }
+            };
+            artForEachLeaf(root, visit);
+        }
+
+        // Removes every user, used before loading a snapshot
+        void clear() {
+            artReleaseTree(root, arena);
+            arena.freeChunks();
+            root = nullptr;
+        }
+
+        // Bytes the index holds on the heap, long usernames and credentials aside
+        size_t memoryBytes() {
+            return arena.bytes();
+        }
+
+        size_t nodeCount() {
+            return arena.liveNodes();
         }
 };
 
@@ -368,14 +553,14 @@ UserTrie userTrie;
 
 // Global storage for new messsage operations
 std::mutex queuedOperations_mutex;
-std::unordered_map<std::string, std::vector<Notification>> queuedOperationsDictionary;
+std::unordered_map<uint32_t, std::vector<Notification>> queuedOperationsDictionary;     // by recipient id
 std::unordered_map<int, bool> forceLogoutDictionary;
 
 
 // Cleaning up session-related storage structures
 void cleanup(std::string clientUsername, std::thread::id thread_id, int client_fd) {
     std::cout << "killing thread :" << thread_id << std::endl;
-    queuedOperationsDictionary.erase(clientUsername);
+    queuedOperationsDictionary.erase(userIds.find(clientUsername));
     close(client_fd);
 }
 
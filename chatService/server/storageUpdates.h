@@ -1,11 +1,18 @@
 #include "storage.h"
+#include "csvScanner.h"
 #include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tuple>
 
 // Functions for updating storage structures based on logs
-// No mutexes because these operations are done sequentially
+// Updates are applied one at a time in log order, but stale reads on followers run alongside
+// them, so each structure is locked with its own mutex where it is touched
 
-// Updates user trie with created account and also active users set
-int tryCreateAccount(std::string username, std::string password) {
+// Updates user trie with created account and also active users set. createdAt is the clock
+// value of the log entry creating it
+int tryCreateAccount(const std::string& username, const std::string& password, int64_t createdAt = 0) {
     // User already exists
     std::cout << "Trying to create account" << std::endl;
     int status = 0;
@@ -13,13 +20,14 @@ int tryCreateAccount(std::string username, std::string password) {
         status = 1;
     // User doesn't already exist
     } else {
-        // Update storage with new user
+        // Update storage with new user, under the id its name has or gets now
+        uint32_t userId = userIds.intern(username);
         userTrie_mutex.lock();
-        userTrie.addUsername(username, password);
+        userTrie.addUsername(username, password, userId, createdAt);
         userTrie_mutex.unlock();
 
         activeUser_mutex.lock();
-        activeUsers.insert(username);
+        activeUsers.insert(userId);
         activeUser_mutex.unlock();
     }
 
@@ -27,15 +35,17 @@ int tryCreateAccount(std::string username, std::string password) {
 }
 
 // Updates active users with username 
-int tryLogin(std::string username, std::string password) {
+int tryLogin(const std::string& username, const std::string& password) {
     int status = 0;
     // Check for existing user and verify password
     userTrie_mutex.lock();
-    bool verified = userTrie.verifyUser(username, password);
+    const UserRecord* record = userTrie.findUser(username);
+    bool verified = record != nullptr && record->credential == password;
+    uint32_t userId = verified ? record->id : 0;
     userTrie_mutex.unlock();
     
     if (verified) {
-        activeUsers.insert(username);
+        activeUsers.insert(userId);
     } else {
         status = 1;    // Account not able to be verified
     }
@@ -44,35 +54,42 @@ int tryLogin(std::string username, std::string password) {
 }
 
 // Removes username from active users
-int tryLogout(std::string username) {
+int tryLogout(const std::string& username) {
     int status = 0;     // User currently active
-    if (activeUsers.find(username) == activeUsers.end()) {
+    uint32_t userId = userIds.find(username);
+    if (activeUsers.find(userId) == activeUsers.end()) {
         status = 1;     // User was not active
     } else {
-        activeUsers.erase(username);
+        activeUsers.erase(userId);
     }
 
     return status;
 }
 
 // Update messages dictionary
-int trySendMessage(std::string sender, std::string recipient, std::string content) {
+int trySendMessage(const std::string& sender, const std::string& recipient, std::string content) {
     int status = 0;
-    bool senderExists = userTrie.userExists(sender);
-    bool recipientExists = userTrie.userExists(recipient);
+    // One index lookup per user tells whether they exist and gives their id
+    userTrie_mutex.lock();
+    const UserRecord* senderRecord = userTrie.findUser(sender);
+    const UserRecord* recipientRecord = userTrie.findUser(recipient);
+    uint32_t senderId = senderRecord != nullptr ? senderRecord->id : 0;
+    uint32_t recipientId = recipientRecord != nullptr ? recipientRecord->id : 0;
+    userTrie_mutex.unlock();
 
-    if (senderExists && recipientExists) {
+    if (senderId != 0 && recipientId != 0) {
         // Add message to messages dictionary
-        UserPair userPair(sender, recipient);
-        messagesDictionary[userPair].addMessage(sender, recipient, content);
+        UserPair userPair(senderId, recipientId);
+        StoredMessages& storedMessages = messagesDictionary[userPair];
+        storedMessages.addMessage(senderId, recipientId, std::move(content));
 
         // Adds queued operations for active user
         activeUser_mutex.lock();
-        if (activeUsers.find(recipient) != activeUsers.end()) {
+        if (activeUsers.find(recipientId) != activeUsers.end()) {
             queuedOperations_mutex.lock();
             Notification note;
             note.set_user(sender);
-            queuedOperationsDictionary[recipient].push_back(note);
+            queuedOperationsDictionary[recipientId].push_back(note);
             queuedOperations_mutex.unlock();
         }
         activeUser_mutex.unlock();
@@ -84,7 +101,7 @@ int trySendMessage(std::string sender, std::string recipient, std::string conten
 }
 
 // Remove account from userTrie
-int tryDeleteAccount(std::string username) {
+int tryDeleteAccount(const std::string& username) {
     int status = 0; // Account successfully deleted
     // Flag user account as deleted in trie
     userTrie_mutex.lock();
@@ -96,22 +113,32 @@ int tryDeleteAccount(std::string username) {
     userTrie_mutex.unlock();
 
     currentConversationsDictMutex.lock();
-    currentConversationsDict.erase(username);
+    currentConversationsDict.erase(userIds.find(username));
     currentConversationsDictMutex.unlock();
 
     return status;
 }
 
-int tryMessagesSeen(std::string clientusername, std::string otherusername, int messagesseen) {
+// Marks messages starting at startIdx as read, startIdx defaults to the start of the client's current page
+int tryMessagesSeen(const std::string& clientusername, const std::string& otherusername, int messagesseen, int startIdx = -1) {
     int status = 0;     // Valid query
-    UserPair userPair(clientusername, otherusername);
-    currentConversationsDictMutex.lock();
-    int startIdx = currentConversationsDict[clientusername].messagesSentStartIndex;
-    currentConversationsDictMutex.unlock();
+    uint32_t clientId = userIds.find(clientusername);
+    uint32_t otherId = userIds.find(otherusername);
+    if (clientId == 0 || otherId == 0) {
+        return 1;     // No existing coneration between user pairs
+    }
 
-    if (messagesDictionary.find(userPair) != messagesDictionary.end()) {
-            messagesDictionary[userPair].setRead(startIdx,
-                                            startIdx+messagesseen - 1, clientusername);
+    UserPair userPair(clientId, otherId);
+    if (startIdx < 0) {
+        currentConversationsDictMutex.lock();
+        startIdx = currentConversationsDict[clientId].messagesSentStartIndex;
+        currentConversationsDictMutex.unlock();
+    }
+
+    StoredMessages* storedMessages = messagesDictionary.find(userPair);
+    if (storedMessages != nullptr) {
+            storedMessages->setRead(startIdx,
+                                            startIdx+messagesseen - 1, clientId);
     } else {
         status = 1;     // No existing coneration between user pairs
     }
@@ -119,153 +146,507 @@ int tryMessagesSeen(std::string clientusername, std::string otherusername, int m
     return status;
 }
 
-std::vector<ChatMessage> tryQueryMessages(std::string clientusername, std::string otherusername) {
+// Messages are copied out while storage cannot be replaced, followers answer these too
+std::vector<ChatMessage> tryQueryMessages(const std::string& clientusername, const std::string& otherusername) {
+    // Names no account was ever created under have no messages
+    storageReaders.beginRead();
+    uint32_t clientId = userIds.find(clientusername);
+    uint32_t otherId = userIds.find(otherusername);
+    if (clientId == 0 || otherId == 0) {
+        storageReaders.endRead();
+        return std::vector<ChatMessage>();
+    }
+
     // Get stored messages depending on if the client has the conversation open
-    UserPair userPair(clientusername, otherusername);
+    UserPair userPair(clientId, otherId);
     int lastMessageDeliveredIndex = -1;
+    StoredMessages& storedMessages = messagesDictionary[userPair];
+
+    // The client's cursor is read, moved and stored back as one step, or two queries of the
+    // same client could both start from the old cursor
     currentConversationsDictMutex.lock();
-    CurrentConversation currentConversation = currentConversationsDict[clientusername];
-    if (currentConversation.username == otherusername && messagesDictionary[userPair].messageList.size() > g_MessageLimit) {
+    CurrentConversation currentConversation = currentConversationsDict[clientId];
+    if (currentConversation.userId == otherId && static_cast<size_t>(storedMessages.messageCount()) > g_MessageLimit) {
         lastMessageDeliveredIndex = currentConversation.messagesSentStartIndex;
     } else {
-        currentConversation.username = otherusername;
+        currentConversation.userId = otherId;
     }
 
     if (currentConversation.messagesSentStartIndex == 0) {
         lastMessageDeliveredIndex = -1;
     }
 
-    GetStoredMessagesReturnValue returnVal = messagesDictionary[userPair].getStoredMessages(clientusername, lastMessageDeliveredIndex);
+    GetStoredMessagesReturnValue returnVal = storedMessages.getStoredMessages(clientId, clientusername, otherusername,
+                                                                              lastMessageDeliveredIndex);
 
     // Update current conversation information
     currentConversation.messagesSentStartIndex = returnVal.firstMessageIndex;
     currentConversation.messagesSentEndIndex = returnVal.lastMessageIndex;
-    currentConversationsDict[clientusername] = currentConversation;
+    currentConversationsDict[clientId] = currentConversation;
     currentConversationsDictMutex.unlock();
+    storageReaders.endRead();
 
     return returnVal.messageList;
 }
 
-void parseLine(std::vector<std::string> line) {
-    // 
-    if (line.size() < 8) {
-        std::cout<<"would have seg faulted " << std::to_string(line.size()) <<std::endl;
-        return;
+struct OperationClass {
+    int64_t clockVal = 0;           // sequence number the leader gave the operation
+    int opCode = 0;
+    std::string username1;
+    std::string username2;
+    std::string password;
+    std::string message_content;
+    int messagesSeen = 0;
+    std::string leader;
+    int firstMessageIndex = -1;     // first message marked by MESSAGES_SEEN
+};
+
+// Builds an operation for the log, unused fields are left empty
+OperationClass makeOperation(int operation, std::string username1 = "", std::string username2 = "", std::string password = "", std::string messageContent = "", int messagesSeen = 0, std::string leader = "", int64_t clockVal = 0, int firstMessageIndex = -1) {
+    OperationClass op;
+    op.opCode = operation;
+    op.username1 = std::move(username1);
+    op.username2 = std::move(username2);
+    op.password = std::move(password);
+    op.message_content = std::move(messageContent);
+    op.messagesSeen = messagesSeen;
+    op.leader = std::move(leader);
+    op.clockVal = clockVal;
+    op.firstMessageIndex = firstMessageIndex;
+    return op;
+}
+
+// Read-only view of a field inside a log record, so replay only copies the fields it stores
+struct FieldView {
+    const char* data = nullptr;
+    size_t size = 0;
+
+    std::string str() const {
+        return std::string(data, size);
     }
-    int operation = stoi(line[0]);
-
-    switch (operation) {
-        case CREATE_ACCOUNT:
-            tryCreateAccount(line[1], line[3]);
-            break;
-        case LOGIN:
-            tryLogin(line[1], line[3]);
-            break;
-        case LOGOUT:
-            tryLogout(line[1]);
-            break;
-        case SEND_MESSAGE:
-            trySendMessage(line[1], line[2], line[4]);
-            break;
-        case QUERY_MESSAGES:
-            tryQueryMessages(line[1], line[2]);
-            break;
-        case DELETE_ACCOUNT:
-            tryDeleteAccount(line[1]);
-            break;
-        case MESSAGES_SEEN:
-            tryMessagesSeen(line[1], line[2], stoi(line[5]));
-            break; 
-        default:
-            std::cout << "unrecognized operation" << std::endl;
-    }
-
-}
-
-void writeToLogs(std::ofstream& logWriter, int operation, std::string username1 = "NULL", std::string username2= "NULL", std::string password = "NULL", std::string messageContent = "NULL", std::string messagesSeen = "NULL", std::string leader = "NULL", int clockVal = 0) {
-
-    // Check if operation was valid
-    if (operation == CREATE_ACCOUNT || operation == LOGIN || operation == LOGOUT || operation == SEND_MESSAGE || operation == QUERY_MESSAGES || operation == MESSAGES_SEEN || operation == DELETE_ACCOUNT) {
-        logWriter << std::to_string(operation) << "," << username1 << "," << username2 << "," << password << "," << messageContent << "," << messagesSeen << "," << leader << "," << std::to_string(clockVal) << std::endl;
-    } else {
-        std::cout << "unrecognized operation in write to logs" << std::endl;
+
+    // Parses the field as a decimal number, like stoi without the copy
+    int toInt() const {
+        size_t i = 0;
+        bool negative = size > 0 && data[0] == '-';
+        if (negative) {
+            i++;
+        }
+        if (i == size) {
+            throw std::invalid_argument("Field is not a number");
+        }
+        int value = 0;
+        for (; i < size; i++) {
+            if (data[i] < '0' || data[i] > '9') {
+                throw std::invalid_argument("Field is not a number");
+            }
+            value = value * 10 + (data[i] - '0');
+        }
+        return negative ? -value : value;
     }
+};
+
+// Operation decoded in place, its fields point into the log record it was read from
+struct OperationView {
+    int64_t clockVal = 0;
+    int opCode = 0;
+    FieldView username1;
+    FieldView username2;
+    FieldView password;
+    FieldView message_content;
+    int messagesSeen = 0;
+    FieldView leader;
+    int firstMessageIndex = -1;
+};
 
+// Bits of an operation's field mask. Strings come first, in the order they are encoded
+enum OperationField {
+    FIELD_USERNAME1 = 1,
+    FIELD_USERNAME2 = 2,
+    FIELD_PASSWORD = 4,
+    FIELD_MESSAGE_CONTENT = 8,
+    FIELD_LEADER = 16,
+    FIELD_MESSAGES_SEEN = 32,
+    FIELD_FIRST_MESSAGE_INDEX = 64,
+};
+
+const uint8_t g_allOperationFields = 127;
+
+// Field access shared by OperationClass, which owns its strings, and OperationView
+const std::string& fieldString(const std::string& field) {
+    return field;
 }
 
-void readFile (std::vector<std::vector<std::string>>* content, std::string historyFile) {
-    std::vector<std::string> row;
-    std::string line, word;
+std::string fieldString(const FieldView& field) {
+    return field.str();
+}
 
-    std::fstream file;
-    file.open(historyFile, std::ios::in);
-    file.seekg(0, file.beg);
-    if (file.is_open()) {
-        while (getline(file, line)) {
-            row.clear();
+const char* fieldData(const std::string& field) {
+    return field.data();
+}
 
-            std::stringstream str(line);
+const char* fieldData(const FieldView& field) {
+    return field.data;
+}
 
-            while (getline(str, word, ',')) {
-                row.push_back(word);
-            }
-            content->push_back(row);
+size_t fieldSize(const std::string& field) {
+    return field.size();
+}
+
+size_t fieldSize(const FieldView& field) {
+    return field.size;
+}
+
+// Schema of each operation type: the fields it carries and how it is applied. apply takes an
+// OperationClass or an OperationView, so replay out of the log only copies what storage keeps.
+// Encoding, decoding, CSV import and replay all go through the schema, so a new operation type
+// is a specialization here plus an entry in OperationTypes
+template <int OpCode>
+struct OperationSchema;
+
+template <>
+struct OperationSchema<CREATE_ACCOUNT> {
+    static const uint8_t fields = FIELD_USERNAME1 | FIELD_PASSWORD;
+
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return tryCreateAccount(fieldString(op.username1), fieldString(op.password), op.clockVal);
+    }
+};
+
+template <>
+struct OperationSchema<LOGIN> {
+    static const uint8_t fields = FIELD_USERNAME1 | FIELD_PASSWORD;
+
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return tryLogin(fieldString(op.username1), fieldString(op.password));
+    }
+};
+
+template <>
+struct OperationSchema<LOGOUT> {
+    static const uint8_t fields = FIELD_USERNAME1;
+
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return tryLogout(fieldString(op.username1));
+    }
+};
+
+template <>
+struct OperationSchema<SEND_MESSAGE> {
+    static const uint8_t fields = FIELD_USERNAME1 | FIELD_USERNAME2 | FIELD_MESSAGE_CONTENT;
+
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return trySendMessage(fieldString(op.username1), fieldString(op.username2), fieldString(op.message_content));
+    }
+};
+
+template <>
+struct OperationSchema<QUERY_MESSAGES> {
+    static const uint8_t fields = FIELD_USERNAME1 | FIELD_USERNAME2;
+
+    // Messages returned by the query are put in messages when it is given
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        std::vector<ChatMessage> queried = tryQueryMessages(fieldString(op.username1), fieldString(op.username2));
+        if (messages != nullptr) {
+            *messages = std::move(queried);
         }
+        return 0;
     }
-    else {
-        std::cout<<"Could not open " << historyFile << std::endl;
+};
+
+template <>
+struct OperationSchema<DELETE_ACCOUNT> {
+    static const uint8_t fields = FIELD_USERNAME1;
+
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return tryDeleteAccount(fieldString(op.username1));
     }
+};
 
-    file.close();
-}
+template <>
+struct OperationSchema<MESSAGES_SEEN> {
+    static const uint8_t fields = FIELD_USERNAME1 | FIELD_USERNAME2 | FIELD_MESSAGES_SEEN | FIELD_FIRST_MESSAGE_INDEX;
 
-std::vector<std::string> moveToCommit(std::string filename, std::ofstream& writer) {
-    std::vector<std::vector<std::string>> content;
+    template <typename Operation>
+    static int apply(const Operation& op, std::vector<ChatMessage>* messages) {
+        return tryMessagesSeen(fieldString(op.username1), fieldString(op.username2), op.messagesSeen, op.firstMessageIndex);
+    }
+};
+
+template <int... OpCodes>
+struct OperationTypes {};
 
-    // Read everything out of pending file
-    readFile(&content, filename);
+typedef OperationTypes<CREATE_ACCOUNT, LOGIN, LOGOUT, SEND_MESSAGE, QUERY_MESSAGES, DELETE_ACCOUNT, MESSAGES_SEEN> LoggedOperations;
 
-    std::ofstream pendingLogOverWriter;
+// Calls visitor.visit<OperationSchema<opCode>>() for the operation type, or visitor.unknown()
+template <typename Visitor>
+int dispatchOperation(OperationTypes<>, int opCode, Visitor& visitor) {
+    return visitor.unknown();
+}
 
-    // write everything back except the last line
-    pendingLogOverWriter.open(filename, std::fstream::trunc);
+template <int First, int... Rest, typename Visitor>
+int dispatchOperation(OperationTypes<First, Rest...>, int opCode, Visitor& visitor) {
+    if (opCode == First) {
+        return visitor.template visit<OperationSchema<First> >();
+    }
+    return dispatchOperation(OperationTypes<Rest...>(), opCode, visitor);
+}
 
-    pendingLogOverWriter << g_csvFields << std::endl;
+template <typename Visitor>
+int dispatchOperation(int opCode, Visitor& visitor) {
+    return dispatchOperation(LoggedOperations(), opCode, visitor);
+}
 
-    for (int i=1; i<content.size()-1; i++) {
-        writeToLogs(pendingLogOverWriter, stoi(content[i][0]), content[i][1], content[i][2], content[i][3], content[i][4], content[i][5], content[i][6], stoi(content[i][7]));
+struct OperationFieldsVisitor {
+    template <typename Schema>
+    int visit() {
+        return Schema::fields;
     }
 
-    // Commit last line
-    int lastIdx = content.size() - 1;
-    writeToLogs(writer, stoi(content[lastIdx][0]), content[lastIdx][1], content[lastIdx][2], content[lastIdx][3], content[lastIdx][4], content[lastIdx][5], content[lastIdx][6], stoi(content[lastIdx][7]));
+    // Unknown operations keep every field, so they pass through the log unchanged
+    int unknown() {
+        return g_allOperationFields;
+    }
+};
 
-    pendingLogOverWriter.close();
-    
-    return content[lastIdx];
+// Fields an operation type carries
+uint8_t operationFields(int opCode) {
+    OperationFieldsVisitor visitor;
+    return dispatchOperation(opCode, visitor);
 }
 
-struct OperationClass {
-    int clockVal;
-    int opCode;
-    std::string username1;
-    std::string username2;
-    std::string password;
-    std::string message_content;
-    std::string messagesseen;
-    std::string leader;
+template <typename Operation>
+struct ApplyOperationVisitor {
+    const Operation& op;
+    std::vector<ChatMessage>* messages;
+
+    ApplyOperationVisitor(const Operation& op, std::vector<ChatMessage>* messages) : op(op), messages(messages) {}
+
+    template <typename Schema>
+    int visit() {
+        return Schema::apply(op, messages);
+    }
+
+    int unknown() {
+        std::cout << "unrecognized operation" << std::endl;
+        return 1;
+    }
 };
 
+// Applies a committed operation to the storage structures, returns the status of the tryX call.
+// Works on an OperationClass or an OperationView read in place from the log. Messages returned
+// by a query are put in messages when it is given
+template <typename Operation>
+int applyOperation(const Operation& op, std::vector<ChatMessage>* messages = nullptr) {
+    ApplyOperationVisitor<Operation> visitor(op, messages);
+    return dispatchOperation(op.opCode, visitor);
+}
+
+void assignField(std::string& to, const std::string& from) {
+    to = from;
+}
+
+void assignField(std::string& to, const FieldView& from) {
+    to.assign(from.data, from.size);
+}
+
+// Copies the fields the operation's type carries, anything else is left at its default
+template <typename From>
+OperationClass copyOperation(const From& from) {
+    OperationClass op;
+    op.opCode = from.opCode;
+    op.clockVal = from.clockVal;
+    uint8_t fields = operationFields(from.opCode);
+    if (fields & FIELD_USERNAME1) {
+        assignField(op.username1, from.username1);
+    }
+    if (fields & FIELD_USERNAME2) {
+        assignField(op.username2, from.username2);
+    }
+    if (fields & FIELD_PASSWORD) {
+        assignField(op.password, from.password);
+    }
+    if (fields & FIELD_MESSAGE_CONTENT) {
+        assignField(op.message_content, from.message_content);
+    }
+    if (fields & FIELD_LEADER) {
+        assignField(op.leader, from.leader);
+    }
+    if (fields & FIELD_MESSAGES_SEEN) {
+        op.messagesSeen = from.messagesSeen;
+    }
+    if (fields & FIELD_FIRST_MESSAGE_INDEX) {
+        op.firstMessageIndex = from.firstMessageIndex;
+    }
+    return op;
+}
+
+// Copies a view out into an operation that owns its fields
+OperationClass toOperation(const OperationView& view) {
+    return copyOperation(view);
+}
+
+// Legacy CSV logs wrote "NULL" for fields an operation does not use
+FieldView csvField(const FieldView& field) {
+    if (field.size == g_nullString.size() && memcmp(field.data, g_nullString.data(), field.size) == 0) {
+        return FieldView();
+    }
+    return field;
+}
+
+// Reads a row of a legacy CSV log in place: message_type, username1, username2, password,
+// message_content, messagesseen, leader, clockVal. Throws std::invalid_argument on a bad number
+OperationView operationFromFields(const std::vector<FieldView>& row) {
+    OperationView op;
+    op.opCode = row[0].toInt();
+    op.username1 = csvField(row[1]);
+    op.username2 = csvField(row[2]);
+    op.password = csvField(row[3]);
+    op.message_content = csvField(row[4]);
+    FieldView messagesSeen = csvField(row[5]);
+    op.messagesSeen = messagesSeen.size == 0 ? 0 : messagesSeen.toInt();
+    op.leader = csvField(row[6]);
+    op.clockVal = row[7].toInt();
+    return op;
+}
+
+// Converts a row of a legacy CSV log into an operation
+OperationClass operationFromRow(const std::vector<std::string>& line) {
+    std::vector<FieldView> row(line.size());
+    for (size_t i = 0; i < line.size(); i++) {
+        row[i].data = line[i].data();
+        row[i].size = line[i].size();
+    }
+    return copyOperation(operationFromFields(row));
+}
+
+void parseLine(std::vector<std::string> line) {
+    // 
+    if (line.size() < 8) {
+        std::cout<<"would have seg faulted " << std::to_string(line.size()) <<std::endl;
+        return;
+    }
+    applyOperation(operationFromRow(line));
+}
+
+// Splits CSV text into rows of fields found by the vectorized delimiter scan. Rows come out the
+// way getline splits them: an empty line is an empty row and a trailing comma adds no empty field
+void forEachCsvRecord(const char* data, size_t length, const std::function<void(std::vector<FieldView>&)>& callback) {
+    std::vector<FieldView> fields;
+    size_t fieldStart = 0;
+    auto onDelimiter = [&](size_t position, char delimiter) {
+        FieldView field;
+        field.data = data + fieldStart;
+        field.size = position - fieldStart;
+        if (delimiter == ',' || field.size > 0) {
+            fields.push_back(field);
+        }
+        if (delimiter == '\n') {
+            callback(fields);
+            fields.clear();
+        }
+        fieldStart = position + 1;
+    };
+    forEachCsvDelimiter(data, length, onDelimiter);
+
+    // Last line without a newline
+    if (fieldStart < length) {
+        onDelimiter(length, '\n');
+    }
+}
+
+// Maps a legacy CSV log and calls back with the fields of each row, which point into the mapping
+bool forEachCsvFields(std::string historyFile, const std::function<void(std::vector<FieldView>&)>& callback) {
+    int fd = open(historyFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cout<<"Could not open " << historyFile << std::endl;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return true;
+    }
+    void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cout<<"Could not map " << historyFile << std::endl;
+        return false;
+    }
+    madvise(mapping, st.st_size, MADV_SEQUENTIAL);
+    forEachCsvRecord(static_cast<const char*>(mapping), st.st_size, callback);
+    munmap(mapping, st.st_size);
+    return true;
+}
+
+// Calls back with each row of a legacy CSV log as it is read, so only one row is in memory at a time
+void forEachCsvRow(std::string historyFile, const std::function<void(std::vector<std::string>&)>& callback) {
+    std::vector<std::string> row;
+    forEachCsvFields(historyFile, [&row, &callback](std::vector<FieldView>& fields) {
+        row.clear();
+        for (const FieldView& field : fields) {
+            row.push_back(field.str());
+        }
+        callback(row);
+    });
+}
+
+// Reads a legacy CSV log, only used to import logs written before the binary log existed
+void readFile (std::vector<std::vector<std::string>>* content, std::string historyFile) {
+    forEachCsvRow(historyFile, [content](std::vector<std::string>& row) {
+        content->push_back(row);
+    });
+}
+
+// Calls back with each operation of a legacy CSV log, skipping the header and malformed rows
+void forEachCsvOperation(std::string historyFile, const std::function<void(const OperationClass&)>& callback) {
+    bool header = true;
+    forEachCsvFields(historyFile, [&header, &callback](std::vector<FieldView>& row) {
+        if (header) {
+            header = false;
+            return;
+        }
+        if (row.size() < 8) {
+            return;
+        }
+        try {
+            callback(copyOperation(operationFromFields(row)));
+        } catch (std::invalid_argument& e) {
+            std::cout << "Skipping malformed CSV row" << std::endl;
+        }
+    });
+}
+
 struct opCompare {
     bool operator()(const OperationClass& a, const OperationClass& b) {
         return a.clockVal > b.clockVal;
     }
 };
 
+// Orders by clock value. Operations sharing one are ordered by their fields, so copies of the
+// same operation sort next to each other
 bool compareOperations(const OperationClass& a, const OperationClass& b) {
-    return a.clockVal < b.clockVal;
+    return std::tie(a.clockVal, a.leader, a.opCode, a.username1, a.username2, a.password, a.message_content, a.messagesSeen, a.firstMessageIndex) <
+           std::tie(b.clockVal, b.leader, b.opCode, b.username1, b.username2, b.password, b.message_content, b.messagesSeen, b.firstMessageIndex);
+}
+
+bool sameOperation(const OperationClass& a, const OperationClass& b) {
+    return std::tie(a.clockVal, a.leader, a.opCode, a.username1, a.username2, a.password, a.message_content, a.messagesSeen, a.firstMessageIndex) ==
+           std::tie(b.clockVal, b.leader, b.opCode, b.username1, b.username2, b.password, b.message_content, b.messagesSeen, b.firstMessageIndex);
 }
 
 void sortOperations(std::vector<OperationClass> &operationsList) {
     std::sort(operationsList.begin(), operationsList.end(), compareOperations);
+}
+
+// Drops the extra copies of operations pending on several servers, call on a sorted list. Distinct
+// operations that share a clock value, given out by leaders of different terms, are all kept
+void removeDuplicateOperations(std::vector<OperationClass> &operationsList) {
+    operationsList.erase(std::unique(operationsList.begin(), operationsList.end(), sameOperation), operationsList.end());
 }
\ No newline at end of file
@@ -0,0 +1,1275 @@
+#include "operationEncoding.h"
+#include "logWriter.h"
+#include "compression.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// Binary write-ahead log that replaces the pending/committed CSV files.
+//
+// The log is a directory of segment files named after the index of their first entry.
+// Every record is [u32 payload length][u32 checksum][u64 index][payload], so appends
+// never touch earlier records and committing an entry only advances commitIndex,
+// which is persisted in a small side file. Segments covered by a snapshot are deleted
+// by compact(), so the first segment does not have to start at index 1.
+//
+// Segments are preallocated to g_walSegmentBytes, so appends only overwrite zeros and never change
+// the file size; a zero record header marks the end of the records. A segment is trimmed to its
+// records when the next one is started. Every segment keeps a sparse index of (entry, offset)
+// points, one per g_walSeekIntervalBytes, so a read from any index finds its segment and a nearby
+// offset with two binary searches instead of walking the log from the start.
+//
+// Records are written by the LogWriter stage at explicit offsets, and readers only see entries up
+// to the written index. Appends only reach the page cache. sync() makes them durable, and concurrent callers share
+// one fdatasync: whoever arrives while a sync runs waits for it and only syncs again if its
+// entry was written after that sync started. Sealed segments are synced when they are closed.
+//
+// Usernames in records are interned through the log's UsernameDictionary, which is rebuilt from
+// the records on open. Before compaction deletes segments, the names they define are written to
+// the usernames file as [u32 checksum][u64 covered index][names], so they outlive the records.
+//
+// Sealed segments whose entries are all committed are rewritten by compressSealedSegments() as
+// <first index>.logz files of zlib blocks. Each block holds whole records and inflates to exactly
+// the bytes the segment had, behind a [u32 compressed length][u32 raw length][u32 checksum]
+// [u32 entries][u64 first index] header. Their seek points are the blocks, so a read inflates at
+// most one block it does not need.
+
+std::string g_walDirectory = "wal";
+std::string g_walSegmentExtension = ".log";
+std::string g_walCompressedExtension = ".logz";
+std::string g_walCommitIndexFile = "commitIndex";
+std::string g_walUsernamesFile = "usernames";
+size_t g_walSegmentBytes = 8 * 1024 * 1024;
+const size_t g_walRecordHeaderBytes = 16;
+const uint32_t g_walMaxPayloadBytes = 1 << 20;
+const size_t g_walReadBufferBytes = 64 * 1024;
+size_t g_walSeekIntervalBytes = 64 * 1024;
+const size_t g_walBlockHeaderBytes = 24;
+bool g_walCompressSegments = true;
+
+// Lookup table for logChecksum
+struct ChecksumTable {
+    uint32_t entries[256];
+
+    ChecksumTable() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+            }
+            entries[i] = c;
+        }
+    }
+};
+
+// CRC-32 (IEEE) used to detect torn or corrupted records
+uint32_t logChecksum(const char* data, size_t length, uint32_t crc = 0) {
+    // Built on first use, the initialization of a local static is thread safe
+    static const ChecksumTable table;
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = table.entries[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Checksum of a log record, which covers its index so a record read at the wrong place fails it
+uint32_t recordChecksum(uint64_t index, const char* payload, size_t length) {
+    char indexBytes[8];
+    memcpy(indexBytes, &index, 8);
+    return logChecksum(payload, length, logChecksum(indexBytes, 8));
+}
+
+// Entry that starts at offset within its segment
+struct WalSeekPoint {
+    uint64_t index;
+    off_t offset;
+};
+
+struct WalSegment {
+    uint64_t firstIndex;
+    std::string path;
+    off_t endOffset = 0;                    // end of the records, kept up to date when the segment is opened
+    std::vector<WalSeekPoint> seekPoints;   // ascending, the first record is always one
+    bool compressed = false;                // seek points are then block offsets
+};
+
+// Reserves a whole segment up front. Filesystems without fallocate just grow the file as before
+void preallocateSegment(int fd) {
+    if (fallocate(fd, 0, 0, g_walSegmentBytes) != 0 && errno != EOPNOTSUPP) {
+        std::cout << "Could not preallocate log segment" << std::endl;
+    }
+}
+
+// Parses the record at position in data and moves past it. Returns false at the end of the
+// records or at a record that was cut off
+bool nextWalRecord(const char* data, size_t size, size_t& position, uint32_t& crc, uint64_t& index,
+                   const char*& payload, uint32_t& length) {
+    if (size - position < g_walRecordHeaderBytes) {
+        return false;
+    }
+    const char* header = data + position;
+    length = getU32(header);
+    crc = getU32(header + 4);
+    index = getU64(header + 8);
+    if (length == 0 || length > g_walMaxPayloadBytes || size - position - g_walRecordHeaderBytes < length) {
+        return false;
+    }
+    payload = header + g_walRecordHeaderBytes;
+    position += g_walRecordHeaderBytes + length;
+    return true;
+}
+
+// Checks the compressed block starting at offset, returns false if it is cut off or corrupt
+bool validWalBlock(const char* data, size_t size, size_t offset, uint32_t& compressedLength,
+                   uint32_t& rawLength, uint32_t& entries, uint64_t& firstIndex) {
+    if (size - offset < g_walBlockHeaderBytes) {
+        return false;
+    }
+    const char* header = data + offset;
+    compressedLength = getU32(header);
+    rawLength = getU32(header + 4);
+    entries = getU32(header + 12);
+    firstIndex = getU64(header + 16);
+    return entries > 0 && size - offset - g_walBlockHeaderBytes >= compressedLength &&
+           logChecksum(header + g_walBlockHeaderBytes, compressedLength) == getU32(header + 8);
+}
+
+// Maps a whole segment read-only so its records can be used in place. Pages are only
+// read in as they are touched, and nothing is copied out. A compressed segment is
+// inflated one block at a time instead
+struct WalSegmentMapping {
+    private:
+        const char* mapping = nullptr;
+        size_t size = 0;
+        size_t position = 0;
+        bool compressed;
+        std::string block;
+        size_t blockPosition = 0;
+
+        // Inflates the block at position, returns false at the end of the segment
+        bool nextBlock() {
+            uint32_t compressedLength, rawLength, entries;
+            uint64_t firstIndex;
+            if (!validWalBlock(mapping, size, position, compressedLength, rawLength, entries, firstIndex) ||
+                    !decompressBlock(mapping + position + g_walBlockHeaderBytes, compressedLength, rawLength, block)) {
+                return false;
+            }
+            position += g_walBlockHeaderBytes + compressedLength;
+            blockPosition = 0;
+            return true;
+        }
+
+    public:
+        // Maps at most length bytes of the segment, or all of it if length is negative. A segment
+        // may be trimmed while it is mapped, and touching pages past its new end faults
+        explicit WalSegmentMapping(const std::string& path, bool compressed = false, off_t length = -1) : compressed(compressed) {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st;
+            off_t mappedLength = 0;
+            if (fstat(fd, &st) == 0) {
+                mappedLength = length < 0 ? st.st_size : std::min(st.st_size, length);
+            }
+            if (mappedLength > 0) {
+                void* mapped = mmap(nullptr, mappedLength, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped != MAP_FAILED) {
+                    mapping = static_cast<const char*>(mapped);
+                    size = mappedLength;
+                    madvise(mapped, size, MADV_SEQUENTIAL);
+                }
+            }
+            close(fd);
+        }
+
+        ~WalSegmentMapping() {
+            if (mapping != nullptr) {
+                munmap(const_cast<char*>(mapping), size);
+            }
+        }
+
+        // Continues reading at offset, which has to be the start of a record, or of a block
+        // in a compressed segment
+        void seek(off_t offset) {
+            position = std::min(static_cast<size_t>(offset), size);
+            block.clear();
+            blockPosition = 0;
+        }
+
+        // Returns the next record, payload points into the mapping or the inflated block and is
+        // valid until the next call. Returns false at the end of the segment or at a record that
+        // was cut off
+        bool next(uint32_t& crc, uint64_t& index, const char*& payload, uint32_t& length) {
+            if (!compressed) {
+                return nextWalRecord(mapping, size, position, crc, index, payload, length);
+            }
+            while (!nextWalRecord(block.data(), block.size(), blockPosition, crc, index, payload, length)) {
+                if (blockPosition < block.size() || !nextBlock()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+};
+
+// Reads the records of one segment in order through a fixed size buffer, used by recovery
+// to find where a torn tail starts. Only a record bigger than the buffer is copied out
+struct WalSegmentReader {
+    private:
+        int fd;
+        std::vector<char> buffer;
+        size_t bufferStart = 0;     // first unread byte
+        size_t bufferEnd = 0;       // end of the bytes read into the buffer
+        off_t bufferOffset = 0;     // file offset of buffer[0]
+        off_t recordOffset = 0;
+        std::string largeRecord;
+
+        // Makes at least bytes unread bytes available, returns false if the segment ends first
+        bool ensure(size_t bytes) {
+            if (bufferEnd - bufferStart >= bytes) {
+                return true;
+            }
+            memmove(buffer.data(), buffer.data() + bufferStart, bufferEnd - bufferStart);
+            bufferOffset += bufferStart;
+            bufferEnd -= bufferStart;
+            bufferStart = 0;
+            while (bufferEnd < bytes) {
+                ssize_t bytesRead = read(fd, buffer.data() + bufferEnd, buffer.size() - bufferEnd);
+                if (bytesRead <= 0) {
+                    return false;
+                }
+                bufferEnd += bytesRead;
+            }
+            return true;
+        }
+
+    public:
+        explicit WalSegmentReader(const std::string& path) : buffer(g_walReadBufferBytes) {
+            fd = ::open(path.c_str(), O_RDONLY);
+        }
+
+        ~WalSegmentReader() {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        bool good() {
+            return fd >= 0;
+        }
+
+        // Reads the next record, payload stays valid until the next call. Returns false at the
+        // end of the segment or at a record that was cut off
+        bool next(uint32_t& crc, uint64_t& index, const char*& payload, uint32_t& length) {
+            if (fd < 0 || !ensure(g_walRecordHeaderBytes)) {
+                return false;
+            }
+            const char* header = buffer.data() + bufferStart;
+            length = getU32(header);
+            crc = getU32(header + 4);
+            index = getU64(header + 8);
+            if (length == 0 || length > g_walMaxPayloadBytes) {
+                return false;
+            }
+            recordOffset = bufferOffset + bufferStart;
+            size_t recordBytes = g_walRecordHeaderBytes + length;
+
+            if (recordBytes <= buffer.size()) {
+                if (!ensure(recordBytes)) {
+                    return false;
+                }
+                payload = buffer.data() + bufferStart + g_walRecordHeaderBytes;
+                bufferStart += recordBytes;
+                return true;
+            }
+
+            // Bigger than the buffer, read the rest straight into its own string
+            size_t buffered = bufferEnd - bufferStart - g_walRecordHeaderBytes;
+            largeRecord.resize(length);
+            memcpy(&largeRecord[0], buffer.data() + bufferStart + g_walRecordHeaderBytes, buffered);
+            while (buffered < length) {
+                ssize_t bytesRead = read(fd, &largeRecord[buffered], length - buffered);
+                if (bytesRead <= 0) {
+                    return false;
+                }
+                buffered += bytesRead;
+            }
+            bufferStart = 0;
+            bufferEnd = 0;
+            bufferOffset = recordOffset + recordBytes;
+            payload = largeRecord.data();
+            return true;
+        }
+
+        // File offset of the last record read
+        off_t offset() {
+            return recordOffset;
+        }
+
+        // File offset just past the last record read
+        off_t endOffset() {
+            return bufferOffset + bufferStart;
+        }
+};
+
+// Location of an uncommitted entry, kept so pending entries can be committed or dropped cheaply
+struct WalPendingEntry {
+    uint64_t index;
+    size_t segment;
+    off_t offset;
+    uint32_t checksum;      // of the record, to tell whether a resent entry is the same one
+    OperationClass op;
+};
+
+struct WriteAheadLog {
+    private:
+        std::mutex walMutex;
+        std::string directory;
+        std::vector<WalSegment> segments;
+        std::deque<WalPendingEntry> pending;
+
+        int segmentFd = -1;
+        LogWriter writer;
+        off_t segmentSize = 0;
+        int commitFd = -1;
+
+        uint64_t lastIdx = 0;
+        uint64_t commitIdx = 0;
+
+        // Names defined by entries up to usernamesIdx are in the usernames file
+        UsernameDictionary usernames;
+        uint64_t usernamesIdx = 0;
+
+        // Scans read mapped segments, which must not be truncated underneath them
+        int activeScans = 0;
+        std::condition_variable scanCondition;
+
+        // Bumped whenever entries are dropped, so a segment compressed meanwhile is not swapped in
+        uint64_t truncations = 0;
+
+        // Everything up to syncedIdx is on disk. Only one fdatasync runs at a time
+        std::mutex syncMutex;
+        std::condition_variable syncCondition;
+        bool syncRunning = false;
+        uint64_t syncedIdx = 0;
+        int syncs = 0;
+        // A failed fdatasync may have dropped the dirty pages, so a later one succeeding would not
+        // mean they are on disk. The log stays failed
+        bool syncFailed = false;
+
+        std::string segmentPath(uint64_t firstIndex, const std::string& extension = g_walSegmentExtension) {
+            char name[32];
+            snprintf(name, sizeof(name), "%020llu", static_cast<unsigned long long>(firstIndex));
+            return directory + "/" + name + extension;
+        }
+
+        // Syncs the directory so newly created or deleted segments survive a crash
+        void syncDirectory() {
+            int dirFd = ::open(directory.c_str(), O_RDONLY);
+            if (dirFd >= 0) {
+                fsync(dirFd);
+                close(dirFd);
+            }
+        }
+
+        // Forgets syncs of entries that were just dropped, so their replacements get synced
+        void lowerSyncedIndex() {
+            syncMutex.lock();
+            syncedIdx = std::min(syncedIdx, lastIdx);
+            syncMutex.unlock();
+        }
+
+        // Adds a seek point if the last one is at least g_walSeekIntervalBytes back
+        void addSeekPoint(WalSegment& segment, uint64_t index, off_t offset) {
+            if (segment.seekPoints.empty() ||
+                    offset - segment.seekPoints.back().offset >= static_cast<off_t>(g_walSeekIntervalBytes)) {
+                WalSeekPoint point;
+                point.index = index;
+                point.offset = offset;
+                segment.seekPoints.push_back(point);
+            }
+        }
+
+        // Finds the segment holding index and the offset of a record at or before it.
+        // Call with walMutex held and index inside the log
+        void locate(uint64_t index, size_t& segmentIdx, off_t& offset) {
+            auto segment = std::upper_bound(segments.begin(), segments.end(), index, [](uint64_t value, const WalSegment& other) {
+                return value < other.firstIndex;
+            });
+            segmentIdx = segment == segments.begin() ? 0 : segment - segments.begin() - 1;
+            const std::vector<WalSeekPoint>& points = segments[segmentIdx].seekPoints;
+            auto point = std::upper_bound(points.begin(), points.end(), index, [](uint64_t value, const WalSeekPoint& other) {
+                return value < other.index;
+            });
+            offset = point == points.begin() ? 0 : (point - 1)->offset;
+        }
+
+        // Zeroes everything after offset; the segment being appended to gets its space back
+        void resetSegmentTail(const std::string& path, off_t offset, bool preallocate) {
+            int fd = ::open(path.c_str(), O_WRONLY);
+            if (fd < 0 || ftruncate(fd, offset) != 0) {
+                std::cout << "Could not truncate " << path << std::endl;
+            } else {
+                if (preallocate) {
+                    preallocateSegment(fd);
+                }
+                fsync(fd);
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        // Starts a new segment whose first entry will be firstIndex
+        void openNewSegment(uint64_t firstIndex) {
+            if (segmentFd >= 0) {
+                // Trim the space the sealed segment did not use. Later syncs only cover the new segment
+                writer.drain();
+                if (ftruncate(segmentFd, segmentSize) != 0) {
+                    std::cout << "Could not trim " << segments.back().path << std::endl;
+                }
+                segments.back().endOffset = segmentSize;
+                fsync(segmentFd);
+                close(segmentFd);
+            }
+            WalSegment segment;
+            segment.firstIndex = firstIndex;
+            segment.path = segmentPath(firstIndex);
+            segmentFd = ::open(segment.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (segmentFd < 0) {
+                throw std::runtime_error("Could not create log segment " + segment.path);
+            }
+            preallocateSegment(segmentFd);
+            segments.push_back(segment);
+            segmentSize = 0;
+            syncDirectory();
+        }
+
+        // Reopens the newest segment for appending
+        void openLastSegment() {
+            if (segmentFd >= 0) {
+                writer.drain();
+                close(segmentFd);
+                segmentFd = -1;
+            }
+            if (segments.empty() || segments.back().compressed) {
+                openNewSegment(lastIdx + 1);
+                return;
+            }
+            segmentFd = ::open(segments.back().path.c_str(), O_WRONLY);
+            if (segmentFd < 0) {
+                throw std::runtime_error("Could not open log segment " + segments.back().path);
+            }
+            segmentSize = segments.back().endOffset;
+        }
+
+        void persistCommitIndex() {
+            char buffer[12];
+            memcpy(buffer, &commitIdx, 8);
+            uint32_t crc = logChecksum(buffer, 8);
+            memcpy(buffer + 8, &crc, 4);
+            if (pwrite(commitFd, buffer, sizeof(buffer), 0) != sizeof(buffer)) {
+                std::cout << "Could not persist commit index" << std::endl;
+            }
+        }
+
+        void loadCommitIndex() {
+            std::string path = directory + "/" + g_walCommitIndexFile;
+            commitFd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (commitFd < 0) {
+                throw std::runtime_error("Could not open " + path);
+            }
+            char buffer[12];
+            commitIdx = 0;
+            if (pread(commitFd, buffer, sizeof(buffer), 0) == sizeof(buffer) &&
+                    logChecksum(buffer, 8) == getU32(buffer + 8)) {
+                commitIdx = getU64(buffer);
+            }
+        }
+
+        // Writes the names defined by entries up to index to the usernames file
+        bool persistUsernames(uint64_t index) {
+            std::string contents;
+            putU64(contents, index);
+            contents.append(usernames.encode(index));
+            std::string file;
+            putU32(file, logChecksum(contents.data(), contents.size()));
+            file.append(contents);
+
+            std::string path = directory + "/" + g_walUsernamesFile;
+            std::string tempPath = path + ".tmp";
+            int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0 || write(fd, file.data(), file.size()) != static_cast<ssize_t>(file.size()) ||
+                    fdatasync(fd) != 0 || rename(tempPath.c_str(), path.c_str()) != 0) {
+                std::cout << "Could not write " << path << std::endl;
+                if (fd >= 0) {
+                    close(fd);
+                }
+                unlink(tempPath.c_str());
+                return false;
+            }
+            close(fd);
+            syncDirectory();
+            usernamesIdx = index;
+            return true;
+        }
+
+        void loadUsernames() {
+            usernames.clear();
+            usernamesIdx = 0;
+            std::string path = directory + "/" + g_walUsernamesFile;
+            std::ifstream reader(path, std::ios::binary);
+            if (!reader.good()) {
+                return;
+            }
+            std::string file((std::istreambuf_iterator<char>(reader)), std::istreambuf_iterator<char>());
+            if (file.size() < 12 || logChecksum(file.data() + 4, file.size() - 4) != getU32(file.data()) ||
+                    !usernames.decode(file.data() + 12, file.size() - 12)) {
+                throw std::runtime_error("Corrupt usernames file " + path);
+            }
+            usernamesIdx = getU64(file.data() + 4);
+        }
+
+        // Checks the blocks of a compressed segment. It only ever held committed entries whose
+        // usernames were persisted, so nothing is decoded
+        void recoverCompressedSegment(size_t segmentIdx) {
+            WalSegment& segment = segments[segmentIdx];
+            std::ifstream reader(segment.path, std::ios::binary);
+            if (!reader.good()) {
+                throw std::runtime_error("Could not open log segment " + segment.path);
+            }
+            std::string file((std::istreambuf_iterator<char>(reader)), std::istreambuf_iterator<char>());
+            size_t offset = 0;
+            while (offset < file.size()) {
+                uint32_t compressedLength, rawLength, entries;
+                uint64_t firstIndex;
+                if (!validWalBlock(file.data(), file.size(), offset, compressedLength, rawLength, entries, firstIndex) ||
+                        firstIndex != lastIdx + 1) {
+                    throw std::runtime_error("Corrupt compressed log segment " + segment.path);
+                }
+                WalSeekPoint point;
+                point.index = firstIndex;
+                point.offset = offset;
+                segment.seekPoints.push_back(point);
+                lastIdx += entries;
+                offset += g_walBlockHeaderBytes + compressedLength;
+            }
+            segment.endOffset = offset;
+        }
+
+        // Writes the records of a sealed segment to compressedPath as compressed blocks and
+        // returns their seek points. Runs without walMutex, nothing else writes the segment
+        bool writeCompressedSegment(const std::string& path, const std::string& compressedPath,
+                                    std::vector<WalSeekPoint>& blocks) {
+            std::string file;
+            std::string compressed;
+            WalSegmentMapping mapping(path);
+            uint32_t crc;
+            uint64_t index;
+            const char* payload;
+            uint32_t length;
+            const char* blockStart = nullptr;
+            const char* blockEnd = nullptr;
+            uint64_t blockIndex = 0;
+            uint32_t entries = 0;
+
+            auto flushBlock = [&]() {
+                if (!compressBlock(blockStart, blockEnd - blockStart, compressed)) {
+                    return false;
+                }
+                WalSeekPoint point;
+                point.index = blockIndex;
+                point.offset = file.size();
+                blocks.push_back(point);
+                putU32(file, compressed.size());
+                putU32(file, blockEnd - blockStart);
+                putU32(file, logChecksum(compressed.data(), compressed.size()));
+                putU32(file, entries);
+                putU64(file, blockIndex);
+                file.append(compressed);
+                blockStart = nullptr;
+                entries = 0;
+                return true;
+            };
+
+            while (mapping.next(crc, index, payload, length)) {
+                if (blockStart == nullptr) {
+                    blockStart = payload - g_walRecordHeaderBytes;
+                    blockIndex = index;
+                }
+                blockEnd = payload + length;
+                entries++;
+                if (static_cast<size_t>(blockEnd - blockStart) >= g_compressionBlockBytes && !flushBlock()) {
+                    return false;
+                }
+            }
+            if (blockStart != nullptr && !flushBlock()) {
+                return false;
+            }
+            if (file.empty()) {
+                return false;
+            }
+
+            std::string tempPath = compressedPath + ".tmp";
+            int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0 || write(fd, file.data(), file.size()) != static_cast<ssize_t>(file.size()) ||
+                    fdatasync(fd) != 0 || rename(tempPath.c_str(), compressedPath.c_str()) != 0) {
+                std::cout << "Could not write " << compressedPath << std::endl;
+                if (fd >= 0) {
+                    close(fd);
+                }
+                unlink(tempPath.c_str());
+                return false;
+            }
+            close(fd);
+            syncDirectory();
+            return true;
+        }
+
+        // Reads every valid record of a segment; a torn or corrupt tail is zeroed
+        void recoverSegment(size_t segmentIdx) {
+            WalSegment& segment = segments[segmentIdx];
+            if (segment.compressed) {
+                recoverCompressedSegment(segmentIdx);
+                return;
+            }
+            WalSegmentReader reader(segment.path);
+            if (!reader.good()) {
+                throw std::runtime_error("Could not open log segment " + segment.path);
+            }
+
+            off_t offset = 0;
+            uint32_t crc;
+            uint64_t index;
+            const char* payload;
+            uint32_t length;
+            while (reader.next(crc, index, payload, length)) {
+                // A record that passes its checksum but does not decode is as unusable as a torn one
+                OperationView op;
+                uint8_t definedFields;
+                if (index != lastIdx + 1 || recordChecksum(index, payload, length) != crc ||
+                        !decodeOperationView(payload, length, op, usernames, &definedFields)) {
+                    break;
+                }
+
+                lastIdx = index;
+                addSeekPoint(segment, index, reader.offset());
+                if (index > usernamesIdx) {
+                    usernames.learn(op, definedFields, index);
+                }
+                if (index > commitIdx) {
+                    WalPendingEntry entry;
+                    entry.index = index;
+                    entry.segment = segmentIdx;
+                    entry.offset = reader.offset();
+                    entry.checksum = crc;
+                    entry.op = copyOperation(op);
+                    pending.push_back(entry);
+                }
+                offset = reader.endOffset();
+            }
+
+            // Past the records is preallocated space or a record that was cut off. Either way it is
+            // zeroed, so records written out of order after a torn one never come back
+            segment.endOffset = offset;
+            struct stat st;
+            if (stat(segment.path.c_str(), &st) == 0 && st.st_size != offset) {
+                char header[g_walRecordHeaderBytes];
+                char zeros[g_walRecordHeaderBytes] = {};
+                int fd = ::open(segment.path.c_str(), O_RDONLY);
+                if (fd >= 0 && pread(fd, header, sizeof(header), offset) > 0 && memcmp(header, zeros, sizeof(header)) != 0) {
+                    std::cout << "Truncating torn log tail in " << segment.path << std::endl;
+                }
+                if (fd >= 0) {
+                    close(fd);
+                }
+                resetSegmentTail(segment.path, offset, segmentIdx + 1 == segments.size());
+            }
+        }
+
+        // Calls back with the payload of every record in [from, to] until the callback returns
+        // false. The payload points into the mapped segment and is only valid during the callback
+        void scan(uint64_t from, uint64_t to, const std::function<bool(uint64_t, const char*, uint32_t)>& callback) {
+            // Appends may add segments while we read, so work from a copy. Entries still
+            // queued for the writer are not in the files yet
+            walMutex.lock();
+            uint64_t lastIdx = std::min(this->lastIdx, writer.writtenIndex());
+            if (this->segments.empty() || from > std::min(lastIdx, to)) {
+                walMutex.unlock();
+                return;
+            }
+            size_t firstSegment;
+            off_t startOffset;
+            locate(from, firstSegment, startOffset);
+            // Only read up to where each segment's records end now. Sealing the last segment trims
+            // it, but never below what it already holds
+            std::vector<WalSegment> segments;
+            for (size_t s = firstSegment; s < this->segments.size(); s++) {
+                WalSegment segment;
+                segment.firstIndex = this->segments[s].firstIndex;
+                segment.path = this->segments[s].path;
+                segment.compressed = this->segments[s].compressed;
+                segment.endOffset = s + 1 < this->segments.size() ? this->segments[s].endOffset : segmentSize;
+                segments.push_back(segment);
+            }
+            activeScans++;
+            walMutex.unlock();
+
+            for (size_t s = 0; s < segments.size(); s++) {
+                if (segments[s].firstIndex > to) {
+                    break;
+                }
+
+                WalSegmentMapping mapping(segments[s].path, segments[s].compressed,
+                                          segments[s].compressed ? -1 : segments[s].endOffset);
+                if (s == 0) {
+                    mapping.seek(startOffset);
+                }
+                uint32_t crc;
+                uint64_t index;
+                const char* payload;
+                uint32_t length;
+                bool done = false;
+                while (!done && mapping.next(crc, index, payload, length)) {
+                    if (index > lastIdx) {
+                        break;
+                    }
+                    if (index < from) {
+                        continue;
+                    }
+                    done = index > to || !callback(index, payload, length);
+                }
+                if (done) {
+                    break;
+                }
+            }
+
+            walMutex.lock();
+            activeScans--;
+            walMutex.unlock();
+            scanCondition.notify_all();
+        }
+
+        // Queues payload as the next entry and learns the usernames it defines. Needs walMutex
+        uint64_t appendRecord(const std::string& payload, const OperationClass& op) {
+            uint64_t index = lastIdx + 1;
+
+            if (segmentSize > 0 && segmentSize + g_walRecordHeaderBytes + payload.size() > g_walSegmentBytes) {
+                openNewSegment(index);
+            }
+
+            std::string record;
+            record.reserve(g_walRecordHeaderBytes + payload.size());
+            uint32_t checksum = recordChecksum(index, payload.data(), payload.size());
+            putU32(record, payload.size());
+            putU32(record, checksum);
+            putU64(record, index);
+            record.append(payload);
+
+            size_t recordBytes = record.size();
+            writer.write(segmentFd, segmentSize, std::move(record), index);
+
+            WalPendingEntry entry;
+            entry.index = index;
+            entry.segment = segments.size() - 1;
+            entry.offset = segmentSize;
+            entry.checksum = checksum;
+            entry.op = op;
+            pending.push_back(entry);
+            addSeekPoint(segments.back(), index, segmentSize);
+
+            segmentSize += recordBytes;
+            lastIdx = index;
+
+            OperationView view;
+            uint8_t definedFields;
+            if (decodeOperationView(payload.data(), payload.size(), view, usernames, &definedFields)) {
+                usernames.learn(view, definedFields, index);
+            }
+            return index;
+        }
+
+    public:
+        WriteAheadLog() {}
+
+        ~WriteAheadLog() {
+            writer.stop();
+            if (segmentFd >= 0) {
+                close(segmentFd);
+            }
+            if (commitFd >= 0) {
+                close(commitFd);
+            }
+        }
+
+        // Opens (creating if needed) the log stored in dir and recovers its state
+        void open(std::string dir) {
+            walMutex.lock();
+            directory = dir;
+            mkdir(directory.c_str(), 0755);
+
+            // Find the segments on disk in index order
+            segments.clear();
+            pending.clear();
+            DIR* dirHandle = opendir(directory.c_str());
+            if (dirHandle == nullptr) {
+                walMutex.unlock();
+                throw std::runtime_error("Could not open log directory " + directory);
+            }
+            struct dirent* dirEntry;
+            while ((dirEntry = readdir(dirHandle)) != nullptr) {
+                std::string name = dirEntry->d_name;
+                for (const std::string& extension : {g_walSegmentExtension, g_walCompressedExtension}) {
+                    if (name.size() > extension.size() &&
+                            name.compare(name.size() - extension.size(), extension.size(), extension) == 0) {
+                        WalSegment segment;
+                        segment.firstIndex = std::stoull(name.substr(0, name.size() - extension.size()));
+                        segment.path = directory + "/" + name;
+                        segment.compressed = extension == g_walCompressedExtension;
+                        segments.push_back(segment);
+                    }
+                }
+            }
+            closedir(dirHandle);
+            std::sort(segments.begin(), segments.end(), [](const WalSegment& a, const WalSegment& b) {
+                return a.firstIndex < b.firstIndex || (a.firstIndex == b.firstIndex && a.compressed && !b.compressed);
+            });
+
+            // A crash after compressing a segment can leave the original behind
+            for (size_t s = 1; s < segments.size(); s++) {
+                if (segments[s].firstIndex == segments[s - 1].firstIndex) {
+                    unlink(segments[s].path.c_str());
+                    segments.erase(segments.begin() + s);
+                    s--;
+                }
+            }
+
+            loadCommitIndex();
+            loadUsernames();
+            lastIdx = segments.empty() ? 0 : segments[0].firstIndex - 1;
+            for (size_t s = 0; s < segments.size(); s++) {
+                if (segments[s].firstIndex != lastIdx + 1) {
+                    // Anything after a gap cannot be trusted
+                    for (size_t extra = s; extra < segments.size(); extra++) {
+                        unlink(segments[extra].path.c_str());
+                    }
+                    segments.resize(s);
+                    break;
+                }
+                recoverSegment(s);
+            }
+
+            if (commitIdx > lastIdx) {
+                commitIdx = lastIdx;
+                persistCommitIndex();
+            }
+            openLastSegment();
+            writer.start(lastIdx);
+            writer.setWrittenIndex(lastIdx);
+
+            // What survived recovery may still only be in the page cache
+            syncMutex.lock();
+            syncedIdx = 0;
+            syncMutex.unlock();
+            walMutex.unlock();
+        }
+
+        // Appends an operation as the next entry and waits until it is written, returns its index
+        uint64_t append(const OperationClass& op) {
+            uint64_t index = appendAsync(op);
+            writer.waitWritten(index);
+            return index;
+        }
+
+        // Queues an operation as the next entry with the log writer and returns its index at once,
+        // so a batch of appends is in flight together. waitWritten or sync wait for it. The logged
+        // bytes are put in payload when it is given, for replicating them as is
+        uint64_t appendAsync(const OperationClass& op, std::string* payload = nullptr) {
+            walMutex.lock();
+            std::string encoded = encodeOperation(op, usernames);
+            uint64_t index = appendRecord(encoded, op);
+            walMutex.unlock();
+            if (payload != nullptr) {
+                *payload = std::move(encoded);
+            }
+            return index;
+        }
+
+        // Like appendAsync for an operation already encoded, as received from the leader
+        uint64_t appendEncodedAsync(const std::string& payload, const OperationClass& op) {
+            walMutex.lock();
+            uint64_t index = appendRecord(payload, op);
+            walMutex.unlock();
+            return index;
+        }
+
+        // Waits until every entry up to index is written to its segment
+        void waitWritten(uint64_t index) {
+            writer.waitWritten(index);
+        }
+
+        // Index of the last entry whose record and every record before it are written
+        uint64_t writtenIndex() {
+            return writer.writtenIndex();
+        }
+
+        bool usingIoUring() {
+            return writer.usingIoUring();
+        }
+
+        // Returns once every entry up to index is on disk, or false if the log could not be synced.
+        // Callers that arrive while another sync runs wait for it, so one fdatasync covers every
+        // append made before it started
+        bool sync(uint64_t index) {
+            std::unique_lock<std::mutex> lock(syncMutex);
+            while (syncedIdx < index) {
+                if (syncFailed) {
+                    return false;
+                }
+                if (syncRunning) {
+                    syncCondition.wait(lock);
+                    continue;
+                }
+                syncRunning = true;
+                lock.unlock();
+
+                // A duplicate stays valid if an append seals the segment meanwhile
+                walMutex.lock();
+                uint64_t target = lastIdx;
+                int fd = dup(segmentFd);
+                walMutex.unlock();
+                // Entries past the end were truncated away, there is nothing more to wait for
+                index = std::min(index, target);
+                bool synced = fd >= 0 && writer.sync(fd);
+                if (fd >= 0) {
+                    close(fd);
+                }
+
+                lock.lock();
+                syncRunning = false;
+                if (synced) {
+                    syncedIdx = std::max(syncedIdx, target);
+                    syncs++;
+                } else {
+                    syncFailed = true;
+                }
+                syncCondition.notify_all();
+            }
+            return true;
+        }
+
+        // Index of the last entry known to be on disk
+        uint64_t syncedIndex() {
+            syncMutex.lock();
+            uint64_t toReturn = syncedIdx;
+            syncMutex.unlock();
+            return toReturn;
+        }
+
+        // Number of fdatasync calls sync() made, to see how well they coalesce
+        int syncCount() {
+            syncMutex.lock();
+            int toReturn = syncs;
+            syncMutex.unlock();
+            return toReturn;
+        }
+
+        // Advances the commit index to index, returns the entries that became committed
+        std::vector<OperationClass> commit(uint64_t index) {
+            std::vector<OperationClass> committed;
+            walMutex.lock();
+            index = std::min(index, lastIdx);
+            while (!pending.empty() && pending.front().index <= index) {
+                committed.push_back(std::move(pending.front().op));
+                pending.pop_front();
+            }
+            if (index > commitIdx) {
+                commitIdx = index;
+                persistCommitIndex();
+            }
+            walMutex.unlock();
+            return committed;
+        }
+
+        // Commits the oldest pending entry, returns false if nothing was pending
+        bool commitNext(OperationClass& op) {
+            walMutex.lock();
+            if (pending.empty()) {
+                walMutex.unlock();
+                return false;
+            }
+            op = std::move(pending.front().op);
+            commitIdx = pending.front().index;
+            pending.pop_front();
+            persistCommitIndex();
+            walMutex.unlock();
+            return true;
+        }
+
+        // Returns copies of all uncommitted entries
+        std::vector<OperationClass> pendingEntries() {
+            std::vector<OperationClass> entries;
+            walMutex.lock();
+            for (const WalPendingEntry& entry : pending) {
+                entries.push_back(entry.op);
+            }
+            walMutex.unlock();
+            return entries;
+        }
+
+        // Calls back for every committed entry with index >= from
+        void forEachCommitted(uint64_t from, const std::function<void(uint64_t, OperationClass&)>& callback) {
+            forEachCommittedView(from, [&callback](uint64_t index, const OperationView& view) {
+                OperationClass op = toOperation(view);
+                callback(index, op);
+            });
+        }
+
+        // Like forEachCommitted, but hands out views into the log instead of copies
+        void forEachCommittedView(uint64_t from, const std::function<void(uint64_t, const OperationView&)>& callback) {
+            walMutex.lock();
+            uint64_t to = commitIdx;
+            walMutex.unlock();
+            forEachEntryView(from, to, callback);
+        }
+
+        // Calls back for every entry in [from, to], committed or not
+        void forEachEntry(uint64_t from, uint64_t to, const std::function<void(uint64_t, OperationClass&)>& callback) {
+            forEachEntryView(from, to, [&callback](uint64_t index, const OperationView& view) {
+                OperationClass op = toOperation(view);
+                callback(index, op);
+            });
+        }
+
+        void forEachEntryView(uint64_t from, uint64_t to, const std::function<void(uint64_t, const OperationView&)>& callback) {
+            scan(from, to, [this, &callback](uint64_t index, const char* payload, uint32_t length) {
+                OperationView op;
+                if (!decodeOperationView(payload, length, op, usernames)) {
+                    return false;
+                }
+                callback(index, op);
+                return true;
+            });
+        }
+
+        // Hands out the encoded payloads of entries in [from, to], for shipping them as logged
+        void forEachEncodedEntry(uint64_t from, uint64_t to, const std::function<void(uint64_t, const char*, uint32_t)>& callback) {
+            scan(from, to, [&callback](uint64_t index, const char* payload, uint32_t length) {
+                callback(index, payload, length);
+                return true;
+            });
+        }
+
+        void forEachCommittedEncoded(uint64_t from, const std::function<void(uint64_t, const char*, uint32_t)>& callback) {
+            walMutex.lock();
+            uint64_t to = commitIdx;
+            walMutex.unlock();
+            forEachEncodedEntry(from, to, callback);
+        }
+
+        // Whether the entry at index was logged with exactly this payload. Entries past the end of
+        // the log, or compacted away, do not match
+        bool entryMatches(uint64_t index, const std::string& payload) {
+            walMutex.lock();
+            if (!pending.empty() && index >= pending.front().index && index <= lastIdx) {
+                bool matches = pending[index - pending.front().index].checksum == recordChecksum(index, payload.data(), payload.size());
+                walMutex.unlock();
+                return matches;
+            }
+            walMutex.unlock();
+            // Committed entries are compared against the record itself
+            bool matches = false;
+            scan(index, index, [&](uint64_t entryIndex, const char* data, uint32_t length) {
+                matches = length == payload.size() && memcmp(data, payload.data(), length) == 0;
+                return false;
+            });
+            return matches;
+        }
+
+        // Checksum of the record at index, false if the log does not hold it
+        bool entryChecksum(uint64_t index, uint32_t& checksum) {
+            bool found = false;
+            scan(index, index, [&](uint64_t entryIndex, const char* payload, uint32_t length) {
+                checksum = recordChecksum(entryIndex, payload, length);
+                found = true;
+                return false;
+            });
+            return found;
+        }
+
+        // Drops uncommitted entries from the end of the log, every one of them or those from index
+        // from on. Committed entries are never dropped
+        void truncatePending(uint64_t from = 0) {
+            std::unique_lock<std::mutex> lock(walMutex);
+            scanCondition.wait(lock, [this] { return activeScans == 0; });
+            writer.drain();
+            from = std::max(from, commitIdx + 1);
+            if (!pending.empty() && from <= lastIdx) {
+                size_t firstDropped = from - pending.front().index;
+                WalPendingEntry first = pending[firstDropped];
+                for (size_t s = segments.size() - 1; s > first.segment; s--) {
+                    unlink(segments[s].path.c_str());
+                }
+                segments.resize(first.segment + 1);
+                WalSegment& segment = segments.back();
+                while (!segment.seekPoints.empty() && segment.seekPoints.back().index >= first.index) {
+                    segment.seekPoints.pop_back();
+                }
+                segment.endOffset = first.offset;
+                resetSegmentTail(segment.path, first.offset, true);
+                pending.erase(pending.begin() + firstDropped, pending.end());
+                lastIdx = first.index - 1;
+                truncations++;
+                usernames.truncate(lastIdx);
+                writer.setWrittenIndex(lastIdx);
+                lowerSyncedIndex();
+                openLastSegment();
+            }
+        }
+
+        // Deletes every committed segment whose entries are all at or below index, which a snapshot
+        // covers. The segment being appended to is always kept
+        void compact(uint64_t index) {
+            // Scans open the segments they copied as they reach them, so none may be running
+            std::unique_lock<std::mutex> lock(walMutex);
+            scanCondition.wait(lock, [this] { return activeScans == 0; });
+            index = std::min(index, commitIdx);
+            size_t dropped = 0;
+            while (dropped + 1 < segments.size() && segments[dropped + 1].firstIndex - 1 <= index) {
+                dropped++;
+            }
+            if (dropped > 0) {
+                // The names these segments define have to be on disk before they go
+                if (usernamesIdx < commitIdx && !persistUsernames(commitIdx)) {
+                    return;
+                }
+                for (size_t s = 0; s < dropped; s++) {
+                    unlink(segments[s].path.c_str());
+                }
+                segments.erase(segments.begin(), segments.begin() + dropped);
+                for (WalPendingEntry& entry : pending) {
+                    entry.segment -= dropped;
+                }
+            }
+        }
+
+        // Rewrites every sealed segment whose entries are all committed as compressed blocks,
+        // returns how many were compressed. Compression runs without walMutex
+        int compressSealedSegments() {
+            int compressedSegments = 0;
+            while (true) {
+                walMutex.lock();
+                size_t s = 0;
+                while (s + 1 < segments.size() && (segments[s].compressed || segments[s + 1].firstIndex - 1 > commitIdx)) {
+                    s++;
+                }
+                if (s + 1 >= segments.size()) {
+                    walMutex.unlock();
+                    break;
+                }
+                // Recovery does not decode compressed segments, so the names they define go to disk first
+                if (usernamesIdx < segments[s + 1].firstIndex - 1 && !persistUsernames(commitIdx)) {
+                    walMutex.unlock();
+                    break;
+                }
+                std::string path = segments[s].path;
+                uint64_t firstIndex = segments[s].firstIndex;
+                uint64_t startTruncations = truncations;
+                walMutex.unlock();
+
+                std::string compressedPath = segmentPath(firstIndex, g_walCompressedExtension);
+                std::vector<WalSeekPoint> blocks;
+                if (!writeCompressedSegment(path, compressedPath, blocks)) {
+                    break;
+                }
+
+                // Scans in flight may still be reading the original
+                std::unique_lock<std::mutex> lock(walMutex);
+                scanCondition.wait(lock, [this] { return activeScans == 0; });
+                auto segment = std::find_if(segments.begin(), segments.end(), [&path](const WalSegment& other) {
+                    return other.path == path;
+                });
+                if (segment == segments.end() || truncations != startTruncations) {
+                    // Compacted or reset meanwhile
+                    unlink(compressedPath.c_str());
+                    break;
+                }
+                segment->path = compressedPath;
+                segment->compressed = true;
+                segment->seekPoints = blocks;
+                unlink(path.c_str());
+                compressedSegments++;
+            }
+            return compressedSegments;
+        }
+
+        // Deletes every entry, committed or not. The log then continues after index,
+        // which is where a freshly installed snapshot ends, with the usernames it interned
+        void reset(uint64_t index = 0, const std::vector<std::string>& snapshotUsernames = std::vector<std::string>()) {
+            std::unique_lock<std::mutex> lock(walMutex);
+            scanCondition.wait(lock, [this] { return activeScans == 0; });
+            writer.drain();
+            for (const WalSegment& segment : segments) {
+                unlink(segment.path.c_str());
+            }
+            segments.clear();
+            pending.clear();
+            lastIdx = index;
+            commitIdx = index;
+            truncations++;
+            usernames.clear();
+            for (const std::string& name : snapshotUsernames) {
+                usernames.define(name, index);
+            }
+            persistUsernames(index);
+            persistCommitIndex();
+            writer.setWrittenIndex(lastIdx);
+            lowerSyncedIndex();
+            openLastSegment();
+        }
+
+        // Deserializes a payload from this log or its leader's, returns false if it is malformed
+        bool decode(const std::string& payload, OperationClass& op) {
+            return decodeOperation(payload, op, usernames);
+        }
+
+        // Usernames interned by entries up to index, in id order, for snapshots
+        std::vector<std::string> usernamesUpTo(uint64_t index) {
+            return usernames.namesUpTo(index);
+        }
+
+        size_t usernameCount() {
+            return usernames.size();
+        }
+
+        // Index of the oldest entry still in the log
+        uint64_t firstIndex() {
+            walMutex.lock();
+            uint64_t toReturn = segments.empty() ? lastIdx + 1 : segments[0].firstIndex;
+            walMutex.unlock();
+            return toReturn;
+        }
+
+        uint64_t lastIndex() {
+            walMutex.lock();
+            uint64_t toReturn = lastIdx;
+            walMutex.unlock();
+            return toReturn;
+        }
+
+        uint64_t commitIndex() {
+            walMutex.lock();
+            uint64_t toReturn = commitIdx;
+            walMutex.unlock();
+            return toReturn;
+        }
+};
@@ -0,0 +1,190 @@
+#include <chrono>
+#include <random>
+#include "../chatService/server/writeAheadLog.h"
+
+// Weighs zlib block compression of the log against what it saves on the wire. A message-heavy log
+// (mostly SEND_MESSAGE between a few dozen users, some reads and new accounts) is written through
+// the write-ahead log, then its entries are framed the way sendLogs ships them and compressed in
+// g_compressionBlockBytes blocks at several levels. For each level it reports compress and
+// decompress throughput, the ratio, and the time to catch a follower up over a few link speeds,
+// counting compression and decompression as if they did not overlap the transfer. Last, it
+// compresses the sealed segments on disk and reports the space saved.
+// Usage: compressionBenchmark [log directory] [entries]
+
+const int g_benchmarkUsers = 40;
+const int g_benchmarkRuns = 3;
+
+// Removes the benchmark log
+void removeLogDirectory(std::string dir) {
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            unlink((dir + "/" + name).c_str());
+        }
+    }
+    closedir(dirHandle);
+    rmdir(dir.c_str());
+}
+
+// Chat-like text, a handful of words drawn from a small vocabulary
+std::string randomMessage(std::mt19937& random) {
+    static const char* words[] = {
+        "hey", "hi", "are", "you", "coming", "to", "the", "lecture", "today", "I", "think", "so",
+        "did", "finish", "problem", "set", "not", "yet", "what", "about", "lunch", "at", "noon",
+        "sounds", "good", "see", "there", "can", "we", "meet", "later", "sure", "thanks", "for",
+        "help", "with", "project", "replication", "is", "working", "now", "leader", "election",
+        "still", "flaky", "on", "my", "machine", "let", "me", "know", "when", "push", "tests",
+        "pass", "lol", "ok", "tomorrow", "morning", "office", "hours", "question"};
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+    std::string message;
+    int length = 3 + random() % 18;
+    for (int i = 0; i < length; i++) {
+        if (i > 0) {
+            message += ' ';
+        }
+        message += words[random() % wordCount];
+    }
+    return message;
+}
+
+std::string username(int user) {
+    return "user" + std::to_string(user);
+}
+
+// Best of several runs, in seconds
+double bestSeconds(const std::function<void()>& run) {
+    double best = 0;
+    for (int i = 0; i < g_benchmarkRuns; i++) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+// Bytes of every file in the log directory with the given extension
+size_t segmentBytes(std::string dir, std::string extension) {
+    size_t total = 0;
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return 0;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        struct stat st;
+        if (name.size() > extension.size() && name.compare(name.size() - extension.size(), extension.size(), extension) == 0 &&
+                stat((dir + "/" + name).c_str(), &st) == 0) {
+            total += st.st_size;
+        }
+    }
+    closedir(dirHandle);
+    return total;
+}
+
+int main(int argc, char* argv[]) {
+    std::string dir = argc > 1 ? argv[1] : "compressionBenchmarkLog";
+    int entries = argc > 2 ? std::stoi(argv[2]) : 200000;
+
+    // Small segments, so nearly the whole log is sealed and can be compressed at the end
+    removeLogDirectory(dir);
+    g_walSegmentBytes = 1 << 20;
+    WriteAheadLog wal;
+    wal.open(dir);
+    std::mt19937 random(262);
+    for (int user = 0; user < g_benchmarkUsers; user++) {
+        OperationClass op = makeOperation(CREATE_ACCOUNT, username(user), "", "password" + std::to_string(user), "");
+        op.clockVal = user + 1;
+        wal.appendAsync(op);
+    }
+    for (int i = g_benchmarkUsers; i < entries; i++) {
+        int sender = random() % g_benchmarkUsers;
+        int receiver = (sender + 1 + random() % (g_benchmarkUsers - 1)) % g_benchmarkUsers;
+        OperationClass op;
+        if (random() % 10 == 0) {
+            op = makeOperation(MESSAGES_SEEN, username(sender), username(receiver), "", "");
+            op.messagesSeen = 1 + random() % 5;
+        } else {
+            op = makeOperation(SEND_MESSAGE, username(sender), username(receiver), "", randomMessage(random));
+        }
+        op.clockVal = i + 1;
+        wal.appendAsync(op);
+    }
+    wal.waitWritten(wal.lastIndex());
+    wal.commit(wal.lastIndex());
+
+    // Frame the entries as catch-up sends them and cut them into blocks
+    std::vector<std::string> blocks(1);
+    size_t rawBytes = 0;
+    wal.forEachCommittedEncoded(1, [&](uint64_t index, const char* payload, uint32_t length) {
+        putVarString(blocks.back(), payload, length);
+        if (blocks.back().size() >= g_compressionBlockBytes) {
+            rawBytes += blocks.back().size();
+            blocks.push_back(std::string());
+        }
+    });
+    rawBytes += blocks.back().size();
+    std::cout << entries << " entries, " << rawBytes / 1e6 << " MB framed, " << blocks.size()
+              << " blocks of " << g_compressionBlockBytes / 1024 << " KiB" << std::endl;
+
+    const double linkMbits[] = {100, 1000, 10000};
+    for (double mbits : linkMbits) {
+        std::cout << "uncompressed over " << mbits << " Mbit/s: " << rawBytes * 8 / (mbits * 1e6) << " s" << std::endl;
+    }
+
+    const int levels[] = {1, 3, 6, 9};
+    for (int level : levels) {
+        std::vector<std::string> compressed(blocks.size());
+        double compressSeconds = bestSeconds([&]() {
+            for (size_t b = 0; b < blocks.size(); b++) {
+                compressBlock(blocks[b].data(), blocks[b].size(), compressed[b], level);
+            }
+        });
+        size_t compressedBytes = 0;
+        for (const std::string& block : compressed) {
+            compressedBytes += block.size();
+        }
+        std::string inflated;
+        bool intact = true;
+        double decompressSeconds = bestSeconds([&]() {
+            for (size_t b = 0; b < blocks.size(); b++) {
+                intact = decompressBlock(compressed[b].data(), compressed[b].size(), blocks[b].size(), inflated) &&
+                         inflated == blocks[b] && intact;
+            }
+        });
+        if (!intact) {
+            std::cout << "level " << level << ": blocks did not round trip" << std::endl;
+            return 1;
+        }
+
+        std::cout << "level " << level << ": ratio " << static_cast<double>(rawBytes) / compressedBytes
+                  << ", compress " << rawBytes / compressSeconds / 1e6 << " MB/s, decompress "
+                  << rawBytes / decompressSeconds / 1e6 << " MB/s" << std::endl;
+        for (double mbits : linkMbits) {
+            double rawSeconds = rawBytes * 8 / (mbits * 1e6);
+            double compressedSeconds = compressedBytes * 8 / (mbits * 1e6) + compressSeconds + decompressSeconds;
+            std::cout << "  over " << mbits << " Mbit/s: " << compressedSeconds << " s, "
+                      << rawSeconds / compressedSeconds << "x uncompressed" << std::endl;
+        }
+    }
+
+    // Archive the sealed segments, the one being appended to stays as it is
+    size_t before = segmentBytes(dir, g_walSegmentExtension);
+    auto start = std::chrono::steady_clock::now();
+    int compressedSegments = wal.compressSealedSegments();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t sealed = before - segmentBytes(dir, g_walSegmentExtension);
+    size_t after = segmentBytes(dir, g_walCompressedExtension);
+    std::cout << "compressed " << compressedSegments << " sealed segments in " << seconds << " s, "
+              << sealed / 1e6 << " MB -> " << after / 1e6 << " MB on disk" << std::endl;
+    removeLogDirectory(dir);
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include <atomic>
+#include <chrono>
+#include <random>
+#include "../chatService/server/storageUpdates.h"
+
+// Measures how lookups of unrelated conversations contend on messagesDictionary, with every shard
+// count in turn. Each reader thread has a conversation of its own. "lookups" has the readers
+// only find their conversation in the dictionary; "queries" has them run tryQueryMessages on it
+// while one more thread sends messages to random conversations, the way the server applies
+// committed writes while it answers reads. Operations per second are summed over the readers.
+// Usage: conversationContentionBenchmark [most reader threads] [milliseconds per run]
+
+const int g_seedMessages = 100;
+
+std::string username(int user) {
+    return "user" + std::to_string(user);
+}
+
+// Runs readers, and a writer if asked, for the given time. Returns reads and writes per second
+std::pair<double, double> runContention(int readers, int millis, bool queries) {
+    std::atomic<bool> stop(false);
+    std::atomic<long> reads(0);
+    std::atomic<long> writes(0);
+    std::vector<std::thread> threads;
+    for (int reader = 0; reader < readers; reader++) {
+        threads.push_back(std::thread([reader, queries, &stop, &reads]() {
+            std::string client = username(2 * reader);
+            std::string other = username(2 * reader + 1);
+            UserPair pair(userIds.find(client), userIds.find(other));
+            long done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (queries) {
+                    done += tryQueryMessages(client, other).empty() ? 0 : 1;
+                } else {
+                    done += messagesDictionary.find(pair) != nullptr ? 1 : 0;
+                }
+            }
+            reads += done;
+        }));
+    }
+    if (queries) {
+        threads.push_back(std::thread([readers, &stop, &writes]() {
+            std::mt19937 random(262);
+            long done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                int conversation = random() % readers;
+                done += trySendMessage(username(2 * conversation + 1), username(2 * conversation), "hello again") == 0 ? 1 : 0;
+            }
+            writes += done;
+        }));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+    stop = true;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return std::make_pair(reads / seconds, writes / seconds);
+}
+
+int main(int argc, char* argv[]) {
+    int mostReaders = argc > 1 ? std::stoi(argv[1]) : 16;
+    int millis = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+    // Account creation logs every user
+    std::cout.setstate(std::ios::failbit);
+    for (int user = 0; user < 2 * mostReaders; user++) {
+        tryCreateAccount(username(user), "password");
+    }
+    std::cout.clear();
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    const size_t shardCounts[] = {1, g_messagesDictionaryShards};
+    for (size_t shards : shardCounts) {
+        messagesDictionary.clear();
+        messagesDictionary.resize(shards);
+        for (int reader = 0; reader < mostReaders; reader++) {
+            for (int i = 0; i < g_seedMessages; i++) {
+                trySendMessage(username(2 * reader), username(2 * reader + 1), "hello");
+            }
+        }
+
+        for (int readers = 1; readers <= mostReaders; readers *= 2) {
+            double lookups = runContention(readers, millis, false).first;
+            std::pair<double, double> queries = runContention(readers, millis, true);
+            std::cout << shards << " shards, " << readers << " readers: " << lookups / 1e6 << "M lookups/s, "
+                      << queries.first / 1e3 << "K queries/s with " << queries.second / 1e3 << "K sends/s" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <chrono>
+#include "../chatService/server/storageUpdates.h"
+
+// Reports delimiter scanning and record splitting throughput in GB/s for each scan level. The
+// data rows of the committed CSV logs are repeated until the input is about g_benchmarkBytes.
+// Usage: csvScannerBenchmark [committedLog.csv ...]
+
+const size_t g_benchmarkBytes = 256 << 20;
+const int g_benchmarkRuns = 5;
+
+const char* levelName(CsvScanLevel level) {
+    switch (level) {
+        case CSV_SCAN_AVX2:
+            return "avx2";
+        case CSV_SCAN_SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
+
+// Best of several runs, in GB/s
+double bestThroughput(size_t bytes, const std::function<void()>& run) {
+    double bestSeconds = 0;
+    for (int i = 0; i < g_benchmarkRuns; i++) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || seconds < bestSeconds) {
+            bestSeconds = seconds;
+        }
+    }
+    return bytes / bestSeconds / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> logFiles;
+    for (int i = 1; i < argc; i++) {
+        logFiles.push_back(argv[i]);
+    }
+    if (logFiles.empty()) {
+        logFiles = {"../committedLog10.250.69.116:8080.csv", "../committedLog10.250.69.116:8081.csv",
+                    "../committedLog10.250.69.116:8082.csv", "../committedLog10.250.179.231:8080.csv"};
+    }
+
+    // Data rows of every log, without their headers
+    std::string rows;
+    for (const std::string& logFile : logFiles) {
+        bool header = true;
+        forEachCsvRow(logFile, [&rows, &header](std::vector<std::string>& row) {
+            if (header) {
+                header = false;
+                return;
+            }
+            for (size_t i = 0; i < row.size(); i++) {
+                rows.append(row[i]);
+                rows.push_back(i + 1 < row.size() ? ',' : '\n');
+            }
+        });
+    }
+    if (rows.empty()) {
+        std::cout << "No log rows to scale up" << std::endl;
+        return 1;
+    }
+
+    std::string text;
+    text.reserve(g_benchmarkBytes + rows.size());
+    while (text.size() < g_benchmarkBytes) {
+        text.append(rows);
+    }
+    std::cout << "Scanning " << text.size() / (1 << 20) << " MiB built from " << rows.size() << " bytes of log rows" << std::endl;
+
+    std::vector<CsvScanLevel> levels = {CSV_SCAN_SCALAR};
+#ifdef CSV_SCAN_X86
+    levels.push_back(CSV_SCAN_SSE2);
+    if (g_csvScanLevel == CSV_SCAN_AVX2) {
+        levels.push_back(CSV_SCAN_AVX2);
+    }
+#endif
+
+    for (CsvScanLevel level : levels) {
+        size_t delimiters = 0;
+        auto count = [&delimiters](size_t position, char delimiter) {
+            delimiters++;
+        };
+        double scanning = bestThroughput(text.size(), [&]() {
+            delimiters = 0;
+            forEachCsvDelimiter(text.data(), text.size(), count, level);
+        });
+
+        CsvScanLevel defaultLevel = g_csvScanLevel;
+        g_csvScanLevel = level;
+        size_t records = 0;
+        double splitting = bestThroughput(text.size(), [&]() {
+            records = 0;
+            forEachCsvRecord(text.data(), text.size(), [&records](std::vector<FieldView>& fields) {
+                records++;
+            });
+        });
+        g_csvScanLevel = defaultLevel;
+
+        std::cout << levelName(level) << ": delimiters " << scanning << " GB/s (" << delimiters << "), records "
+                  << splitting << " GB/s (" << records << ")" << std::endl;
+    }
+
+    // The getline splitting readFile used before, for comparison
+    size_t records = 0;
+    double getlineSplitting = bestThroughput(text.size(), [&]() {
+        records = 0;
+        std::stringstream stream(text);
+        std::string line, word;
+        std::vector<std::string> row;
+        while (getline(stream, line)) {
+            row.clear();
+            std::stringstream str(line);
+            while (getline(str, word, ',')) {
+                row.push_back(word);
+            }
+            records++;
+        }
+    });
+    std::cout << "getline: records " << getlineSplitting << " GB/s (" << records << ")" << std::endl;
+    return 0;
+}
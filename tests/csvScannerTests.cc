@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "../chatService/server/storageUpdates.h"
+
+// Collects the delimiter offsets one scan level finds
+std::vector<size_t> delimiterOffsets(const std::string& text, size_t start, CsvScanLevel level) {
+    std::vector<size_t> offsets;
+    auto collect = [&offsets](size_t position, char delimiter) {
+        offsets.push_back(position);
+    };
+    forEachCsvDelimiter(text.data() + start, text.size() - start, collect, level);
+    return offsets;
+}
+
+TEST(CsvScanner, LevelsAgree) {
+    std::mt19937 generator(262);
+    const char alphabet[] = {'a', 'b', ',', '\n', '1', ' ', '\r', '\0', static_cast<char>(0xac)};
+    for (size_t length = 0; length < 200; length++) {
+        std::string text;
+        for (size_t i = 0; i < length; i++) {
+            text.push_back(alphabet[generator() % sizeof(alphabet)]);
+        }
+
+        // Every starting alignment, so blocks straddle the tail
+        for (size_t start = 0; start < 4 && start <= length; start++) {
+            std::vector<size_t> scalar = delimiterOffsets(text, start, CSV_SCAN_SCALAR);
+            EXPECT_EQ(delimiterOffsets(text, start, CSV_SCAN_SSE2), scalar);
+            if (g_csvScanLevel == CSV_SCAN_AVX2) {
+                EXPECT_EQ(delimiterOffsets(text, start, CSV_SCAN_AVX2), scalar);
+            }
+        }
+    }
+}
+
+TEST(CsvScanner, SplittingRecords) {
+    std::string text = "message_type,username1\n1,caro,NULL,p,\n\n5,victor,caro,hey\r\nlast,line";
+    std::vector<std::vector<std::string>> rows;
+    forEachCsvRecord(text.data(), text.size(), [&rows](std::vector<FieldView>& fields) {
+        std::vector<std::string> row;
+        for (const FieldView& field : fields) {
+            row.push_back(field.str());
+        }
+        rows.push_back(row);
+    });
+
+    // Same rows getline splitting gives: a trailing comma adds no field, an empty line is an empty row
+    ASSERT_EQ(rows.size(), 5);
+    EXPECT_EQ(rows[0], std::vector<std::string>({"message_type", "username1"}));
+    EXPECT_EQ(rows[1], std::vector<std::string>({"1", "caro", "NULL", "p"}));
+    EXPECT_EQ(rows[2].size(), 0);
+    EXPECT_EQ(rows[3], std::vector<std::string>({"5", "victor", "caro", "hey\r"}));
+    EXPECT_EQ(rows[4], std::vector<std::string>({"last", "line"}));
+}
+
+TEST(CsvScanner, ReadingCsvLog) {
+    std::vector<OperationClass> operations;
+    forEachCsvOperation("../tests/testlog.csv", [&operations](const OperationClass& operation) {
+        operations.push_back(operation);
+    });
+
+    // The last line has no newline
+    ASSERT_EQ(operations.size(), 9);
+    EXPECT_EQ(operations[0].opCode, 1);
+    EXPECT_EQ(operations[0].username1, "carolyn");
+    EXPECT_EQ(operations[4].message_content, "hello");
+    EXPECT_EQ(operations[6].messagesSeen, 1);
+    EXPECT_EQ(operations[6].password, "");
+    EXPECT_EQ(operations[8].clockVal, 9);
+
+    // A missing file has no rows
+    int rows = 0;
+    forEachCsvRow("../tests/missinglog.csv", [&rows](std::vector<std::string>& row) {
+        rows++;
+    });
+    EXPECT_EQ(rows, 0);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include "../chatService/server/writeAheadLog.h"
+
+// Measures the per-operation latency of each durability mode on the disk holding the log directory.
+// Concurrent writers append SEND_MESSAGE operations the way the group commit stage and followers do:
+// under "batch" every append waits for a (shared) sync, under "interval" a background thread syncs
+// every few milliseconds and appends wait only for their write, under "none" nothing is synced.
+// "group" is how the leader appends: one thread queues batches of g_groupSize with appendAsync and
+// syncs each batch once. Every mode runs with the io_uring log writer and the blocking fallback.
+// Usage: durabilityBenchmark [log directory] [writer threads] [operations per writer]
+
+const int g_intervalSyncMillis = 10;
+const int g_groupSize = 64;
+
+// Removes the benchmark log
+void removeLogDirectory(std::string dir) {
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            unlink((dir + "/" + name).c_str());
+        }
+    }
+    closedir(dirHandle);
+    rmdir(dir.c_str());
+}
+
+void runMode(std::string name, std::string dir, int threads, int operations) {
+    removeLogDirectory(dir);
+    WriteAheadLog wal;
+    wal.open(dir);
+
+    std::atomic<bool> writing(true);
+    std::thread syncThread;
+    if (name == "interval") {
+        syncThread = std::thread([&wal, &writing]() {
+            while (writing) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(g_intervalSyncMillis));
+                wal.sync(wal.lastIndex());
+            }
+        });
+    }
+
+    std::vector<std::vector<double>> latencies(threads);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; t++) {
+        writers.push_back(std::thread([&wal, &latencies, &name, t, operations]() {
+            OperationClass op = makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello, this is a message");
+            if (name == "group") {
+                for (int i = 0; i < operations; i += g_groupSize) {
+                    auto batchStart = std::chrono::steady_clock::now();
+                    uint64_t index = 0;
+                    int batch = std::min(g_groupSize, operations - i);
+                    for (int b = 0; b < batch; b++) {
+                        index = wal.appendAsync(op);
+                    }
+                    wal.sync(index);
+                    double latency = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - batchStart).count();
+                    latencies[t].insert(latencies[t].end(), batch, latency);
+                }
+                return;
+            }
+            for (int i = 0; i < operations; i++) {
+                auto opStart = std::chrono::steady_clock::now();
+                uint64_t index = wal.append(op);
+                if (name == "batch") {
+                    wal.sync(index);
+                }
+                latencies[t].push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - opStart).count());
+            }
+        }));
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    writing = false;
+    if (syncThread.joinable()) {
+        syncThread.join();
+    }
+
+    std::vector<double> all;
+    for (const std::vector<double>& threadLatencies : latencies) {
+        all.insert(all.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    std::sort(all.begin(), all.end());
+    double total = 0;
+    for (double latency : all) {
+        total += latency;
+    }
+    std::cout << name << " (" << (wal.usingIoUring() ? "io_uring" : "blocking") << "): " << static_cast<int>(all.size() / seconds) << " ops/s, latency mean "
+              << total / all.size() << " us, p50 " << all[all.size() / 2] << " us, p99 "
+              << all[all.size() * 99 / 100] << " us, " << wal.syncCount() << " syncs" << std::endl;
+    removeLogDirectory(dir);
+}
+
+int main(int argc, char* argv[]) {
+    std::string dir = argc > 1 ? argv[1] : "durabilityBenchmarkLog";
+    int threads = argc > 2 ? std::stoi(argv[2]) : 8;
+    int operations = argc > 3 ? std::stoi(argv[3]) : 2000;
+
+    std::cout << threads << " writers, " << operations << " operations each, interval syncs every "
+              << g_intervalSyncMillis << " ms" << std::endl;
+    for (int useIoUring = 1; useIoUring >= 0; useIoUring--) {
+        g_logWriterUseIoUring = useIoUring == 1;
+        runMode("none", dir, threads, operations);
+        runMode("batch", dir, threads, operations);
+        runMode("interval", dir, threads, operations);
+        runMode("group", dir, 1, threads * operations);
+    }
+    return 0;
+}
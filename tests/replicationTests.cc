@@ -0,0 +1,378 @@
+#include <gtest/gtest.h>
+#include "../chatService/server/serviceImplementations.h"
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <atomic>
+
+// Removes a log directory left over from an earlier run
+void clearLogDirectory(std::string dir) {
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            unlink((dir + "/" + name).c_str());
+        }
+    }
+    closedir(dirHandle);
+    rmdir(dir.c_str());
+}
+
+// Server running in this process. It is never shut down, the service keeps threads running in the background
+struct TestServer {
+    ChatServiceImpl* service;
+    Server* server;
+    std::string address;
+};
+
+// Serves a service on a free local port and sets address to it. The server is never shut down,
+// that would wait for the Replicate streams leaders keep open
+Server* listen(grpc::Service* service, std::string& address) {
+    int port = 0;
+    ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(service);
+    Server* server = builder.BuildAndStart().release();
+    address = "127.0.0.1:" + std::to_string(port);
+    return server;
+}
+
+TestServer startServer() {
+    TestServer testServer;
+    testServer.service = new ChatServiceImpl();
+    testServer.server = listen(testServer.service, testServer.address);
+    clearLogDirectory(g_walDirectory + testServer.address);
+    testServer.service->initialize(testServer.address);
+    return testServer;
+}
+
+std::unique_ptr<ChatService::Stub> connectTo(const std::string& address) {
+    return ChatService::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+}
+
+std::unique_ptr<ChatService::Stub> connectTo(const TestServer& testServer) {
+    return connectTo(testServer.address);
+}
+
+bool suggestElection(ChatService::Stub* stub) {
+    ClientContext context;
+    LeaderElectionProposal proposal;
+    LeaderElectionProposalResponse reply;
+    Status status = stub->SuggestLeaderElection(&context, proposal, &reply);
+    return status.ok() && reply.accept();
+}
+
+// Polls until condition holds, gives up after five seconds
+bool waitFor(std::function<bool()> condition) {
+    for (int i = 0; i < 500; i++) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+}
+
+LogPosition logPosition(ChatService::Stub* stub) {
+    ClientContext context;
+    LogPositionRequest request;
+    LogPosition position;
+    stub->RequestLogPosition(&context, request, &position);
+    return position;
+}
+
+bool createAccount(ChatService::Stub* stub, std::string username) {
+    ClientContext context;
+    CreateAccountMessage message;
+    message.set_username(username);
+    message.set_password("password");
+    CreateAccountReply reply;
+    return stub->CreateAccount(&context, message, &reply).ok();
+}
+
+// Replicate request carrying entries for a new account each, from firstIndex on. usernames
+// stands for the sending leader's log
+ReplicateRequest accountEntries(uint64_t firstIndex, std::vector<std::string> names, uint64_t commitIndex,
+                                UsernameDictionary& usernames) {
+    ReplicateRequest request;
+    for (size_t i = 0; i < names.size(); i++) {
+        LogEntry* entry = request.add_entries();
+        entry->set_index(firstIndex + i);
+        entry->set_operation(encodeStreamedOperation(makeOperation(CREATE_ACCOUNT, names[i], "", "password"), usernames, firstIndex + i));
+    }
+    request.set_commitindex(commitIndex);
+    return request;
+}
+
+ReplicateAck replicate(ClientReaderWriter<ReplicateRequest, ReplicateAck>* stream, const ReplicateRequest& request) {
+    ReplicateAck ack;
+    EXPECT_EQ(stream->Write(request), true);
+    EXPECT_EQ(stream->Read(&ack), true);
+    return ack;
+}
+
+// Stands in for a follower on the leader's Replicate stream. It acks like a follower that appends
+// every entry in order, but holds its acks while held and nacks the next nacksLeft requests with entries
+class ScriptedFollower final : public ChatService::Service {
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool held = false;
+        int nacksLeft = 0;
+        uint64_t lastIndex = 0;
+        std::vector<uint64_t> received;
+
+    public:
+        Status Replicate(ServerContext* context, ServerReaderWriter<ReplicateAck, ReplicateRequest>* stream) {
+            ReplicateRequest request;
+            while (stream->Read(&request)) {
+                std::unique_lock<std::mutex> lock(mutex);
+                for (const LogEntry& entry : request.entries()) {
+                    received.push_back(entry.index());
+                }
+                condition.notify_all();
+                condition.wait(lock, [this] { return !held; });
+
+                ReplicateAck ack;
+                ack.set_success(true);
+                if (request.entries_size() > 0) {
+                    if (nacksLeft > 0 || request.entries(0).index() > lastIndex + 1) {
+                        nacksLeft = std::max(0, nacksLeft - 1);
+                        ack.set_success(false);
+                    } else {
+                        lastIndex = std::max(lastIndex, request.entries(request.entries_size() - 1).index());
+                    }
+                }
+                ack.set_lastindex(lastIndex);
+                lock.unlock();
+                stream->Write(ack);
+            }
+            return Status::OK;
+        }
+
+        void hold(bool hold) {
+            mutex.lock();
+            held = hold;
+            mutex.unlock();
+            condition.notify_all();
+        }
+
+        void nack(int times) {
+            mutex.lock();
+            nacksLeft = times;
+            mutex.unlock();
+        }
+
+        // How many times the leader sent the entry at index
+        int timesReceived(uint64_t index) {
+            mutex.lock();
+            int times = std::count(received.begin(), received.end(), index);
+            mutex.unlock();
+            return times;
+        }
+};
+
+TEST(Replication, FollowerRefusesElectionsWithinLease) {
+    TestServer follower = startServer();
+    std::unique_ptr<ChatService::Stub> stub = connectTo(follower);
+
+    // Without a leader to hear from, the follower takes part in an election
+    EXPECT_EQ(suggestElection(stub.get()), true);
+
+    // Acking a Replicate request may renew the leader's lease
+    ClientContext context;
+    std::unique_ptr<ClientReaderWriter<ReplicateRequest, ReplicateAck>> stream(stub->Replicate(&context));
+    ReplicateRequest ping;
+    ReplicateAck ack;
+    ASSERT_EQ(stream->Write(ping), true);
+    ASSERT_EQ(stream->Read(&ack), true);
+    EXPECT_EQ(ack.success(), true);
+
+    EXPECT_EQ(suggestElection(stub.get()), false);
+    ClientContext voteContext;
+    CandidateValue candidate;
+    candidate.set_address("127.0.0.1:1");
+    LeaderElectionResponse vote;
+    EXPECT_EQ(stub->LeaderElection(&voteContext, candidate, &vote).error_code(), grpc::StatusCode::FAILED_PRECONDITION);
+    EXPECT_EQ(follower.service->proposeLeaderElection(), false);
+
+    // Once the lease ran out the follower may help elect another leader
+    std::this_thread::sleep_for(std::chrono::milliseconds(g_leaderLeaseMillis));
+    EXPECT_EQ(suggestElection(stub.get()), true);
+
+    stream->WritesDone();
+    EXPECT_EQ(stream->Finish().ok(), true);
+    clearLogDirectory(g_walDirectory + follower.address);
+}
+
+TEST(Replication, FollowerNacksGapsAndTakesResends) {
+    TestServer follower = startServer();
+    std::unique_ptr<ChatService::Stub> stub = connectTo(follower);
+    ClientContext context;
+    std::unique_ptr<ClientReaderWriter<ReplicateRequest, ReplicateAck>> stream(stub->Replicate(&context));
+    UsernameDictionary usernames;
+    ReplicateRequest first = accountEntries(1, {"nadia"}, 0, usernames);
+    ReplicateRequest second = accountEntries(2, {"noor"}, 2, usernames);
+
+    // Entry 1 never arrived, the leader is told to resend after 0
+    ReplicateAck ack = replicate(stream.get(), second);
+    EXPECT_EQ(ack.success(), false);
+    EXPECT_EQ(ack.needssnapshot(), false);
+    EXPECT_EQ(ack.lastindex(), 0);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 0);
+
+    ack = replicate(stream.get(), first);
+    EXPECT_EQ(ack.success(), true);
+    EXPECT_EQ(ack.lastindex(), 1);
+    ack = replicate(stream.get(), second);
+    EXPECT_EQ(ack.success(), true);
+    EXPECT_EQ(ack.lastindex(), 2);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 2);
+
+    stream->WritesDone();
+    EXPECT_EQ(stream->Finish().ok(), true);
+    clearLogDirectory(g_walDirectory + follower.address);
+}
+
+TEST(Replication, FollowerReplacesDivergentPendingEntries) {
+    TestServer follower = startServer();
+    std::unique_ptr<ChatService::Stub> stub = connectTo(follower);
+
+    // A leader that went down before committing left entry 1 pending
+    ClientContext oldContext;
+    std::unique_ptr<ClientReaderWriter<ReplicateRequest, ReplicateAck>> oldLeader(stub->Replicate(&oldContext));
+    UsernameDictionary oldUsernames;
+    ReplicateAck ack = replicate(oldLeader.get(), accountEntries(1, {"dmitri", "dana"}, 0, oldUsernames));
+    EXPECT_EQ(ack.success(), true);
+    EXPECT_EQ(ack.lastindex(), 2);
+    oldLeader->WritesDone();
+    EXPECT_EQ(oldLeader->Finish().ok(), true);
+
+    // The new leader's entry 1 differs, the follower's pending entries are dropped for it
+    ClientContext newContext;
+    std::unique_ptr<ClientReaderWriter<ReplicateRequest, ReplicateAck>> newLeader(stub->Replicate(&newContext));
+    UsernameDictionary newUsernames;
+    ReplicateRequest entries = accountEntries(1, {"delia"}, 1, newUsernames);
+    ack = replicate(newLeader.get(), entries);
+    EXPECT_EQ(ack.success(), true);
+    EXPECT_EQ(ack.lastindex(), 1);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 1);
+
+    // Resending it is acked as is, and the committed entry can no longer be replaced
+    ack = replicate(newLeader.get(), entries);
+    EXPECT_EQ(ack.success(), true);
+    EXPECT_EQ(ack.lastindex(), 1);
+    UsernameDictionary otherUsernames;
+    ack = replicate(newLeader.get(), accountEntries(1, {"dmitri"}, 1, otherUsernames));
+    EXPECT_EQ(ack.success(), false);
+    EXPECT_EQ(ack.needssnapshot(), true);
+
+    newLeader->WritesDone();
+    EXPECT_EQ(newLeader->Finish().ok(), true);
+    clearLogDirectory(g_walDirectory + follower.address);
+}
+
+TEST(Replication, LeaderCommitsOnceAQuorumAcks) {
+    TestServer leader = startServer();
+    std::vector<ScriptedFollower*> followers;
+    for (int i = 0; i < 4; i++) {
+        ScriptedFollower* follower = new ScriptedFollower();
+        follower->hold(true);
+        std::string address;
+        listen(follower, address);
+        leader.service->addConnection(address);
+        followers.push_back(follower);
+    }
+    leader.service->setAsLeader();
+    std::unique_ptr<ChatService::Stub> stub = connectTo(leader);
+
+    std::atomic<bool> created(false);
+    std::thread writer([&stub, &created] {
+        created = createAccount(stub.get(), "quentin");
+    });
+    EXPECT_EQ(waitFor([&followers] {
+        for (ScriptedFollower* follower : followers) {
+            if (follower->timesReceived(1) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }), true);
+
+    // Of five servers the leader and one follower are not a majority yet
+    followers[0]->hold(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(created.load(), false);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 0);
+
+    // A second follower's ack makes one
+    followers[1]->hold(false);
+    EXPECT_EQ(waitFor([&created] { return created.load(); }), true);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 1);
+
+    writer.join();
+    for (ScriptedFollower* follower : followers) {
+        follower->hold(false);
+    }
+    clearLogDirectory(g_walDirectory + leader.address);
+}
+
+TEST(Replication, LeaderResendsAfterNack) {
+    TestServer leader = startServer();
+    ScriptedFollower* follower = new ScriptedFollower();
+    follower->nack(1);
+    std::string address;
+    listen(follower, address);
+    leader.service->addConnection(address);
+    leader.service->setAsLeader();
+    std::unique_ptr<ChatService::Stub> stub = connectTo(leader);
+
+    // The follower turned the first send down, the entry only commits once it was sent again and acked
+    EXPECT_EQ(createAccount(stub.get(), "rosa"), true);
+    EXPECT_EQ(follower->timesReceived(1), 2);
+    EXPECT_EQ(logPosition(stub.get()).appliedindex(), 1);
+    clearLogDirectory(g_walDirectory + leader.address);
+}
+
+TEST(Replication, LeaderSendsSnapshotToDivergentFollower) {
+    TestServer leader = startServer();
+    TestServer follower = startServer();
+    std::unique_ptr<ChatService::Stub> leaderStub = connectTo(leader);
+    std::unique_ptr<ChatService::Stub> followerStub = connectTo(follower);
+
+    // The leader committed entries on its own
+    leader.service->setAsLeader();
+    EXPECT_EQ(createAccount(leaderStub.get(), "sven"), true);
+    EXPECT_EQ(createAccount(leaderStub.get(), "sofia"), true);
+
+    // The follower committed a different entry 1 under another leader
+    ClientContext context;
+    std::unique_ptr<ClientReaderWriter<ReplicateRequest, ReplicateAck>> stream(followerStub->Replicate(&context));
+    UsernameDictionary usernames;
+    EXPECT_EQ(replicate(stream.get(), accountEntries(1, {"sasha"}, 1, usernames)).success(), true);
+    stream->WritesDone();
+    EXPECT_EQ(stream->Finish().ok(), true);
+    LogPosition leaderPosition = logPosition(leaderStub.get());
+    LogPosition followerPosition = logPosition(followerStub.get());
+    EXPECT_EQ(followerPosition.appliedindex(), 1);
+    EXPECT_NE(followerPosition.appliedchecksum(), 0u);
+
+    // Appending after its entry 1 would keep the divergence, so it is replaced with the leader's state
+    leader.service->addConnection(follower.address);
+    leader.service->sendLogs();
+    followerPosition = logPosition(followerStub.get());
+    EXPECT_EQ(followerPosition.appliedindex(), 2);
+    EXPECT_EQ(followerPosition.hasappliedchecksum(), true);
+    EXPECT_EQ(followerPosition.appliedchecksum(), leaderPosition.appliedchecksum());
+    clearLogDirectory(g_walDirectory + leader.address);
+    clearLogDirectory(g_walDirectory + follower.address);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
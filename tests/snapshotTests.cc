@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../chatService/server/snapshot.h"
+
+TEST(Snapshot, RoundTrip) {
+    tryCreateAccount("carolyn", "password", 3);
+    tryCreateAccount("deleted", "password", 4);
+    tryCreateAccount("victor", "anotherpassword", 5);
+    tryDeleteAccount("deleted");
+    trySendMessage("carolyn", "victor", "hello");
+    trySendMessage("carolyn", "victor", "hello, again");
+    trySendMessage("victor", "carolyn", "hi");
+    tryMessagesSeen("victor", "carolyn", 1, 0);
+
+    std::string snapshot = encodeSnapshot(42, 7, {"carolyn", "victor"});
+    clearStorage();
+    EXPECT_EQ(userTrie.userExists("carolyn"), false);
+    EXPECT_EQ(messagesDictionary.size(), 0);
+
+    uint64_t index = 0;
+    int64_t clockVal = 0;
+    std::vector<std::string> usernames;
+    EXPECT_EQ(loadSnapshot(snapshot, index, clockVal, &usernames), true);
+    EXPECT_EQ(index, 42);
+    EXPECT_EQ(clockVal, 7);
+    EXPECT_EQ(usernames, std::vector<std::string>({"carolyn", "victor"}));
+
+    // Users and passwords, deleted users stay deleted
+    EXPECT_EQ(userTrie.verifyUser("carolyn", "password"), true);
+    EXPECT_EQ(userTrie.verifyUser("victor", "anotherpassword"), true);
+    EXPECT_EQ(userTrie.userExists("deleted"), false);
+
+    // Records keep their ids and creation clock values, and new users are numbered after them
+    EXPECT_EQ(userTrie.findUser("carolyn")->id, 1);
+    EXPECT_EQ(userTrie.findUser("victor")->id, 3);
+    EXPECT_EQ(userTrie.findUser("victor")->createdAt, 5);
+    tryCreateAccount("olive", "password", 8);
+    EXPECT_EQ(userTrie.findUser("olive")->id, 4);
+
+    // Messages keep their order and read flags
+    StoredMessages& storedMessages = messagesDictionary[UserPair(userIds.find("victor"), userIds.find("carolyn"))];
+    EXPECT_EQ(storedMessages.messageList.size(), 3);
+    EXPECT_EQ(storedMessages.messageList[1].messageContent, "hello, again");
+    EXPECT_EQ(storedMessages.messageList[0].isRead, true);
+    EXPECT_EQ(storedMessages.messageList[1].isRead, false);
+    EXPECT_EQ(storedMessages.messageList[2].senderId, userIds.find("victor"));
+
+    // Notification counts
+    EXPECT_EQ(conversationsDictionary.conversations[userIds.find("victor")][userIds.find("carolyn")], 1);
+    EXPECT_EQ(conversationsDictionary.conversations[userIds.find("carolyn")][userIds.find("victor")], 1);
+}
+
+TEST(Snapshot, CorruptSnapshot) {
+    tryCreateAccount("carolyn", "password");
+    std::string snapshot = encodeSnapshot(3, 3);
+
+    // A flipped byte fails the checksum and leaves storage alone
+    snapshot[snapshot.size() - 1] ^= 1;
+    uint64_t index = 0;
+    int64_t clockVal = 0;
+    EXPECT_EQ(loadSnapshot(snapshot, index, clockVal), false);
+    EXPECT_EQ(userTrie.userExists("carolyn"), true);
+
+    EXPECT_EQ(loadSnapshot("", index, clockVal), false);
+}
+
+TEST(Snapshot, ReplacingDuringReads) {
+    tryCreateAccount("carolyn", "password");
+    tryCreateAccount("victor", "password");
+    trySendMessage("carolyn", "victor", "hello");
+    std::string snapshot = encodeSnapshot(4, 4);
+
+    // Installing waits for the read in progress, reads started meanwhile wait for the install
+    std::atomic<bool> installed(false);
+    storageReaders.beginRead();
+    std::thread install([&snapshot, &installed]() {
+        uint64_t index = 0;
+        int64_t clockVal = 0;
+        storageReaders.beginReplace();
+        loadSnapshot(snapshot, index, clockVal);
+        installed = true;
+        storageReaders.endReplace();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(installed.load(), false);
+    storageReaders.endRead();
+
+    std::vector<ChatMessage> messages = tryQueryMessages("victor", "carolyn");
+    install.join();
+    EXPECT_EQ(installed.load(), true);
+    EXPECT_EQ(messages.size(), 1);
+}
+
+TEST(Snapshot, SnapshotFile) {
+    std::string path = "testSnapshot";
+    tryCreateAccount("carolyn", "password");
+    std::string snapshot = encodeSnapshot(5, 5);
+
+    EXPECT_EQ(writeSnapshotFile(path, snapshot), true);
+    std::string readBack;
+    EXPECT_EQ(readSnapshotFile(path, readBack), true);
+    EXPECT_EQ(readBack, snapshot);
+    unlink(path.c_str());
+
+    EXPECT_EQ(readSnapshotFile(path, readBack), false);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 #include "../chatService/server/storage.h"
 #include <unordered_set>
+#include <random>
+#include <set>
 
 // Tests for the data structures
 
-std::vector<std::string> usernameQuery (UserTrie trie, std::string query) {
+std::vector<std::string> usernameQuery (UserTrie& trie, std::string query) {
   try {
     std::vector<std::string> users = trie.returnUsersWithPrefix(query);
     return users;
@@ -13,7 +15,7 @@ std::vector<std::string> usernameQuery (UserTrie trie, std::string query) {
   }
 }
 
-void dummyIncrement(int Z, ConversationsDictionary* testConversationsDictionary, char sender[g_UsernameLimit], char recipient[g_UsernameLimit]) {
+void dummyIncrement(int Z, ConversationsDictionary* testConversationsDictionary, uint32_t sender, uint32_t recipient) {
   for (int i = 0; i < Z; i++) {
       testConversationsDictionary->newNotification(sender, recipient);
   }
@@ -21,7 +23,7 @@ void dummyIncrement(int Z, ConversationsDictionary* testConversationsDictionary,
   std::cerr << "incremented\n";
 
 };
- void dummyDecrement(int Z, ConversationsDictionary* testConversationsDictionary, char sender[g_UsernameLimit], char recipient[g_UsernameLimit]) {
+ void dummyDecrement(int Z, ConversationsDictionary* testConversationsDictionary, uint32_t sender, uint32_t recipient) {
   for (int i = 0; i < Z; i++) {
       testConversationsDictionary->notificationSeen(sender, recipient);
   }
@@ -31,8 +33,8 @@ void dummyIncrement(int Z, ConversationsDictionary* testConversationsDictionary,
 };
 
 TEST(ConversationsDictionaryTest, SingleThreadModifications) {
-  char sender[g_UsernameLimit] = "carolyn";
-  char recipient[g_UsernameLimit] = "victor";
+  uint32_t sender = userIds.intern("carolyn");
+  uint32_t recipient = userIds.intern("victor");
 
   ConversationsDictionary testConversationsDictionary;
 
@@ -54,8 +56,8 @@ TEST(ConversationsDictionaryTest, SingleThreadModifications) {
 }
 
 TEST(ConversationsDictionaryTest, MultiThreadedModifications) {
-  char sender[g_UsernameLimit] = "carolyn";
-  char recipient[g_UsernameLimit] = "victor";
+  uint32_t sender = userIds.intern("carolyn");
+  uint32_t recipient = userIds.intern("victor");
 
   ConversationsDictionary testConversationsDictionary;
 
@@ -72,22 +74,24 @@ TEST(ConversationsDictionaryText, GetNotifications) {
   char username1[g_UsernameLimit] = "carolyn";
   char username2[g_UsernameLimit] = "victor";
   char message[g_MessageLimit] = "Hello";
+  uint32_t userId1 = userIds.intern(username1);
+  uint32_t userId2 = userIds.intern(username2);
 
-  UserPair testpair(username1, username2);
+  UserPair testpair(userId1, userId2);
   std::unordered_map<UserPair, StoredMessages> testMessagesDictionary;
 
-  testMessagesDictionary[testpair].addMessage(username1, username2, message);
-  testMessagesDictionary[testpair].addMessage(username1, username2, message);
-  testMessagesDictionary[testpair].addMessage(username2, username1, message);
-  testMessagesDictionary[testpair].addMessage(username2, username1, message);
-  testMessagesDictionary[testpair].addMessage(username2, username1, message);
+  testMessagesDictionary[testpair].addMessage(userId1, userId2, message);
+  testMessagesDictionary[testpair].addMessage(userId1, userId2, message);
+  testMessagesDictionary[testpair].addMessage(userId2, userId1, message);
+  testMessagesDictionary[testpair].addMessage(userId2, userId1, message);
+  testMessagesDictionary[testpair].addMessage(userId2, userId1, message);
 
-  std::vector<std::pair<char [g_UsernameLimit], char> > username1Notifications = conversationsDictionary.getNotifications(username1);
+  std::vector<std::pair<char [g_UsernameLimit], char> > username1Notifications = conversationsDictionary.getNotifications(userId1);
 
   EXPECT_EQ(std::string(username1Notifications[0].first), std::string(username2));
   EXPECT_EQ(username1Notifications[0].second, 3);
 
-  std::vector<std::pair<char [g_UsernameLimit], char> > username2Notifications = conversationsDictionary.getNotifications(username2);
+  std::vector<std::pair<char [g_UsernameLimit], char> > username2Notifications = conversationsDictionary.getNotifications(userId2);
 
   EXPECT_EQ(std::string(username2Notifications[0].first), std::string(username1));
   EXPECT_EQ(username2Notifications[0].second, 2);
@@ -95,63 +99,128 @@ TEST(ConversationsDictionaryText, GetNotifications) {
 }
 
 TEST(MessagesDictionaryTest, UserPairExpectations) {
-  char username1[g_UsernameLimit] = "CaRolyn";
-  char username2[g_UsernameLimit] = "VictOr";
+  // Arguments in increasing order.
+  UserPair testpair1(3, 7);
 
-  // Arguments in alphabetical order.
-  UserPair testpair1(username1, username2);
-
-  // Expect smallerUsername to be Carolyn.
-  EXPECT_EQ(testpair1.smallerUsername, username1);
+  // Expect smallerId to be 3.
+  EXPECT_EQ(testpair1.smallerId(), 3);
   
-  // Expect largerUsername to be Victor.
-  EXPECT_EQ(testpair1.largerUsername, username2);
+  // Expect largerId to be 7.
+  EXPECT_EQ(testpair1.largerId(), 7);
 
-  // Arguments in reverse alphabetical order.
-  UserPair testpair2(username2, username1);
+  // Arguments in decreasing order make the same key.
+  UserPair testpair2(7, 3);
 
-  // Expect smallerUsername to be Carolyn.
-  EXPECT_EQ(testpair2.smallerUsername, username1);
-  
-  // Expect largerUsername to be Carolyn.
-  EXPECT_EQ(testpair2.largerUsername, username2);
+  EXPECT_EQ(testpair2.smallerId(), 3);
+  EXPECT_EQ(testpair2.largerId(), 7);
+  EXPECT_EQ(testpair1 == testpair2, true);
+  EXPECT_EQ(std::hash<UserPair>{}(testpair1), std::hash<UserPair>{}(testpair2));
 
-  char username3[g_UsernameLimit] = "1fdgaslkf";
-  char username4[g_UsernameLimit] = "3kjdsfUHFD!";
+  // Ids that use every bit stay apart.
+  UserPair testpair3(0xffffffff, 1);
 
-  // Arguments contain non-alphabetic characters.
-  UserPair testpair3(username3, username4);
+  EXPECT_EQ(testpair3.smallerId(), 1);
+  EXPECT_EQ(testpair3.largerId(), 0xffffffff);
+  EXPECT_EQ(testpair3 == UserPair(1, 0xfffffffe), false);
+}
 
-  // Expect smallerUsername to be 1fdgaslkf.
-  EXPECT_EQ(testpair3.smallerUsername, username3);
-  
-  // Expect largerUsername to be 3kjdsfUHFD!
-  EXPECT_EQ(testpair3.largerUsername, username4);
+TEST(MessagesDictionaryTest, InterningUserIds) {
+  UserIdTable testUserIds;
+
+  // Names get ids in the order they are first seen, and keep them
+  EXPECT_EQ(testUserIds.find("carolyn"), 0);
+  EXPECT_EQ(testUserIds.intern("carolyn"), 1);
+  EXPECT_EQ(testUserIds.intern("victor"), 2);
+  EXPECT_EQ(testUserIds.intern("carolyn"), 1);
+  EXPECT_EQ(testUserIds.find("victor"), 2);
+  EXPECT_EQ(testUserIds.name(2), "victor");
+
+  // Ids restored from a snapshot may leave gaps, new names come after them
+  testUserIds.assign("olive", 5);
+  EXPECT_EQ(testUserIds.find("olive"), 5);
+  EXPECT_EQ(testUserIds.name(5), "olive");
+  EXPECT_EQ(testUserIds.intern("james"), 6);
+
+  testUserIds.clear();
+  EXPECT_EQ(testUserIds.find("carolyn"), 0);
+}
+
+TEST(MessagesDictionaryTest, ShardedConversations) {
+  MessagesDictionary testMessagesDictionary(8);
+  EXPECT_EQ(testMessagesDictionary.find(UserPair(1, 2)), nullptr);
+
+  // Threads adding unrelated conversations at once each find their own afterwards
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < 4; t++) {
+    threads.push_back(std::thread([t, &testMessagesDictionary]() {
+      for (uint32_t i = 0; i < 500; i++) {
+        StoredMessages& storedMessages = testMessagesDictionary[UserPair(t * 1000 + i, t * 1000 + i + 1)];
+        storedMessages.messageList.push_back(StoredMessage(t * 1000 + i, false, "hello"));
+      }
+    }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(testMessagesDictionary.size(), 2000);
+  StoredMessages* storedMessages = testMessagesDictionary.find(UserPair(2401, 2400));
+  EXPECT_NE(storedMessages, nullptr);
+  EXPECT_EQ(storedMessages->messageList[0].senderId, 2400);
+  EXPECT_EQ(&testMessagesDictionary[UserPair(2400, 2401)], storedMessages);
+
+  size_t visited = 0;
+  testMessagesDictionary.forEach([&visited](const UserPair& pair, StoredMessages& conversation) {
+    visited += conversation.messageList[0].senderId == pair.smallerId() ? 1 : 0;
+  });
+  EXPECT_EQ(visited, 2000);
+
+  testMessagesDictionary.clear();
+  EXPECT_EQ(testMessagesDictionary.size(), 0);
+  testMessagesDictionary.resize(1);
+  testMessagesDictionary[UserPair(1, 2)];
+  EXPECT_EQ(testMessagesDictionary.size(), 1);
 }
 
 TEST(MessagesDictionaryDict, StoringAndReadingMessages) {
-  char username1[g_UsernameLimit] = "carolyn";
-  char username2[g_UsernameLimit] = "victor";
+  uint32_t userId1 = userIds.intern("carolyn");
+  uint32_t userId2 = userIds.intern("victor");
   char message[g_MessageLimit] = "Hello, Victor!";
 
   StoredMessages testStoredMessages;
 
   // Adding messages
-  testStoredMessages.addMessage(username1, username2, message);
+  testStoredMessages.addMessage(userId1, userId2, message);
 
   // Messages are added correctly
-  EXPECT_EQ(testStoredMessages.messageList[0].senderUsername, username1);
+  EXPECT_EQ(testStoredMessages.messageList[0].senderId, userId1);
   EXPECT_EQ(testStoredMessages.messageList[0].isRead, false);
   EXPECT_EQ(testStoredMessages.messageList[0].messageContent, message);
 
   // Unread messages incremented for recipient
-  EXPECT_EQ(conversationsDictionary.conversations[username2][username1], 1);
+  EXPECT_EQ(conversationsDictionary.conversations[userId2][userId1], 1);
 
   // Setting a message as read
-  testStoredMessages.setRead(0, 0, username2);
+  testStoredMessages.setRead(0, 0, userId2);
 
   EXPECT_EQ(testStoredMessages.messageList[0].isRead, true);
-  EXPECT_EQ(conversationsDictionary.conversations[username1][username2], 0);
+  EXPECT_EQ(conversationsDictionary.conversations[userId1][userId2], 0);
+}
+
+TEST(MessagesDictionaryDict, ReadingOutsideTheConversation) {
+  uint32_t userId1 = userIds.intern("carolyn");
+  uint32_t userId2 = userIds.intern("victor");
+  StoredMessages testStoredMessages;
+  testStoredMessages.addMessage(userId1, userId2, "first");
+  testStoredMessages.addMessage(userId1, userId2, "second");
+
+  // Ranges past either end only mark the messages that are there
+  testStoredMessages.setRead(1, 1000, userId2);
+  EXPECT_EQ(testStoredMessages.messageList[0].isRead, false);
+  EXPECT_EQ(testStoredMessages.messageList[1].isRead, true);
+  testStoredMessages.setRead(-5, 0, userId2);
+  EXPECT_EQ(testStoredMessages.messageList[0].isRead, true);
+  testStoredMessages.setRead(2000000000, 2000000005, userId2);
+  EXPECT_EQ(testStoredMessages.messageCount(), 2);
 }
 
 // TEST(MessagesDictionaryDict, ConsectiveReads) {
@@ -177,45 +246,48 @@ TEST(MessagesDictionaryDict, GettingMessages) {
   char username1[g_UsernameLimit] = "carolyn";
   char username2[g_UsernameLimit] = "victor";
   char message[g_MessageLimit] = "Hello, Victor!";
+  uint32_t userId1 = userIds.intern(username1);
+  uint32_t userId2 = userIds.intern(username2);
 
   StoredMessages testStoredMessages;
 
   // Getting less than g_MessageQueryLimit messages on initial query
   for (int i = 0; i < 10; i++) {
-    testStoredMessages.addMessage(username1, username2, message);
+    testStoredMessages.addMessage(userId1, userId2, message);
   }
   
-  GetStoredMessagesReturnValue test1 = testStoredMessages.getStoredMessages(username2, -1);
+  GetStoredMessagesReturnValue test1 = testStoredMessages.getStoredMessages(userId2, username2, username1, -1);
 
   EXPECT_EQ(test1.messageList.size(), 10);
   EXPECT_EQ(test1.firstMessageIndex, 0);
   EXPECT_EQ(test1.lastMessageIndex, 9);
+  EXPECT_EQ(test1.messageList[0].senderusername(), username1);
   
   // Unread messages incremented for recipient
-  EXPECT_EQ(conversationsDictionary.conversations[username2][username1], 10);
+  EXPECT_EQ(conversationsDictionary.conversations[userId2][userId1], 10);
 
   // Getting g_MessageQueryLimit messages on initial query
   for (int i = 0; i < g_MessageQueryLimit; i++) {
-    testStoredMessages.addMessage(username1, username2, message);
+    testStoredMessages.addMessage(userId1, userId2, message);
   }
   
-  GetStoredMessagesReturnValue test2 = testStoredMessages.getStoredMessages(username2, -1);
+  GetStoredMessagesReturnValue test2 = testStoredMessages.getStoredMessages(userId2, username2, username1, -1);
 
   EXPECT_EQ(test2.messageList.size(), g_MessageQueryLimit);
   EXPECT_EQ(test2.firstMessageIndex, 10);
   EXPECT_EQ(test2.lastMessageIndex, 10+g_MessageQueryLimit-1);
 
   // Unread messages incremented for recipient
-  EXPECT_EQ(conversationsDictionary.conversations[username2][username1], 30);
+  EXPECT_EQ(conversationsDictionary.conversations[userId2][userId1], 30);
 
   // Getting messages on second query
-  GetStoredMessagesReturnValue test3 = testStoredMessages.getStoredMessages(username2, test2.firstMessageIndex);
+  GetStoredMessagesReturnValue test3 = testStoredMessages.getStoredMessages(userId2, username2, username1, test2.firstMessageIndex);
 
   EXPECT_EQ(test3.messageList.size(), 10);
   EXPECT_EQ(test3.firstMessageIndex, 0);
   EXPECT_EQ(test3.lastMessageIndex, 9);
 
-  GetStoredMessagesReturnValue test4  = testStoredMessages.getStoredMessages(username2, test3.firstMessageIndex);
+  GetStoredMessagesReturnValue test4  = testStoredMessages.getStoredMessages(userId2, username2, username1, test3.firstMessageIndex);
 
   EXPECT_EQ(test3.messageList.size(), 10);
   EXPECT_EQ(test3.firstMessageIndex, 0);
@@ -346,6 +418,141 @@ TEST(UsernameTrieStorage, DeleteUser) {
   EXPECT_EQ(usernameTrie.userExists("Carlos"), false);
   EXPECT_EQ(usernameTrie.userExists("Carolyn"), true);
 }
+TEST(UsernameTrieStorage, ManyUsernames) {
+  // Enough names to grow nodes to every size, nested names and long shared prefixes
+  UserTrie usernameTrie;
+  std::set<std::string> expected;
+  for (int i = 0; i < 3000; i++) {
+    std::string name = alphabet.substr(i % alphabet.size(), 1) + std::to_string(i * 7919 % 10007);
+    expected.insert(name);
+    expected.insert("averyverylongsharedprefix" + std::to_string(i % 300));
+    expected.insert(name.substr(0, 2));
+  }
+  for (const std::string& name : expected) {
+    usernameTrie.addUsername(name, "password" + name);
+  }
+
+  for (const std::string& name : expected) {
+    EXPECT_EQ(usernameTrie.userExists(name), true);
+    EXPECT_EQ(usernameTrie.verifyUser(name, "password" + name), true);
+  }
+  EXPECT_EQ(usernameTrie.userExists("averyverylongsharedprefix"), false);
+  EXPECT_EQ(usernameTrie.userExists("averyverylongsharedprefiy1"), false);
+  EXPECT_EQ(usernameTrie.userExists("averyverylongsharedprefix1000"), false);
+
+  // Prefix queries return names in order, whether the prefix ends inside a compressed path or not
+  for (std::string prefix : {"a", "ave", "averyverylongshared", "averyverylongsharedprefix2", "B", "B1", "z9"}) {
+    std::vector<std::string> matching;
+    for (const std::string& name : expected) {
+      if (name.compare(0, prefix.size(), prefix) == 0) {
+        matching.push_back(name);
+      }
+    }
+    EXPECT_EQ(usernameTrie.returnUsersWithPrefix(prefix), matching);
+  }
+  EXPECT_EQ(usernameTrie.returnUsersWithPrefix("").size(), expected.size());
+  EXPECT_THROW(usernameTrie.returnUsersWithPrefix("averyverylongsharedprefiz"), std::runtime_error);
+  EXPECT_THROW(usernameTrie.addUsername("", "password"), std::invalid_argument);
+
+  // Deleted names are gone until they are created again
+  usernameTrie.deleteUser("averyverylongsharedprefix12");
+  EXPECT_EQ(usernameTrie.userExists("averyverylongsharedprefix12"), false);
+  EXPECT_EQ(usernameTrie.userExists("averyverylongsharedprefix120"), true);
+  EXPECT_THROW(usernameTrie.deleteUser("averyverylongsharedprefix12"), std::runtime_error);
+  usernameTrie.addUsername("averyverylongsharedprefix12", "newpassword");
+  EXPECT_EQ(usernameTrie.verifyUser("averyverylongsharedprefix12", "newpassword"), true);
+  usernameTrie.clear();
+  EXPECT_EQ(usernameTrie.returnUsersWithPrefix("").size(), 0);
+}
+TEST(UsernameTrieStorage, ReclaimingDeletedUsers) {
+  UserTrie usernameTrie;
+  std::vector<std::string> names;
+  for (int i = 0; i < 2000; i++) {
+    names.push_back("user" + std::to_string(i * 7919 % 10007));
+  }
+  for (const std::string& name : names) {
+    usernameTrie.addUsername(name, "password");
+  }
+  size_t bytes = usernameTrie.memoryBytes();
+  size_t nodes = usernameTrie.nodeCount();
+
+  // Deleting everyone frees every node, and their prefixes stop matching
+  for (const std::string& name : names) {
+    usernameTrie.deleteUser(name);
+  }
+  EXPECT_EQ(usernameTrie.nodeCount(), 0);
+  EXPECT_EQ(usernameTrie.returnUsersWithPrefix("").size(), 0);
+  EXPECT_THROW(usernameTrie.returnUsersWithPrefix("user"), std::runtime_error);
+
+  // Creating them again reuses the freed slots
+  for (const std::string& name : names) {
+    usernameTrie.addUsername(name, "password");
+  }
+  EXPECT_EQ(usernameTrie.memoryBytes(), bytes);
+  EXPECT_EQ(usernameTrie.nodeCount(), nodes);
+
+  // Churn keeps the index in step with the live users, nodes shrinking and merging as they go
+  std::set<std::string> live(names.begin(), names.end());
+  std::mt19937 random(262);
+  size_t mostLive = live.size();
+  for (int i = 0; i < 20000; i++) {
+    std::string name = "user" + std::to_string(random() % 10007);
+    if (live.count(name) == 1) {
+      usernameTrie.deleteUser(name);
+      live.erase(name);
+    } else {
+      usernameTrie.addUsername(name, "password" + name);
+      live.insert(name);
+      mostLive = std::max(mostLive, live.size());
+    }
+  }
+  EXPECT_EQ(usernameTrie.returnUsersWithPrefix(""), std::vector<std::string>(live.begin(), live.end()));
+  for (int i = 0; i < 10007; i++) {
+    std::string name = "user" + std::to_string(i);
+    EXPECT_EQ(usernameTrie.userExists(name), live.count(name) == 1);
+  }
+  for (const std::string& name : live) {
+    usernameTrie.deleteUser(name);
+  }
+  EXPECT_EQ(usernameTrie.nodeCount(), 0);
+  // Slots are only kept for as many users as were ever live at once
+  EXPECT_LE(usernameTrie.memoryBytes(), 2 * bytes * mostLive / names.size());
+}
+TEST(UsernameTrieStorage, UserRecords) {
+  std::string user1 = "Victor";
+  std::string user2 = "Carolyn";
+  std::string user3 = "Carlos";
+  std::string user4 = "Vicky";
+  UserTrie usernameTrie;
+  usernameTrie.addUsername(user1, "password1", 1, 10);
+  usernameTrie.addUsername(user2, "password2", 2, 11);
+  EXPECT_EQ(usernameTrie.findUser(user3), nullptr);
+
+  // The record holds the user's id and what login checks
+  const UserRecord* record = usernameTrie.findUser(user2);
+  EXPECT_EQ(record->id, 2);
+  EXPECT_EQ(record->createdAt, 11);
+  EXPECT_EQ(record->credential, "password2");
+  EXPECT_EQ(record->flags & g_userRecordCreated, g_userRecordCreated);
+
+  // Creating a taken name only changes its credential
+  usernameTrie.addUsername(user2, "newpassword", 3, 12);
+  EXPECT_EQ(usernameTrie.findUser(user2)->id, 2);
+  EXPECT_EQ(usernameTrie.findUser(user2)->createdAt, 11);
+  EXPECT_EQ(usernameTrie.verifyUser(user2, "newpassword"), true);
+  usernameTrie.deleteUser(user1);
+  EXPECT_EQ(usernameTrie.findUser(user1), nullptr);
+
+  // Restored users keep their records
+  UserRecord restored;
+  restored.id = 9;
+  restored.createdAt = 4;
+  restored.credential = "password4";
+  usernameTrie.restoreUser(user4, restored);
+  EXPECT_EQ(usernameTrie.verifyUser(user4, "password4"), true);
+  EXPECT_EQ(usernameTrie.findUser(user4)->id, 9);
+  EXPECT_EQ(usernameTrie.findUser(user4)->createdAt, 4);
+}
 
 
 int main(int argc, char* argv[]) {
@@ -1,7 +1,19 @@
 #include <gtest/gtest.h>
 #include "../chatService/server/storageUpdates.h"
 
+// Empties the storage the other tests in this file fill, for tests that need to start from nothing
+void resetStorage() {
+    userTrie.clear();
+    userIds.clear();
+    activeUsers.clear();
+    messagesDictionary.clear();
+    conversationsDictionary.conversations.clear();
+    currentConversationsDict.clear();
+    queuedOperationsDictionary.clear();
+}
+
 TEST(StorageUpdates, CreatingAnAccount) {
+    resetStorage();
     std::string username = "carolyn";
     std::string password = "password";
     std::string anotherusername = "victor";
@@ -30,6 +42,7 @@ TEST(StorageUpdates, CreatingAnAccount) {
 }
 
 TEST(StorageUpdates, LoggingIn) {
+    resetStorage();
     std::string username = "carolyn";
     std::string password = "password";
     std::string anotherusername = "victor";
@@ -89,6 +102,7 @@ TEST(StorageUpdates, LoggingOut) {
 }
 
 TEST(StorageUpdates, SendingMessages) {
+    resetStorage();
     std::string username = "carolyn";
     std::string password = "password";
     std::string anotherusername = "victor";
@@ -140,7 +154,34 @@ TEST(StorageUpdates, DeletingAnAccount) {
 
 }
 
+TEST(StorageUpdates, RecreatingAnAccount) {
+    // Names no other test uses, so the conversation holds only this test's messages
+    std::string username = "returning";
+    std::string anotherusername = "greeter";
+    tryCreateAccount(username, "password");
+    tryCreateAccount(anotherusername, "password");
+    uint32_t userId = userIds.find(username);
+    EXPECT_NE(userId, 0);
+    EXPECT_EQ(userTrie.findUser(username)->id, userId);
+    trySendMessage(username, anotherusername, "hello");
+
+    // The name keeps its id once the account is gone, and an account created again under it
+    // finds its conversation
+    tryDeleteAccount(username);
+    EXPECT_EQ(trySendMessage(anotherusername, username, "are you there?"), 1);
+    tryCreateAccount(username, "newpassword");
+    EXPECT_EQ(userTrie.findUser(username)->id, userId);
+    trySendMessage(anotherusername, username, "welcome back");
+
+    std::vector<ChatMessage> messages = tryQueryMessages(username, anotherusername);
+    EXPECT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0].senderusername(), username);
+    EXPECT_EQ(messages[1].senderusername(), anotherusername);
+    EXPECT_EQ(messages[1].msgcontent(), "welcome back");
+}
+
 TEST(StorageUpdates, SeeingMessages) {
+    resetStorage();
     std::string username = "carolyn";
     std::string password = "password";
     std::string anotherusername = "victor";
@@ -179,7 +220,25 @@ TEST(StorageUpdates, SeeingMessages) {
 
 }
 
+TEST(StorageUpdates, SeeingMessagesAtIndex) {
+    std::string username = "indexwriter";
+    std::string anotherusername = "indexreader";
+    tryCreateAccount(username, "password");
+    tryCreateAccount(anotherusername, "password");
+    trySendMessage(username, anotherusername, "first");
+    trySendMessage(username, anotherusername, "second");
+
+    // Without a query there is no cursor, the start index comes with the operation
+    int messagesSeenStatus = tryMessagesSeen(anotherusername, username, 1, 1);
+    EXPECT_EQ(messagesSeenStatus, 0);
+
+    UserPair userPair(userIds.find(username), userIds.find(anotherusername));
+    EXPECT_EQ(messagesDictionary[userPair].messageList[0].isRead, false);
+    EXPECT_EQ(messagesDictionary[userPair].messageList[1].isRead, true);
+}
+
 TEST(StorageUpdates, messagesQueried) {
+    resetStorage();
     std::string username = "carolyn";
     std::string password = "password";
     std::string anotherusername = "victor";
@@ -241,6 +300,9 @@ TEST(StorageUpdates, ParsingLines) {
 
     std::string historyFile = "../tests/testlog.csv";
 
+    // The log is replayed into empty storage, as it is on startup
+    resetStorage();
+
     // populate data structures using file
     std::vector<std::vector<std::string>> content;
 
@@ -256,60 +318,17 @@ TEST(StorageUpdates, ParsingLines) {
     EXPECT_EQ(userTrie.userExists(user1), false);
 
     // Victor's account is active
-    EXPECT_NE(activeUsers.find(user2), activeUsers.end());
+    EXPECT_NE(activeUsers.find(userIds.find(user2)), activeUsers.end());
     
     // Victor's account has password "password"
     EXPECT_EQ(userTrie.verifyUser(user2, "password"), true);
 
-    // Carolyn and Victor have a conversation with the read message "hello"
-    UserPair userPair(user1,user2);
+    // Carolyn and Victor have a conversation with the read message "hello", her id outlives her account
+    UserPair userPair(userIds.find(user1), userIds.find(user2));
 
     EXPECT_EQ(messagesDictionary[userPair].messageList[0].isRead, true);
     EXPECT_EQ(messagesDictionary[userPair].messageList[0].messageContent, "hello");
-    EXPECT_EQ(messagesDictionary[userPair].messageList[0].senderUsername, user1);
-
-}
-
-TEST(StorageUpdates, LogWriting) {
-    std::string testFile = "testWriteLog.csv";
-    std::string username1 = "carolyn";
-    std::string username2 = "victor";
-    std::string password = "password";
-    std::string messageContent = "hello";
-    int messagesSeen = 3;
-    int leader = 1;
-
-    std::ofstream logWriter;
-    logWriter.open(testFile);
-    logWriter << g_csvFields << std::endl;
-
-    // Attempting all valid operations
-    writeToLogs(logWriter, CREATE_ACCOUNT, username1, g_nullString, password);
-    writeToLogs(logWriter, LOGIN, username1, g_nullString, password);
-    writeToLogs(logWriter, LOGOUT, username1);
-    writeToLogs(logWriter, SEND_MESSAGE, username1, username2, g_nullString, messageContent);
-    writeToLogs(logWriter, QUERY_MESSAGES, username1, username2);
-    writeToLogs(logWriter, DELETE_ACCOUNT, username1);
-    writeToLogs(logWriter, MESSAGES_SEEN, username1, username2, g_nullString, g_nullString, std::to_string(messagesSeen));
-    writeToLogs(logWriter, 100);
-
-
-    // populate data structures using file
-    std::vector<std::vector<std::string>> content;
-
-    readFile(&content, testFile);
-
-    // Expect 8 lines, including the header
-    EXPECT_EQ(content.size(), 8);
-
-    // Checking random values
-    EXPECT_EQ(content[1][0], std::to_string(CREATE_ACCOUNT));
-    EXPECT_EQ(content[1][3], password);
-    EXPECT_EQ(content[3][1], username1);
-    EXPECT_EQ(content[7][0], std::to_string(MESSAGES_SEEN));
-    EXPECT_EQ(content[7][1], username1);
-    EXPECT_EQ(content[7][2], username2);
-    EXPECT_EQ(content[7][5], std::to_string(messagesSeen));
+    EXPECT_EQ(messagesDictionary[userPair].messageList[0].senderId, userIds.find(user1));
 
 }
 
@@ -335,6 +354,22 @@ TEST(StorageUpdates, OperationHeap) {
     }
 }
 
+TEST(StorageUpdates, RemovingDuplicateOperations) {
+    // The same send pending on two servers, and a different one a later leader gave the same clock value
+    OperationClass send = makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello", 0, "", 5);
+    OperationClass otherSend = makeOperation(SEND_MESSAGE, "victor", "carolyn", "", "hi", 0, "", 5);
+    OperationClass create = makeOperation(CREATE_ACCOUNT, "carolyn", "", "password", "", 0, "", 4);
+
+    std::vector<OperationClass> operations {send, otherSend, create, send};
+    sortOperations(operations);
+    removeDuplicateOperations(operations);
+    ASSERT_EQ(operations.size(), 3);
+    EXPECT_EQ(operations[0].opCode, CREATE_ACCOUNT);
+    EXPECT_EQ(operations[1].clockVal, 5);
+    EXPECT_EQ(operations[2].clockVal, 5);
+    EXPECT_NE(operations[1].message_content, operations[2].message_content);
+}
+
 int main(int argc, char* argv[]) {
   ::testing::InitGoogleTest(&argc,argv);
   return RUN_ALL_TESTS();
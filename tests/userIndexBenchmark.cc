@@ -0,0 +1,197 @@
+#include <malloc.h>
+#include <chrono>
+#include <new>
+#include <random>
+#include "../chatService/server/storage.h"
+
+// Compares the adaptive radix tree behind UserTrie with the per-character trie it replaced: heap
+// bytes per user (as malloc hands them out, passwords included) and the latency of userExists
+// for present and missing names and of verifyUser. Usernames are first names with a number, as
+// they tend to be. Last, half the users are replaced to show that freed nodes are reused.
+// Usage: userIndexBenchmark [users] [lookups]
+
+const int g_benchmarkRuns = 3;
+
+// Lookup results go here so they are not optimized away
+volatile size_t g_found = 0;
+
+// Every allocation is counted with the size malloc really reserved for it
+size_t g_heapBytes = 0;
+
+void* operator new(size_t size) {
+    void* pointer = malloc(size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    g_heapBytes += malloc_usable_size(pointer);
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        g_heapBytes -= malloc_usable_size(pointer);
+        free(pointer);
+    }
+}
+
+// The trie UserTrie used before, one node and hash table per character
+struct LegacyCharNode {
+    char character;
+    std::unordered_map<char, LegacyCharNode*> children;
+    bool isTerminal;
+
+    LegacyCharNode(char c, bool b) : character(c), isTerminal(b) {}
+};
+
+struct LegacyUserTrie {
+    std::unordered_map<char, LegacyCharNode*> roots;
+    std::unordered_map<LegacyCharNode*, std::string> passwords;
+
+    void addUsername(const std::string& username, const std::string& password) {
+        std::pair<LegacyCharNode*, int> nodeIdxPair = findLongestMatchingPrefix(username);
+        LegacyCharNode* currNode = nodeIdxPair.first;
+        if (currNode == nullptr) {
+            currNode = new LegacyCharNode(username[0], false);
+            roots[username[0]] = currNode;
+            nodeIdxPair.second = 0;
+        }
+        for (size_t idx = nodeIdxPair.second + 1; idx < username.size(); idx++) {
+            LegacyCharNode* newChild = new LegacyCharNode(username[idx], false);
+            currNode->children[username[idx]] = newChild;
+            currNode = newChild;
+        }
+        currNode->isTerminal = true;
+        passwords[currNode] = password;
+    }
+
+    std::pair<LegacyCharNode*, int> findLongestMatchingPrefix(const std::string& username) {
+        if (roots.find(username[0]) == roots.end()) {
+            return std::make_pair(nullptr, -1);
+        }
+        LegacyCharNode* deepestNode = roots[username[0]];
+        size_t idx = 1;
+        while (idx < username.size()) {
+            auto child = deepestNode->children.find(username[idx]);
+            if (child == deepestNode->children.end()) {
+                break;
+            }
+            deepestNode = child->second;
+            idx++;
+        }
+        return std::make_pair(deepestNode, static_cast<int>(idx) - 1);
+    }
+
+    bool userExists(const std::string& user) {
+        std::pair<LegacyCharNode*, int> nodeIdxPair = findLongestMatchingPrefix(user);
+        return nodeIdxPair.first != nullptr && nodeIdxPair.second == static_cast<int>(user.size()) - 1 &&
+               nodeIdxPair.first->isTerminal;
+    }
+
+    bool verifyUser(const std::string& username, const std::string& password) {
+        std::pair<LegacyCharNode*, int> nodeIdxPair = findLongestMatchingPrefix(username);
+        if (nodeIdxPair.first == nullptr || nodeIdxPair.second < static_cast<int>(username.size()) - 1 ||
+                !nodeIdxPair.first->isTerminal) {
+            return false;
+        }
+        return password == passwords[nodeIdxPair.first];
+    }
+};
+
+std::vector<std::string> makeUsernames(int users, std::mt19937& random) {
+    static const char* names[] = {
+        "carolyn", "victor", "olive", "james", "mary", "robert", "patricia", "john", "jennifer",
+        "michael", "linda", "david", "elizabeth", "william", "barbara", "richard", "susan", "joseph",
+        "jessica", "thomas", "sarah", "chris", "karen", "daniel", "lisa", "matthew", "nancy", "anthony",
+        "betty", "mark", "sandra", "donald", "ashley", "steven", "kimberly", "paul", "emily", "andrew",
+        "donna", "joshua", "michelle", "kenneth", "carol", "kevin", "amanda", "brian", "melissa"};
+    const size_t nameCount = sizeof(names) / sizeof(names[0]);
+    std::unordered_set<std::string> seen;
+    std::vector<std::string> usernames;
+    while (static_cast<int>(usernames.size()) < users) {
+        std::string username = names[random() % nameCount] + std::to_string(random() % (users * 4));
+        if (seen.insert(username).second) {
+            usernames.push_back(username);
+        }
+    }
+    return usernames;
+}
+
+// Best of several runs, in nanoseconds per lookup
+template <typename Lookup>
+double bestNanos(const std::vector<std::string>& keys, Lookup lookup) {
+    double best = 0;
+    for (int run = 0; run < g_benchmarkRuns; run++) {
+        size_t found = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const std::string& key : keys) {
+            found += lookup(key);
+        }
+        double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / keys.size();
+        if (run == 0 || nanos < best) {
+            best = nanos;
+        }
+        g_found += found;
+    }
+    return best;
+}
+
+template <typename Trie>
+void runIndex(const std::string& name, Trie& trie, const std::vector<std::string>& usernames,
+              const std::vector<std::string>& hits, const std::vector<std::string>& misses) {
+    size_t before = g_heapBytes;
+    auto start = std::chrono::steady_clock::now();
+    for (const std::string& username : usernames) {
+        trie.addUsername(username, "password");
+    }
+    double insertSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t bytes = g_heapBytes - before;
+
+    double existsHit = bestNanos(hits, [&trie](const std::string& key) { return trie.userExists(key); });
+    double existsMiss = bestNanos(misses, [&trie](const std::string& key) { return trie.userExists(key); });
+    double verify = bestNanos(hits, [&trie](const std::string& key) { return trie.verifyUser(key, "password"); });
+    std::cout << name << ": " << static_cast<double>(bytes) / usernames.size() << " bytes/user, insert "
+              << insertSeconds * 1e9 / usernames.size() << " ns, userExists hit " << existsHit << " ns, miss "
+              << existsMiss << " ns, verifyUser " << verify << " ns" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int users = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    int lookups = argc > 2 ? std::stoi(argv[2]) : 1000000;
+
+    std::mt19937 random(262);
+    std::vector<std::string> usernames = makeUsernames(users, random);
+    std::vector<std::string> hits;
+    std::vector<std::string> misses;
+    for (int i = 0; i < lookups; i++) {
+        const std::string& username = usernames[random() % usernames.size()];
+        hits.push_back(username);
+        // Same shape as a real name, but its number is past any in use
+        misses.push_back(username.substr(0, username.find_first_of("0123456789")) + std::to_string(users * 4 + i));
+    }
+    size_t characters = 0;
+    for (const std::string& username : usernames) {
+        characters += username.size();
+    }
+    std::cout << users << " users, " << lookups << " lookups, average username "
+              << static_cast<double>(characters) / usernames.size() << " characters" << std::endl;
+
+    {
+        LegacyUserTrie legacy;
+        runIndex("per-character trie", legacy, usernames, hits, misses);
+    }
+    UserTrie art;
+    runIndex("adaptive radix tree", art, usernames, hits, misses);
+
+    // Replace half the accounts; freed nodes are reused, so the index stays the size of the live users
+    size_t bytes = art.memoryBytes();
+    for (int i = 0; i < users / 2; i++) {
+        art.deleteUser(usernames[i]);
+    }
+    size_t nodesAfterDelete = art.nodeCount();
+    for (int i = 0; i < users / 2; i++) {
+        art.addUsername("replacement" + std::to_string(i), "password");
+    }
+    std::cout << "replacing half the users: " << nodesAfterDelete << " nodes after deleting, arena "
+              << bytes / 1e6 << " MB -> " << art.memoryBytes() / 1e6 << " MB" << std::endl;
+    return 0;
+}
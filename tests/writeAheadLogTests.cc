@@ -0,0 +1,818 @@
+#include <gtest/gtest.h>
+#include "../chatService/server/writeAheadLog.h"
+
+// Removes a log directory left over from an earlier run
+void clearLogDirectory(std::string dir) {
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            unlink((dir + "/" + name).c_str());
+        }
+    }
+    closedir(dirHandle);
+    rmdir(dir.c_str());
+}
+
+void readFileContents(std::string path, std::string& contents) {
+    std::ifstream file(path, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(WriteAheadLog, LogWriting) {
+    std::string testDir = "testWriteLog";
+    std::string username1 = "carolyn";
+    std::string username2 = "victor";
+    std::string password = "password";
+    std::string messageContent = "hello, with a comma";
+    int messagesSeen = 3;
+    clearLogDirectory(testDir);
+
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+
+        // Attempting all valid operations
+        wal.append(makeOperation(CREATE_ACCOUNT, username1, "", password));
+        wal.append(makeOperation(LOGIN, username1, "", password));
+        wal.append(makeOperation(LOGOUT, username1));
+        wal.append(makeOperation(SEND_MESSAGE, username1, username2, "", messageContent));
+        wal.append(makeOperation(QUERY_MESSAGES, username1, username2));
+        wal.append(makeOperation(DELETE_ACCOUNT, username1));
+        uint64_t lastIndex = wal.append(makeOperation(MESSAGES_SEEN, username1, username2, "", "", messagesSeen, "", 7, 4));
+
+        EXPECT_EQ(lastIndex, 7);
+        EXPECT_EQ(wal.commit(lastIndex).size(), 7);
+    }
+
+    // Reopening the log recovers everything that was written
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.lastIndex(), 7);
+    EXPECT_EQ(wal.commitIndex(), 7);
+
+    std::vector<OperationClass> content;
+    wal.forEachCommitted(1, [&content](uint64_t index, OperationClass& op) {
+        content.push_back(op);
+    });
+
+    // Checking random values
+    EXPECT_EQ(content.size(), 7);
+    EXPECT_EQ(content[0].opCode, CREATE_ACCOUNT);
+    EXPECT_EQ(content[0].password, password);
+    EXPECT_EQ(content[2].username1, username1);
+    EXPECT_EQ(content[3].message_content, messageContent);
+    EXPECT_EQ(content[6].opCode, MESSAGES_SEEN);
+    EXPECT_EQ(content[6].username1, username1);
+    EXPECT_EQ(content[6].username2, username2);
+    EXPECT_EQ(content[6].messagesSeen, messagesSeen);
+    EXPECT_EQ(content[6].clockVal, 7);
+    EXPECT_EQ(content[6].firstMessageIndex, 4);
+    EXPECT_EQ(content[0].firstMessageIndex, -1);
+}
+
+TEST(WriteAheadLog, CommittingEntries) {
+    std::string testDir = "testCommitLog";
+    clearLogDirectory(testDir);
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    wal.append(makeOperation(CREATE_ACCOUNT, "carolyn", "", "password", "", 0, "", 1));
+    wal.append(makeOperation(CREATE_ACCOUNT, "victor", "", "password", "", 0, "", 2));
+    wal.append(makeOperation(LOGOUT, "victor", "", "", "", 0, "", 3));
+
+    // Commit only advances the index, later entries stay pending
+    std::vector<OperationClass> committed = wal.commit(2);
+    EXPECT_EQ(committed.size(), 2);
+    EXPECT_EQ(committed[1].username1, "victor");
+    EXPECT_EQ(wal.commitIndex(), 2);
+    EXPECT_EQ(wal.pendingEntries().size(), 1);
+
+    OperationClass op;
+    EXPECT_EQ(wal.commitNext(op), true);
+    EXPECT_EQ(op.opCode, LOGOUT);
+    EXPECT_EQ(wal.commitNext(op), false);
+    EXPECT_EQ(wal.commitIndex(), 3);
+
+    // Dropping pending entries leaves committed ones alone
+    wal.append(makeOperation(LOGIN, "victor", "", "password", "", 0, "", 4));
+    wal.truncatePending();
+    EXPECT_EQ(wal.lastIndex(), 3);
+    EXPECT_EQ(wal.append(makeOperation(LOGIN, "carolyn", "", "password", "", 0, "", 5)), 4);
+
+    wal.reset();
+    EXPECT_EQ(wal.lastIndex(), 0);
+    EXPECT_EQ(wal.commitIndex(), 0);
+}
+
+TEST(WriteAheadLog, DivergingPendingEntries) {
+    std::string followerDir = "testDivergingFollowerLog";
+    std::string leaderDir = "testDivergingLeaderLog";
+    clearLogDirectory(followerDir);
+    clearLogDirectory(leaderDir);
+
+    // Both logs agree on the committed entries, then each logged a different third entry
+    OperationClass send = makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello", 0, "", 3);
+    OperationClass otherSend = makeOperation(SEND_MESSAGE, "victor", "olive", "", "hi", 0, "", 3);
+    std::string followerPayload;
+    std::string leaderPayload;
+    {
+        WriteAheadLog follower;
+        WriteAheadLog leader;
+        follower.open(followerDir);
+        leader.open(leaderDir);
+        std::string createPayload;
+        for (WriteAheadLog* wal : {&follower, &leader}) {
+            wal->appendAsync(makeOperation(CREATE_ACCOUNT, "carolyn", "", "password", "", 0, "", 1), &createPayload);
+            wal->append(makeOperation(CREATE_ACCOUNT, "victor", "", "password", "", 0, "", 2));
+            wal->commit(2);
+        }
+        follower.appendAsync(send, &followerPayload);
+        follower.appendAsync(makeOperation(LOGOUT, "carolyn", "", "", "", 0, "", 4));
+        leader.appendAsync(otherSend, &leaderPayload);
+
+        // Only the payload an entry was logged with matches it, committed or not
+        EXPECT_EQ(follower.entryMatches(3, followerPayload), true);
+        EXPECT_EQ(follower.entryMatches(3, leaderPayload), false);
+        EXPECT_EQ(follower.entryMatches(1, createPayload), true);
+        EXPECT_EQ(follower.entryMatches(1, leaderPayload), false);
+        EXPECT_EQ(follower.entryMatches(5, leaderPayload), false);
+
+        // Pending entries are dropped from the given one on, committed ones never are
+        follower.truncatePending(4);
+        EXPECT_EQ(follower.lastIndex(), 3);
+        follower.truncatePending(3);
+        EXPECT_EQ(follower.lastIndex(), 2);
+        follower.truncatePending(1);
+        EXPECT_EQ(follower.lastIndex(), 2);
+        EXPECT_EQ(follower.appendEncodedAsync(leaderPayload, otherSend), 3);
+        follower.waitWritten(3);
+    }
+
+    // The leader's entry is the one recovered, "olive" is named by it alone
+    WriteAheadLog follower;
+    follower.open(followerDir);
+    EXPECT_EQ(follower.lastIndex(), 3);
+    EXPECT_EQ(follower.entryMatches(3, leaderPayload), true);
+    std::vector<OperationClass> pending = follower.pendingEntries();
+    ASSERT_EQ(pending.size(), 1);
+    EXPECT_EQ(pending[0].username2, "olive");
+    EXPECT_EQ(pending[0].message_content, "hi");
+
+    // The committed entries are the same in both logs, so are their checksums
+    WriteAheadLog leader;
+    leader.open(leaderDir);
+    uint32_t followerChecksum = 0;
+    uint32_t leaderChecksum = 0;
+    EXPECT_EQ(follower.entryChecksum(2, followerChecksum), true);
+    EXPECT_EQ(leader.entryChecksum(2, leaderChecksum), true);
+    EXPECT_EQ(followerChecksum, leaderChecksum);
+    EXPECT_EQ(follower.entryChecksum(1, leaderChecksum), true);
+    EXPECT_NE(followerChecksum, leaderChecksum);
+    EXPECT_EQ(follower.entryChecksum(4, followerChecksum), false);
+    clearLogDirectory(followerDir);
+    clearLogDirectory(leaderDir);
+}
+
+TEST(WriteAheadLog, TornTail) {
+    std::string testDir = "testTornLog";
+    clearLogDirectory(testDir);
+
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        wal.append(makeOperation(CREATE_ACCOUNT, "carolyn", "", "password", "", 0, "", 1));
+        wal.append(makeOperation(CREATE_ACCOUNT, "victor", "", "password", "", 0, "", 2));
+        wal.commit(1);
+    }
+
+    // Segments are preallocated, so a write cut off by a crash leaves zeros where the end of the
+    // last record should be
+    std::string segment = testDir + "/00000000000000000001.log";
+    std::string contents;
+    readFileContents(segment, contents);
+    size_t lastByte = contents.find_last_not_of('\0');
+    int fd = open(segment.c_str(), O_WRONLY);
+    char zeros[3] = {};
+    EXPECT_EQ(pwrite(fd, zeros, sizeof(zeros), lastByte - 2), 3);
+    close(fd);
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.lastIndex(), 1);
+    EXPECT_EQ(wal.commitIndex(), 1);
+    EXPECT_EQ(wal.pendingEntries().size(), 0);
+
+    // New entries are appended right after the last good record
+    EXPECT_EQ(wal.append(makeOperation(LOGIN, "carolyn", "", "password", "", 0, "", 3)), 2);
+    EXPECT_EQ(wal.pendingEntries()[0].username1, "carolyn");
+}
+
+TEST(WriteAheadLog, UndecodableRecord) {
+    std::string testDir = "testUndecodableLog";
+    clearLogDirectory(testDir);
+
+    std::string firstPayload;
+    std::string secondPayload;
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        wal.appendAsync(makeOperation(CREATE_ACCOUNT, "carolyn", "", "password", "", 0, "", 1), &firstPayload);
+        wal.appendAsync(makeOperation(LOGIN, "carolyn", "", "password", "", 0, "", 2), &secondPayload);
+        wal.waitWritten(2);
+    }
+
+    // The second record keeps a valid checksum but its payload is no operation
+    secondPayload[0] = 0;
+    std::string header;
+    putU32(header, secondPayload.size());
+    putU32(header, recordChecksum(2, secondPayload.data(), secondPayload.size()));
+    putU64(header, 2);
+    std::string record = header + secondPayload;
+    std::string segment = testDir + "/00000000000000000001.log";
+    int fd = open(segment.c_str(), O_WRONLY);
+    EXPECT_EQ(pwrite(fd, record.data(), record.size(), g_walRecordHeaderBytes + firstPayload.size()), record.size());
+    close(fd);
+
+    // Recovery stops before it, as for a torn record
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.lastIndex(), 1);
+    std::vector<OperationClass> pending = wal.pendingEntries();
+    ASSERT_EQ(pending.size(), 1);
+    EXPECT_EQ(pending[0].opCode, CREATE_ACCOUNT);
+    clearLogDirectory(testDir);
+}
+
+TEST(WriteAheadLog, Compacting) {
+    std::string testDir = "testCompactLog";
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    g_walSegmentBytes = 256;
+
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        for (int i = 1; i <= 20; i++) {
+            wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "message " + std::to_string(i), 0, "", i));
+        }
+        wal.commit(12);
+
+        // Only whole segments at or below the snapshot index go, never past the commit index
+        wal.compact(15);
+        EXPECT_GT(wal.firstIndex(), 1);
+        EXPECT_LE(wal.firstIndex(), 13);
+
+        std::vector<uint64_t> indices;
+        wal.forEachEntry(1, 20, [&indices](uint64_t index, OperationClass& op) {
+            indices.push_back(index);
+        });
+        EXPECT_EQ(indices.front(), wal.firstIndex());
+        EXPECT_EQ(indices.back(), 20);
+        EXPECT_EQ(wal.pendingEntries().size(), 8);
+    }
+
+    // Reopening a compacted log keeps its indices
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_GT(wal.firstIndex(), 1);
+    EXPECT_EQ(wal.lastIndex(), 20);
+    EXPECT_EQ(wal.commitIndex(), 12);
+
+    // Resetting to a snapshot index continues the log after it
+    wal.reset(30);
+    EXPECT_EQ(wal.firstIndex(), 31);
+    EXPECT_EQ(wal.append(makeOperation(LOGOUT, "carolyn")), 31);
+
+    g_walSegmentBytes = segmentBytes;
+}
+
+TEST(WriteAheadLog, SealingDuringScan) {
+    std::string testDir = "testSealScanLog";
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    g_walSegmentBytes = 64 * 1024;
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    for (int i = 1; i <= 10; i++) {
+        wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "message " + std::to_string(i), 0, "", i));
+    }
+    wal.commit(10);
+
+    // Appends from inside the scan seal and trim the segment it is reading, the scan still sees
+    // the entries it started with
+    std::vector<uint64_t> indices;
+    wal.forEachEncodedEntry(1, 10, [&](uint64_t index, const char* payload, uint32_t length) {
+        indices.push_back(index);
+        if (index == 1) {
+            for (int i = 11; i <= 200; i++) {
+                wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", std::string(1000, 'x'), 0, "", i));
+            }
+        }
+    });
+    EXPECT_EQ(indices.size(), 10);
+    EXPECT_EQ(indices.back(), 10);
+
+    g_walSegmentBytes = segmentBytes;
+    clearLogDirectory(testDir);
+}
+
+TEST(WriteAheadLog, CompactingDuringScan) {
+    std::string testDir = "testCompactScanLog";
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    g_walSegmentBytes = 256;
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    for (int i = 1; i <= 20; i++) {
+        wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "message " + std::to_string(i), 0, "", i));
+    }
+    wal.commit(20);
+
+    // Compaction waits for the scan to finish instead of deleting segments it has yet to open
+    std::vector<uint64_t> indices;
+    std::thread compaction;
+    wal.forEachEncodedEntry(1, 20, [&](uint64_t index, const char* payload, uint32_t length) {
+        indices.push_back(index);
+        if (index == 1) {
+            compaction = std::thread([&wal]() { wal.compact(20); });
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    });
+    compaction.join();
+    EXPECT_EQ(indices.size(), 20);
+    EXPECT_GT(wal.firstIndex(), 1);
+
+    g_walSegmentBytes = segmentBytes;
+    clearLogDirectory(testDir);
+}
+
+TEST(WriteAheadLog, ReadingThroughBuffer) {
+    std::string testDir = "testReadBufferLog";
+    clearLogDirectory(testDir);
+
+    // Records straddle buffer boundaries, and some are bigger than the buffer
+    std::string bigMessage(g_walReadBufferBytes + 100, 'x');
+    WriteAheadLog wal;
+    wal.open(testDir);
+    for (int i = 1; i <= 3000; i++) {
+        std::string content = (i % 1000 == 0) ? bigMessage : "message " + std::to_string(i);
+        wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", content, 0, "", i));
+    }
+    wal.commit(3000);
+
+    int count = 0;
+    bool inOrder = true;
+    wal.forEachCommitted(1, [&count, &inOrder, &bigMessage](uint64_t index, OperationClass& op) {
+        count++;
+        std::string expected = (index % 1000 == 0) ? bigMessage : "message " + std::to_string(index);
+        inOrder = inOrder && op.clockVal == (int) index && op.message_content == expected;
+    });
+    EXPECT_EQ(count, 3000);
+    EXPECT_EQ(inOrder, true);
+
+    // Recovery reads the same way
+    WriteAheadLog reopened;
+    reopened.open(testDir);
+    EXPECT_EQ(reopened.lastIndex(), 3000);
+}
+
+TEST(WriteAheadLog, ReadingInPlace) {
+    std::string testDir = "testViewLog";
+    clearLogDirectory(testDir);
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello, with a comma", 0, "", 1));
+    wal.append(makeOperation(MESSAGES_SEEN, "victor", "carolyn", "", "", 12, "", 2, 0));
+    wal.commit(2);
+
+    std::vector<OperationClass> content;
+    int messagesSeen = 0;
+    wal.forEachCommittedView(1, [&content, &messagesSeen](uint64_t index, const OperationView& op) {
+        content.push_back(toOperation(op));
+        if (op.opCode == MESSAGES_SEEN) {
+            messagesSeen = op.messagesSeen;
+        }
+    });
+    EXPECT_EQ(content.size(), 2);
+    EXPECT_EQ(content[0].message_content, "hello, with a comma");
+    EXPECT_EQ(content[0].password, "");
+    EXPECT_EQ(content[1].username1, "victor");
+    EXPECT_EQ(messagesSeen, 12);
+
+    // A payload cut short does not decode
+    UsernameDictionary usernames;
+    std::string payload = encodeOperation(content[0], usernames);
+    OperationView view;
+    EXPECT_EQ(decodeOperationView(payload.data(), payload.size(), view, usernames), true);
+    EXPECT_EQ(decodeOperationView(payload.data(), payload.size() - 1, view, usernames), false);
+}
+
+TEST(WriteAheadLog, EncodingOperations) {
+    // The fields in the operation's schema survive a round trip, including a negative clock
+    // value, and fields it does not carry are dropped
+    UsernameDictionary usernames;
+    OperationClass op = makeOperation(MESSAGES_SEEN, "carolyn", "victor", "password", "hi", 300, "localhost:8080", -5, 70000);
+    OperationClass decoded;
+    EXPECT_EQ(decodeOperation(encodeOperation(op, usernames), decoded, usernames), true);
+    EXPECT_EQ(decoded.opCode, MESSAGES_SEEN);
+    EXPECT_EQ(decoded.username1, "carolyn");
+    EXPECT_EQ(decoded.username2, "victor");
+    EXPECT_EQ(decoded.password, "");
+    EXPECT_EQ(decoded.message_content, "");
+    EXPECT_EQ(decoded.messagesSeen, 300);
+    EXPECT_EQ(decoded.leader, "");
+    EXPECT_EQ(decoded.clockVal, -5);
+    EXPECT_EQ(decoded.firstMessageIndex, 70000);
+
+    // Views encode to the same bytes, and a mask outside the schema does not decode
+    std::string payload = encodeOperation(op, usernames);
+    OperationView view;
+    EXPECT_EQ(decodeOperationView(payload.data(), payload.size(), view, usernames), true);
+    EXPECT_EQ(encodeOperation(view, usernames), payload);
+    std::string login = encodeOperation(makeOperation(LOGIN, "carolyn", "", "password"), usernames);
+    login[0] = static_cast<char>(g_operationFormatTag | LOGOUT);
+    EXPECT_EQ(decodeOperation(login, decoded, usernames), false);
+
+    // Operations of an unknown type keep every field
+    EXPECT_EQ(decodeOperation(encodeOperation(makeOperation(100, "a", "b", "c", "d", 1, "e", 2, 3), usernames), decoded, usernames), true);
+    EXPECT_EQ(decoded.leader, "e");
+
+    // Unset fields take no space
+    std::string logout = encodeOperation(makeOperation(LOGOUT, "carolyn", "", "", "", 0, "", 3), usernames);
+    EXPECT_EQ(logout.size(), 11);
+    EXPECT_EQ(decodeOperation(logout, decoded, usernames), true);
+    EXPECT_EQ(decoded.password, "");
+    EXPECT_EQ(decoded.firstMessageIndex, -1);
+
+    // Payloads without the format tag or interned usernames do not decode
+    std::string untagged = logout;
+    untagged[0] = static_cast<char>(LOGOUT);
+    EXPECT_EQ(decodeOperation(untagged, decoded, usernames), false);
+    std::string uninterned = logout;
+    uninterned[2] = static_cast<char>(FIELD_USERNAME1);
+    EXPECT_EQ(decodeOperation(uninterned, decoded, usernames), false);
+
+    // A stream names a user by value once, each end learning the name as it goes
+    UsernameDictionary senderNames;
+    UsernameDictionary receiverNames;
+    OperationClass send = makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello", 0, "", 4);
+    std::string first = encodeStreamedOperation(send, senderNames, 1);
+    std::string second = encodeStreamedOperation(send, senderNames, 2);
+    EXPECT_LT(second.size(), first.size());
+    EXPECT_EQ(decodeStreamedOperation(first, decoded, receiverNames, 1), true);
+    EXPECT_EQ(decodeStreamedOperation(second, decoded, receiverNames, 2), true);
+    EXPECT_EQ(decoded.username1, "carolyn");
+    EXPECT_EQ(decoded.username2, "victor");
+    EXPECT_EQ(decoded.message_content, "hello");
+}
+
+TEST(WriteAheadLog, Syncing) {
+    std::string testDir = "testSyncLog";
+    clearLogDirectory(testDir);
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.syncedIndex(), 0);
+
+    // One sync covers everything appended before it
+    wal.append(makeOperation(CREATE_ACCOUNT, "carolyn", "", "password"));
+    wal.append(makeOperation(CREATE_ACCOUNT, "victor", "", "password"));
+    wal.sync(1);
+    EXPECT_EQ(wal.syncedIndex(), 2);
+    wal.sync(2);
+    EXPECT_EQ(wal.syncCount(), 1);
+
+    // Concurrent callers share syncs
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 8; t++) {
+        writers.push_back(std::thread([&wal]() {
+            for (int i = 0; i < 20; i++) {
+                wal.sync(wal.append(makeOperation(LOGIN, "carolyn", "", "password")));
+            }
+        }));
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(wal.syncedIndex(), 162);
+    EXPECT_LE(wal.syncCount(), 161);
+
+    // Dropped entries are no longer synced, and their replacements get synced again
+    wal.commit(2);
+    wal.truncatePending();
+    EXPECT_EQ(wal.syncedIndex(), 2);
+    wal.sync(10);
+    int syncs = wal.syncCount();
+    wal.append(makeOperation(LOGOUT, "carolyn"));
+    wal.sync(3);
+    EXPECT_EQ(wal.syncedIndex(), 3);
+    EXPECT_EQ(wal.syncCount(), syncs + 1);
+
+    clearLogDirectory(testDir);
+}
+
+// Queues appends without waiting, then checks they all reached the log in order.
+// Small segments make appends roll over while earlier writes are in flight
+void appendAsyncAndReopen(std::string testDir) {
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    g_walSegmentBytes = 4096;
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        uint64_t lastIndex = 0;
+        for (int i = 0; i < 500; i++) {
+            lastIndex = wal.appendAsync(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "message " + std::to_string(i)));
+        }
+        EXPECT_EQ(lastIndex, 500);
+        wal.waitWritten(lastIndex);
+        EXPECT_EQ(wal.writtenIndex(), 500);
+
+        // Everything written can be read back before it is committed
+        int read = 0;
+        wal.forEachEntry(1, 500, [&read](uint64_t index, OperationClass& op) {
+            EXPECT_EQ(op.message_content, "message " + std::to_string(index - 1));
+            read++;
+        });
+        EXPECT_EQ(read, 500);
+        wal.commit(250);
+    }
+
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.lastIndex(), 500);
+    EXPECT_EQ(wal.commitIndex(), 250);
+    EXPECT_EQ(wal.pendingEntries()[0].message_content, "message 250");
+    clearLogDirectory(testDir);
+    g_walSegmentBytes = segmentBytes;
+}
+
+TEST(WriteAheadLog, AppendingAsync) {
+    appendAsyncAndReopen("testAsyncLog");
+}
+
+TEST(WriteAheadLog, AppendingWithBlockingWriter) {
+    g_logWriterUseIoUring = false;
+    appendAsyncAndReopen("testBlockingLog");
+    g_logWriterUseIoUring = true;
+}
+
+TEST(WriteAheadLog, Seeking) {
+    std::string testDir = "testSeekLog";
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    size_t seekIntervalBytes = g_walSeekIntervalBytes;
+    g_walSegmentBytes = 4096;
+    g_walSeekIntervalBytes = 256;
+
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        for (int i = 1; i <= 400; i++) {
+            wal.append(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "message " + std::to_string(i), 0, "", i));
+        }
+        wal.commit(300);
+
+        // Reads start anywhere, in the middle of a segment or right at the start of one
+        for (uint64_t from : {1, 2, 77, 150, 399, 400}) {
+            std::vector<uint64_t> indices;
+            wal.forEachEntry(from, from + 5, [&indices](uint64_t index, OperationClass& op) {
+                EXPECT_EQ(op.clockVal, index);
+                indices.push_back(index);
+            });
+            ASSERT_GT(indices.size(), 0);
+            EXPECT_EQ(indices.front(), from);
+            EXPECT_EQ(indices.back(), std::min<uint64_t>(from + 5, 400));
+        }
+    }
+
+    // Sealed segments are trimmed to their records, the one being appended to stays preallocated
+    std::vector<std::string> names;
+    DIR* dirHandle = opendir(testDir.c_str());
+    struct dirent* entry;
+    while ((entry = readdir(dirHandle)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name.find(g_walSegmentExtension) != std::string::npos) {
+            names.push_back(name);
+        }
+    }
+    closedir(dirHandle);
+    std::sort(names.begin(), names.end());
+    ASSERT_GT(names.size(), 2);
+    struct stat st;
+    stat((testDir + "/" + names[0]).c_str(), &st);
+    EXPECT_LT(st.st_size, 4096);
+    stat((testDir + "/" + names.back()).c_str(), &st);
+    EXPECT_EQ(st.st_size, 4096);
+
+    // Recovery rebuilds the seek points, and dropping pending entries keeps them right
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(wal.lastIndex(), 400);
+    wal.truncatePending();
+    EXPECT_EQ(wal.lastIndex(), 300);
+    EXPECT_EQ(wal.append(makeOperation(LOGOUT, "carolyn", "", "", "", 0, "", 301)), 301);
+    std::vector<uint64_t> indices;
+    wal.forEachEntry(296, 310, [&indices](uint64_t index, OperationClass& op) {
+        EXPECT_EQ(op.clockVal, index);
+        indices.push_back(index);
+    });
+    EXPECT_EQ(indices.size(), 6);
+
+    g_walSegmentBytes = segmentBytes;
+    g_walSeekIntervalBytes = seekIntervalBytes;
+    clearLogDirectory(testDir);
+}
+
+TEST(WriteAheadLog, InterningUsernames) {
+    std::string leaderDir = "testInternLeaderLog";
+    std::string followerDir = "testInternFollowerLog";
+    clearLogDirectory(leaderDir);
+    clearLogDirectory(followerDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    g_walSegmentBytes = 256;
+
+    {
+        WriteAheadLog leader;
+        leader.open(leaderDir);
+        WriteAheadLog follower;
+        follower.open(followerDir);
+
+        // The follower logs the leader's bytes and decodes them against its own dictionary
+        auto replicate = [&leader, &follower](const OperationClass& op) {
+            std::string payload;
+            leader.appendAsync(op, &payload);
+            OperationClass received;
+            EXPECT_EQ(follower.decode(payload, received), true);
+            EXPECT_EQ(received.username1, op.username1);
+            EXPECT_EQ(received.username2, op.username2);
+            follower.appendEncodedAsync(payload, received);
+            return payload;
+        };
+
+        // Names are written by value the first time and by id after that
+        std::string first = replicate(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello"));
+        std::string second = replicate(makeOperation(SEND_MESSAGE, "carolyn", "victor", "", "hello"));
+        EXPECT_EQ(second.size() + 13, first.size());
+        for (int i = 0; i < 20; i++) {
+            replicate(makeOperation(QUERY_MESSAGES, "victor", "carolyn"));
+        }
+        replicate(makeOperation(SEND_MESSAGE, "nobody", "nobody", "", "to myself"));
+        EXPECT_EQ(leader.usernameCount(), 3);
+        EXPECT_EQ(follower.usernameCount(), 3);
+
+        // Names defined by dropped entries are forgotten
+        leader.commit(leader.lastIndex());
+        leader.append(makeOperation(LOGOUT, "dropped"));
+        EXPECT_EQ(leader.usernameCount(), 4);
+        leader.truncatePending();
+        EXPECT_EQ(leader.usernameCount(), 3);
+
+        // Compacting keeps the names of the deleted segments in the usernames file
+        leader.waitWritten(leader.lastIndex());
+        leader.compact(leader.lastIndex());
+        EXPECT_GT(leader.firstIndex(), 2);
+        follower.waitWritten(follower.lastIndex());
+
+        // A log reset to a snapshot continues with the snapshot's names
+        WriteAheadLog installed;
+        installed.open("testInternInstalledLog");
+        installed.reset(follower.lastIndex(), follower.usernamesUpTo(follower.lastIndex()));
+        std::string payload = replicate(makeOperation(QUERY_MESSAGES, "nobody", "victor"));
+        OperationClass received;
+        EXPECT_EQ(installed.decode(payload, received), true);
+        EXPECT_EQ(received.username1, "nobody");
+        clearLogDirectory("testInternInstalledLog");
+    }
+
+    WriteAheadLog leader;
+    leader.open(leaderDir);
+    EXPECT_EQ(leader.usernameCount(), 3);
+    int entries = 0;
+    leader.forEachEntry(leader.firstIndex(), leader.lastIndex(), [&entries](uint64_t index, OperationClass& op) {
+        EXPECT_NE(op.username1, "");
+        entries++;
+    });
+    EXPECT_EQ(entries, leader.lastIndex() - leader.firstIndex() + 1);
+
+    WriteAheadLog follower;
+    follower.open(followerDir);
+    EXPECT_EQ(follower.usernameCount(), 3);
+    OperationClass op;
+    EXPECT_EQ(follower.commitNext(op), true);
+    EXPECT_EQ(op.username2, "victor");
+
+    g_walSegmentBytes = segmentBytes;
+    clearLogDirectory(leaderDir);
+    clearLogDirectory(followerDir);
+}
+
+TEST(WriteAheadLog, CompressingSegments) {
+    std::string testDir = "testCompressLog";
+    clearLogDirectory(testDir);
+    size_t segmentBytes = g_walSegmentBytes;
+    size_t blockBytes = g_compressionBlockBytes;
+    g_walSegmentBytes = 4096;
+    g_compressionBlockBytes = 1024;
+
+    // Some senders are defined in segments that get compressed and referenced after them
+    auto sender = [](uint64_t index) {
+        return index % 50 == 0 ? "user" + std::to_string(index) : std::string("carolyn");
+    };
+    auto checkEntries = [&sender](WriteAheadLog& wal, uint64_t from, uint64_t to) {
+        std::vector<uint64_t> indices;
+        wal.forEachEntry(from, to, [&](uint64_t index, OperationClass& op) {
+            EXPECT_EQ(op.clockVal, index);
+            EXPECT_EQ(op.username1, sender(index));
+            EXPECT_EQ(op.message_content, "message number " + std::to_string(index));
+            indices.push_back(index);
+        });
+        ASSERT_GT(indices.size(), 0);
+        EXPECT_EQ(indices.front(), from);
+        EXPECT_EQ(indices.back(), std::min<uint64_t>(to, 400));
+        EXPECT_EQ(indices.size(), indices.back() - from + 1);
+    };
+    auto segmentFiles = [&testDir](std::string extension) {
+        std::vector<std::string> names;
+        DIR* dirHandle = opendir(testDir.c_str());
+        struct dirent* entry;
+        while ((entry = readdir(dirHandle)) != nullptr) {
+            std::string name = entry->d_name;
+            if (name.size() > extension.size() && name.compare(name.size() - extension.size(), extension.size(), extension) == 0) {
+                names.push_back(name);
+            }
+        }
+        closedir(dirHandle);
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+
+    {
+        WriteAheadLog wal;
+        wal.open(testDir);
+        for (uint64_t i = 1; i <= 400; i++) {
+            wal.append(makeOperation(SEND_MESSAGE, sender(i), "victor", "", "message number " + std::to_string(i), 0, "", i));
+        }
+
+        // Only sealed segments whose entries are all committed are compressed
+        EXPECT_EQ(wal.compressSealedSegments(), 0);
+        wal.commit(300);
+        EXPECT_GT(wal.compressSealedSegments(), 0);
+        EXPECT_EQ(wal.compressSealedSegments(), 0);
+
+        // Reads inflate the blocks they start in and carry on into uncompressed segments
+        for (uint64_t from : {1, 2, 77, 150, 299, 300, 399}) {
+            checkEntries(wal, from, from + 40);
+        }
+    }
+
+    // Compressed segments are well under the size of their records
+    std::vector<std::string> compressedNames = segmentFiles(g_walCompressedExtension);
+    ASSERT_GT(compressedNames.size(), 0);
+    struct stat st;
+    for (const std::string& name : compressedNames) {
+        stat((testDir + "/" + name).c_str(), &st);
+        EXPECT_LT(st.st_size, 2048);
+    }
+
+    // An original left behind by a crash is dropped in favour of the compressed copy
+    std::string leftover = testDir + "/" + compressedNames[0].substr(0, compressedNames[0].size() - 1);
+    std::ofstream(leftover) << "not a segment";
+
+    // Recovery checks the blocks, and the usernames they define come from the usernames file
+    WriteAheadLog wal;
+    wal.open(testDir);
+    EXPECT_EQ(stat(leftover.c_str(), &st), -1);
+    EXPECT_EQ(wal.lastIndex(), 400);
+    EXPECT_EQ(wal.commitIndex(), 300);
+    EXPECT_EQ(wal.pendingEntries().size(), 100);
+    checkEntries(wal, 1, 400);
+    checkEntries(wal, 120, 130);
+
+    wal.truncatePending();
+    EXPECT_EQ(wal.lastIndex(), 300);
+    EXPECT_EQ(wal.append(makeOperation(SEND_MESSAGE, sender(301), "victor", "", "message number 301", 0, "", 301)), 301);
+    checkEntries(wal, 290, 301);
+
+    // Compaction deletes compressed segments like any other
+    wal.compact(300);
+    EXPECT_GT(wal.firstIndex(), 1);
+    EXPECT_EQ(segmentFiles(g_walCompressedExtension).size(), 0);
+
+    g_walSegmentBytes = segmentBytes;
+    g_compressionBlockBytes = blockBytes;
+    clearLogDirectory(testDir);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}